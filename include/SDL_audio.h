@@ -1034,6 +1034,46 @@ extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStream(const SDL_AudioForm
  */
 extern DECLSPEC int SDLCALL SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len);
 
+/**
+ * Get memory to write audio data into, so the stream doesn't have to copy it.
+ *
+ * This is the same as SDL_AudioStreamPut(), but split in two: write up to
+ * `len` bytes of source-format audio into the returned memory, then call
+ * SDL_AudioStreamCommitPut() to add it to the stream. When possible, the
+ * returned memory is inside the stream's own buffers and the conversion
+ * happens right there, which saves copying the data around.
+ *
+ * Only one reservation can be pending at a time. SDL_AudioStreamPut() and
+ * SDL_AudioStreamFlush() fail until it's committed, and
+ * SDL_AudioStreamClear() cancels it.
+ *
+ * \param stream The stream the audio data is being added to
+ * \param len The number of bytes to reserve, a multiple of the source
+ *            sample frame size
+ * \returns a pointer to `len` bytes of writable memory, or NULL on error;
+ *          call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AudioStreamCommitPut
+ * \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC void * SDLCALL SDL_AudioStreamReservePut(SDL_AudioStream *stream, int len);
+
+/**
+ * Add the audio data written to memory from SDL_AudioStreamReservePut().
+ *
+ * \param stream The stream the audio data is being added to
+ * \param len The number of bytes that were written, no more than what was
+ *            reserved. Pass 0 to cancel the reservation.
+ * \returns 0 on success, or -1 on error.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AudioStreamReservePut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamCommitPut(SDL_AudioStream *stream, int len);
+
 /**
  * Get converted/resampled data from the stream
  *
@@ -1053,6 +1093,44 @@ extern DECLSPEC int SDLCALL SDL_AudioStreamPut(SDL_AudioStream *stream, const vo
  */
 extern DECLSPEC int SDLCALL SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len);
 
+/**
+ * Look at converted/resampled data in the stream without copying it.
+ *
+ * This returns a pointer to the next converted audio in the stream's own
+ * buffers. It might be less than SDL_AudioStreamAvailable() reports, because
+ * the stream doesn't keep everything in one block; call this again after
+ * SDL_AudioStreamCommitGet() to get the rest. The data stays valid until it's
+ * committed, or until SDL_AudioStreamGet() or SDL_AudioStreamClear() is
+ * called.
+ *
+ * \param stream The stream the audio is being requested from
+ * \param len On input, the maximum number of bytes wanted, a multiple of the
+ *            destination sample frame size. On output, the number of bytes
+ *            available at the returned pointer.
+ * \returns a pointer to the converted data, or NULL if there's no data
+ *          available or on error; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AudioStreamCommitGet
+ * \sa SDL_AudioStreamGet
+ */
+extern DECLSPEC const void * SDLCALL SDL_AudioStreamReserveGet(SDL_AudioStream *stream, int *len);
+
+/**
+ * Remove data looked at with SDL_AudioStreamReserveGet() from the stream.
+ *
+ * \param stream The stream the audio is being requested from
+ * \param len The number of bytes that were used, no more than what
+ *            SDL_AudioStreamReserveGet() returned
+ * \returns the number of bytes removed from the stream, or -1 on error.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AudioStreamReserveGet
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamCommitGet(SDL_AudioStream *stream, int len);
+
 /**
  * Get the number of converted/resampled bytes available.
  *
@@ -1180,6 +1258,42 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
                                                 SDL_AudioFormat format,
                                                 Uint32 len, int volume);
 
+/**
+ * Mix several audio buffers into a destination buffer in one pass.
+ *
+ * This takes `num_srcs` audio buffers of `len` bytes of `format` data and
+ * mixes all of them into `dst`, each with its own volume adjustment. The
+ * buffer pointed to by `dst` must also be `len` bytes of `format` data.
+ *
+ * Unlike calling SDL_MixAudioFormat() once per buffer, the samples are summed
+ * in an accumulator with greater range than the input, and clipping happens
+ * only once, on the final sum. This avoids the distortion of repeated
+ * clipping, and reads and writes `dst` only once no matter how many buffers
+ * are mixed.
+ *
+ * \param dst the destination for the mixed audio
+ * \param srcs an array of `num_srcs` source audio buffers to be mixed; NULL
+ *             entries are skipped
+ * \param volumes an array of `num_srcs` volumes, ranging from 0 - 128, or
+ *                NULL to mix every buffer at SDL_MIX_MAXVOLUME
+ * \param num_srcs the number of source audio buffers
+ * \param format the SDL_AudioFormat structure representing the desired audio
+ *               format
+ * \param len the length of each audio buffer in bytes
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_MixAudioFormat
+ */
+extern DECLSPEC int SDLCALL SDL_MixAudioBuffers(Uint8 * dst,
+                                                const Uint8 ** srcs,
+                                                const int * volumes,
+                                                int num_srcs,
+                                                SDL_AudioFormat format,
+                                                Uint32 len);
+
 /**
  * Queue more audio on non-callback devices.
  *
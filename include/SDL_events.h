@@ -967,6 +967,34 @@ extern DECLSPEC int SDLCALL SDL_WaitEventTimeout(SDL_Event * event,
  */
 extern DECLSPEC int SDLCALL SDL_PushEvent(SDL_Event * event);
 
+/**
+ * Add several events to the event queue at once.
+ *
+ * This behaves like calling SDL_PushEvent() on each event in order, but the
+ * event queue is locked once for all events that pass the event filter, and
+ * threads waiting for events are woken up only once. This is useful when an
+ * application generates many events at a time, e.g. when replaying input.
+ *
+ * The event filter and event watchers are still called for every event, and
+ * events rejected by the filter are skipped. The timestamp of every event in
+ * `events` is updated to the time they were pushed.
+ *
+ * This function is thread-safe, and can be called from other threads safely.
+ *
+ * \param events an array of SDL_Event structures to be added to the queue
+ * \param numevents the number of events in `events`
+ * \returns the number of events added to the queue, which may be less than
+ *          `numevents` if some were filtered or the queue is full, or a
+ *          negative error code on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_PushEvent
+ * \sa SDL_PeepEvents
+ */
+extern DECLSPEC int SDLCALL SDL_PushEvents(SDL_Event * events, int numevents);
+
 /**
  * A function pointer used for callbacks that watch the event queue.
  *
@@ -1157,6 +1185,75 @@ extern DECLSPEC Uint8 SDLCALL SDL_EventState(Uint32 type, int state);
  */
 extern DECLSPEC Uint32 SDLCALL SDL_RegisterEvents(int numevents);
 
+/**
+ * The number of buckets in SDL_EventQueueStats::latency_histogram.
+ */
+#define SDL_EVENT_LATENCY_BUCKETS 12
+
+/**
+ * Statistics about the internal event queue, see SDL_GetEventQueueStats().
+ *
+ * Latency is the time between an event being pushed and being removed from
+ * the queue by SDL_PollEvent(), SDL_WaitEvent() or SDL_PeepEvents(). Bucket 0
+ * of the histogram counts events removed in the same millisecond they were
+ * pushed, bucket N counts latencies from 2^(N-1) up to 2^N - 1 milliseconds,
+ * and the last bucket counts everything longer than that.
+ */
+typedef struct SDL_EventQueueStats
+{
+    int num_events;             /**< The number of events currently in the queue */
+    int max_events_seen;        /**< The largest number of events that were in the queue at once */
+    Uint32 events_added;        /**< The number of events added to the queue */
+    Uint32 events_dropped;      /**< The number of events dropped because the queue was full */
+    Uint32 latency_histogram[SDL_EVENT_LATENCY_BUCKETS]; /**< Counts of events by queue latency */
+} SDL_EventQueueStats;
+
+/**
+ * Get statistics about the internal event queue.
+ *
+ * The statistics cover the time since the event subsystem was initialized or
+ * since the last call to SDL_ResetEventQueueStats().
+ *
+ * This function is thread-safe.
+ *
+ * \param stats a pointer filled in with the current statistics
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetEventQueueTypeCount
+ * \sa SDL_ResetEventQueueStats
+ */
+extern DECLSPEC int SDLCALL SDL_GetEventQueueStats(SDL_EventQueueStats *stats);
+
+/**
+ * Get the number of events of a given type added to the internal event queue.
+ *
+ * This function is thread-safe.
+ *
+ * \param type the type of event to query; see SDL_EventType for details
+ * \returns the number of events of `type` added to the queue.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetEventQueueStats
+ * \sa SDL_ResetEventQueueStats
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_GetEventQueueTypeCount(Uint32 type);
+
+/**
+ * Reset the statistics gathered about the internal event queue.
+ *
+ * This function is thread-safe.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetEventQueueStats
+ * \sa SDL_GetEventQueueTypeCount
+ */
+extern DECLSPEC void SDLCALL SDL_ResetEventQueueStats(void);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -291,6 +291,21 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_RESAMPLING_MODE   "SDL_AUDIO_RESAMPLING_MODE"
 
+/**
+ *  \brief  A variable controlling whether SDL_QueueAudio() and SDL_DequeueAudio() lock the audio device.
+ *
+ *  This variable can be set to the following values:
+ *    "0"     - Queueing and dequeueing audio lock the audio device (default)
+ *    "1"     - Audio is queued through a lock-free ring, so the application
+ *              and the audio thread never wait on each other.
+ *
+ *  In lock-free mode, SDL_QueueAudio() (or SDL_DequeueAudio() for capture
+ *  devices) must only be called from one thread at a time.
+ *
+ *  This hint is checked when an audio device is opened.
+ */
+#define SDL_HINT_AUDIO_QUEUE_LOCKFREE   "SDL_AUDIO_QUEUE_LOCKFREE"
+
 /**
  *  \brief  A variable controlling whether SDL updates joystick state when getting input events
  *
@@ -315,6 +330,25 @@ extern "C" {
  */
 #define SDL_HINT_AUTO_UPDATE_SENSORS    "SDL_AUTO_UPDATE_SENSORS"
 
+/**
+ *  \brief  A variable controlling how many threads are used for large software blits.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Use one thread per CPU core
+ *    "1"       - Blit on the calling thread (default)
+ *    "N"       - Use N threads, including the calling thread
+ *
+ *  With more than one thread, SDL_BlitSurface(), SDL_BlitScaled(),
+ *  SDL_SoftStretch() and SDL_SoftStretchLinear() split blits of 512x512
+ *  pixels or more into bands of rows and draw the bands in parallel. Scaled
+ *  blits that go through the generic blitters and blits between overlapping
+ *  pixels always run on the calling thread, as does a blit that starts while
+ *  another thread is blitting in parallel. The result is the same either way.
+ *
+ *  This hint is checked on each blit.
+ */
+#define SDL_HINT_BLIT_THREADS "SDL_BLIT_THREADS"
+
 /**
  *  \brief Prevent SDL from using version 4 of the bitmap header when saving BMPs.
  *
@@ -399,6 +433,26 @@ extern "C" {
  */
 #define SDL_HINT_ENABLE_STEAM_CONTROLLERS "SDL_ENABLE_STEAM_CONTROLLERS"
 
+/**
+ *  \brief  A variable controlling whether high rate motion events are merged while they wait in the event queue.
+ *
+ *  This variable can be set to the following values:
+ *    "0"     - Every motion event is queued separately (default)
+ *    "1"     - A new SDL_MOUSEMOTION, SDL_CONTROLLERAXISMOTION or
+ *              SDL_CONTROLLERSENSORUPDATE event is merged into a matching
+ *              event for the same device (and axis or sensor) that is still
+ *              at the end of the queue, unless another axis or sensor of that
+ *              device was queued after it. Relative mouse motion is accumulated,
+ *              other values are replaced by the latest ones.
+ *
+ *  This keeps the queue short when devices report at a high rate and the
+ *  application only needs the latest state. Applications that integrate every
+ *  sensor sample should leave this disabled.
+ *
+ *  This hint can be changed at runtime.
+ */
+#define SDL_HINT_EVENT_COALESCE_MOTION   "SDL_EVENT_COALESCE_MOTION"
+
 /**
  *  \brief  A variable controlling verbosity of the logging of SDL events pushed onto the internal queue.
  *
@@ -421,6 +475,43 @@ extern "C" {
  */
 #define SDL_HINT_EVENT_LOGGING   "SDL_EVENT_LOGGING"
 
+/**
+ *  \brief  A variable controlling whether events are pushed onto the internal queue without locking it.
+ *
+ *  This variable can be set to the following values:
+ *    "0"     - Pushing an event locks the event queue (default)
+ *    "1"     - Events are pushed into a preallocated lock-free ring and moved
+ *              into the event queue by the thread reading events.
+ *
+ *  This is useful when several threads push events at a high rate, e.g.
+ *  input threads and SDL_PushEvent() from application threads. The order
+ *  and filtering of events seen by SDL_PeepEvents() are not affected.
+ *
+ *  This hint can be changed at runtime.
+ */
+#define SDL_HINT_EVENT_QUEUE_LOCKFREE   "SDL_EVENT_QUEUE_LOCKFREE"
+
+/**
+ *  \brief  A variable controlling whether event queue statistics are logged when the event subsystem shuts down.
+ *
+ *  This variable can be set to the following values:
+ *    "0"     - Don't log statistics (default)
+ *    "1"     - Log statistics when the event subsystem shuts down
+ *
+ *  Statistics are sent through SDL_Log(), and can also be queried at any time with SDL_GetEventQueueStats().
+ */
+#define SDL_HINT_EVENT_QUEUE_STATISTICS   "SDL_EVENT_QUEUE_STATISTICS"
+
+/**
+ *  \brief  A variable controlling how often event queue statistics are logged while pumping events.
+ *
+ *  This variable is the interval in milliseconds between logs from SDL_PumpEvents().
+ *  The default is "0", which disables periodic logging.
+ *
+ *  This hint can be changed at runtime.
+ */
+#define SDL_HINT_EVENT_QUEUE_STATISTICS_INTERVAL   "SDL_EVENT_QUEUE_STATISTICS_INTERVAL"
+
 /**
  *  \brief  A variable controlling whether raising the window should be done more forcefully
  *
@@ -1677,6 +1768,25 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_OPENGL_SHADERS      "SDL_RENDER_OPENGL_SHADERS"
 
+/**
+ *  \brief  A variable controlling whether the OpenGL ES 2 render driver caches its shader programs on disk.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Compile the shaders every time a renderer is created (default)
+ *    "1"       - Cache the linked programs in SDL_GetPrefPath("libsdl", "gles2_programs")
+ *    "path"    - Cache the linked programs in this directory, which must exist
+ *                and end with a path separator
+ *
+ *  The cache needs the GL_OES_get_program_binary extension and is ignored
+ *  without it. Cached programs are only used with the driver that saved them;
+ *  when one can't be loaded, the program is compiled and saved again.
+ *  Programs are written to a temporary file that then replaces the cached
+ *  one, so several applications can share the cache.
+ *
+ *  This hint is checked when the renderer is created.
+ */
+#define SDL_HINT_RENDER_OPENGLES2_PROGRAM_CACHE "SDL_RENDER_OPENGLES2_PROGRAM_CACHE"
+
 /**
  *  \brief  A variable controlling the scaling quality
  *
@@ -1689,6 +1799,40 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_SCALE_QUALITY       "SDL_RENDER_SCALE_QUALITY"
 
+/**
+ *  \brief  A variable controlling how many threads the software renderer draws with.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Use one thread per CPU core
+ *    "1"       - Draw everything on the thread calling the render functions (default)
+ *    "N"       - Use N threads, including the thread calling the render functions
+ *
+ *  With more than one thread, the software renderer splits the target into
+ *  tiles and draws the tiles in parallel. Clears, points, filled rectangles,
+ *  unscaled copies and untextured geometry are drawn this way; other commands
+ *  are drawn in order on the calling thread. The result is the same either way.
+ *
+ *  This hint is checked when the renderer is created.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS    "SDL_RENDER_SOFTWARE_THREADS"
+
+/**
+ *  \brief  A variable controlling whether small static textures share larger textures.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Every texture has its own storage (default)
+ *    "1"       - Static textures up to 128x128 pixels are packed into shared
+ *                atlas textures, so draws using different textures can be
+ *                batched together
+ *
+ *  Packed textures can't be used with SDL_GL_BindTexture(). The space used by
+ *  a packed texture is only reclaimed once every texture sharing its atlas has
+ *  been destroyed.
+ *
+ *  This hint is checked when a texture is created.
+ */
+#define SDL_HINT_RENDER_TEXTURE_ATLAS       "SDL_RENDER_TEXTURE_ATLAS"
+
 /**
  *  \brief  A variable controlling whether updates to the SDL screen surface should be synchronized with the vertical refresh, to avoid tearing.
  *
@@ -2549,6 +2693,24 @@ extern "C" {
  */
 #define SDL_HINT_XINPUT_USE_OLD_JOYSTICK_MAPPING "SDL_XINPUT_USE_OLD_JOYSTICK_MAPPING"
 
+/**
+ *  \brief  A variable controlling how many threads are used to convert large YUV images to RGB.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Use one thread per CPU core
+ *    "1"       - Convert on the calling thread (default)
+ *    "N"       - Use N threads, including the calling thread
+ *
+ *  With more than one thread, SDL_ConvertPixels() and the software YUV
+ *  texture path split large YV12, IYUV, NV12 and NV21 images into bands of
+ *  rows and convert the bands in parallel. If another thread is already
+ *  converting in parallel, the conversion runs on the calling thread. The
+ *  result is the same either way.
+ *
+ *  This hint is checked on each conversion.
+ */
+#define SDL_HINT_YUV_CONVERSION_THREADS "SDL_YUV_CONVERSION_THREADS"
+
 /**
  *  \brief  A variable that causes SDL to not ignore audio "monitors"
  *
@@ -632,12 +632,16 @@ extern DECLSPEC int SDLCALL SDL_UpdateYUVTexture(SDL_Texture * texture,
                                                  const Uint8 *Vplane, int Vpitch);
 
 /**
- * Update a rectangle within a planar NV12 or NV21 texture with new pixels.
+ * Update a rectangle within a planar NV12, NV21, P010 or P016 texture with
+ * new pixels.
  *
  * You can use SDL_UpdateTexture() as long as your pixel data is a contiguous
  * block of NV12/21 planes in the proper order, but this function is available
  * if your pixel data is not contiguous.
  *
+ * P010 and P016 planes hold 16-bit samples, so their pitches are twice as
+ * large as the NV12 ones for the same width.
+ *
  * \param texture the texture to update
  * \param rect a pointer to the rectangle of pixels to update, or NULL to
  *             update the entire texture.
@@ -1913,6 +1917,52 @@ extern DECLSPEC void *SDLCALL SDL_RenderGetMetalCommandEncoder(SDL_Renderer * re
  */
 extern DECLSPEC int SDLCALL SDL_RenderSetVSync(SDL_Renderer* renderer, int vsync);
 
+/**
+ * Statistics about the work a renderer did for one frame, see
+ * SDL_RenderGetStats().
+ *
+ * The command counts are taken after the command queue is optimized, right
+ * before it is handed to the backend. Draw calls are counted by the software,
+ * OpenGL and OpenGL ES 2 backends, and are 0 with other backends.
+ */
+typedef struct SDL_RenderStats
+{
+    Uint32 frames_presented;      /**< The number of frames presented so far, including this one */
+    Uint32 viewport_commands;     /**< The number of viewport changes */
+    Uint32 cliprect_commands;     /**< The number of clip rectangle changes */
+    Uint32 drawcolor_commands;    /**< The number of draw color changes */
+    Uint32 clear_commands;        /**< The number of clears */
+    Uint32 point_commands;        /**< The number of point draws */
+    Uint32 line_commands;         /**< The number of line draws */
+    Uint32 rect_commands;         /**< The number of rectangle fills */
+    Uint32 copy_commands;         /**< The number of texture copies */
+    Uint32 copyex_commands;       /**< The number of rotated or flipped texture copies */
+    Uint32 geometry_commands;     /**< The number of geometry draws */
+    Uint32 draw_calls;            /**< The number of draw calls issued by the backend */
+    Uint64 vertex_bytes;          /**< The number of bytes of vertex data queued */
+    Uint64 texture_upload_bytes;  /**< The number of bytes of pixels uploaded to textures */
+    Uint64 flush_time_ns;         /**< The time spent running the command queue, in nanoseconds */
+    Uint64 present_time_ns;       /**< The time spent presenting the frame, in nanoseconds */
+} SDL_RenderStats;
+
+/**
+ * Get statistics about the last frame presented by a renderer.
+ *
+ * The statistics cover everything done with the renderer between the two
+ * last calls to SDL_RenderPresent(), including the final flush and present.
+ * Before the first frame is presented, they are all 0.
+ *
+ * \param renderer the rendering context
+ * \param stats a pointer filled in with the statistics of the last frame
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderPresent
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetStats(SDL_Renderer *renderer, SDL_RenderStats *stats);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -570,6 +570,12 @@ extern DECLSPEC int SDLCALL SDL_GetSurfaceAlphaMod(SDL_Surface * surface,
  * existing data, the blendmode of the SOURCE surface should be set to
  * `SDL_BLENDMODE_NONE`.
  *
+ * Besides the predefined blend modes, blits support premultiplied alpha, the
+ * blend mode returned by
+ * `SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD)`.
+ * The source pixels are expected to be premultiplied already, for example
+ * with SDL_PremultiplyAlpha().
+ *
  * \param surface the SDL_Surface structure to update
  * \param blendMode the SDL_BlendMode to use for blit blending
  * \returns 0 on success or a negative error code on failure; call
@@ -727,7 +733,10 @@ extern DECLSPEC int SDLCALL SDL_ConvertPixels(int width, int height,
  *
  * This is safe to use with src == dst, but not for other overlapping areas.
  *
- * This function is currently only implemented for SDL_PIXELFORMAT_ARGB8888.
+ * This function is currently only implemented for SDL_PIXELFORMAT_ARGB8888,
+ * SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888 and
+ * SDL_PIXELFORMAT_BGRA8888. Each color component is multiplied by alpha / 255
+ * and rounded to the nearest value.
  *
  * \param width the width of the block to convert, in pixels
  * \param height the height of the block to convert, in pixels
@@ -741,6 +750,8 @@ extern DECLSPEC int SDLCALL SDL_ConvertPixels(int width, int height,
  *          SDL_GetError() for more information.
  *
  * \since This function is available since SDL 2.0.18.
+ *
+ * \sa SDL_UnpremultiplyAlpha
  */
 extern DECLSPEC int SDLCALL SDL_PremultiplyAlpha(int width, int height,
                                                  Uint32 src_format,
@@ -748,6 +759,38 @@ extern DECLSPEC int SDLCALL SDL_PremultiplyAlpha(int width, int height,
                                                  Uint32 dst_format,
                                                  void * dst, int dst_pitch);
 
+/**
+ * Remove premultiplied alpha from a block of pixels.
+ *
+ * This is the inverse of SDL_PremultiplyAlpha(). Each color component is
+ * multiplied by 255 / alpha, rounded to the nearest value and clamped to 255.
+ * Pixels with an alpha of 0 become fully transparent black.
+ *
+ * This is safe to use with src == dst, but not for other overlapping areas.
+ *
+ * This function supports the same pixel formats as SDL_PremultiplyAlpha().
+ *
+ * \param width the width of the block to convert, in pixels
+ * \param height the height of the block to convert, in pixels
+ * \param src_format an SDL_PixelFormatEnum value of the `src` pixels format
+ * \param src a pointer to the source pixels
+ * \param src_pitch the pitch of the source pixels, in bytes
+ * \param dst_format an SDL_PixelFormatEnum value of the `dst` pixels format
+ * \param dst a pointer to be filled in with straight alpha pixel data
+ * \param dst_pitch the pitch of the destination pixels, in bytes
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_PremultiplyAlpha
+ */
+extern DECLSPEC int SDLCALL SDL_UnpremultiplyAlpha(int width, int height,
+                                                   Uint32 src_format,
+                                                   const void * src, int src_pitch,
+                                                   Uint32 dst_format,
+                                                   void * dst, int dst_pitch);
+
 /**
  * Perform a fast fill of a rectangle with a specific color.
  *
@@ -52,6 +52,8 @@
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
 #include "thread/SDL_thread_c.h"
+#include "video/SDL_blit.h"
+#include "video/SDL_yuv_c.h"
 
 /* Initialization/Cleanup routines */
 #ifndef SDL_TIMERS_DISABLED
@@ -549,6 +551,8 @@ void SDL_Quit(void)
 
     SDL_ClearHints();
     SDL_AssertionsQuit();
+    SDL_QuitYUV();
+    SDL_QuitBlit();
 
     /* Now that every subsystem has been quit, we reset the subsystem refcount
      * and the list of initialized subsystems.
@@ -25,20 +25,43 @@
 
 typedef struct SDL_DataQueuePacket
 {
+    size_t capacity;                       /* bytes this packet can hold, at least the queue's packet_size. */
     size_t datalen;                        /* bytes currently in use in this packet. */
     size_t startpos;                       /* bytes currently consumed in this packet. */
     struct SDL_DataQueuePacket *next;      /* next item in linked list. */
     Uint8 data[SDL_VARIABLE_LENGTH_ARRAY]; /* packet data */
 } SDL_DataQueuePacket;
 
+/* Lock-free single producer/single consumer mode. The producer fills a ring
+   of packets and publishes them with atomics, so neither side ever waits on
+   the other. If the ring is full, the rest goes to the usual locked packet
+   list until the consumer has drained it, which keeps the data in order. */
+#define SDL_DATAQUEUE_RING_SLOTS 64
+
+typedef struct SDL_DataQueueRing
+{
+    SDL_DataQueuePacket *slots[SDL_DATAQUEUE_RING_SLOTS]; /* allocated by the producer as needed. */
+    SDL_atomic_t filled[SDL_DATAQUEUE_RING_SLOTS];        /* bytes published in each slot. */
+    SDL_atomic_t queued;   /* bytes in the ring and the locked list. */
+    SDL_atomic_t overflow; /* bytes in the locked list. */
+    SDL_atomic_t tail;     /* one past the last slot the producer opened. */
+    size_t write_pos;      /* producer only: bytes written to slot (tail - 1). */
+    char cache_pad0[SDL_CACHELINE_SIZE];
+    SDL_atomic_t head;     /* first slot the consumer hasn't finished. */
+    size_t read_pos;       /* consumer only: bytes read from slot head. */
+} SDL_DataQueueRing;
+
 struct SDL_DataQueue
 {
     SDL_mutex *lock;
+    SDL_DataQueueRing *ring;   /* NULL unless this is a lock-free queue. */
     SDL_DataQueuePacket *head; /* device fed from here. */
     SDL_DataQueuePacket *tail; /* queue fills to here. */
     SDL_DataQueuePacket *pool; /* these are unused packets. */
     size_t packet_size;        /* size of new packets */
     size_t queued_bytes;       /* number of bytes of data in the queue. */
+    SDL_DataQueuePacket *reserved; /* packet handed out by SDL_ReserveSpaceInDataQueue(), if any. */
+    SDL_bool reserved_detached;    /* SDL_TRUE if the reserved packet isn't linked into the queue (yet). */
 };
 
 static void SDL_FreeDataQueueList(SDL_DataQueuePacket *packet)
@@ -72,6 +95,7 @@ SDL_DataQueue *SDL_NewDataQueue(const size_t _packetlen, const size_t initialsla
         for (i = 0; i < wantpackets; i++) {
             SDL_DataQueuePacket *packet = (SDL_DataQueuePacket *)SDL_malloc(sizeof(SDL_DataQueuePacket) + packetlen);
             if (packet) { /* don't care if this fails, we'll deal later. */
+                packet->capacity = packetlen;
                 packet->datalen = 0;
                 packet->startpos = 0;
                 packet->next = queue->pool;
@@ -83,11 +107,54 @@ SDL_DataQueue *SDL_NewDataQueue(const size_t _packetlen, const size_t initialsla
     return queue;
 }
 
+SDL_DataQueue *SDL_NewLockFreeDataQueue(const size_t packetlen, const size_t initialslack)
+{
+    SDL_DataQueue *queue = SDL_NewDataQueue(packetlen, 0);
+    size_t wantpackets, i;
+
+    if (!queue) {
+        return NULL;
+    }
+
+    queue->ring = (SDL_DataQueueRing *)SDL_calloc(1, sizeof(SDL_DataQueueRing));
+    if (!queue->ring) {
+        SDL_FreeDataQueue(queue);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    queue->ring->write_pos = queue->packet_size; /* no slot open yet. */
+
+    /* the ring's packets never go back to the pool, so the slack goes straight into it. */
+    wantpackets = SDL_min((initialslack + (queue->packet_size - 1)) / queue->packet_size, SDL_DATAQUEUE_RING_SLOTS);
+    for (i = 0; i < wantpackets; i++) {
+        SDL_DataQueuePacket *packet = (SDL_DataQueuePacket *)SDL_malloc(sizeof(SDL_DataQueuePacket) + queue->packet_size);
+        if (packet) { /* don't care if this fails, we'll deal later. */
+            packet->capacity = queue->packet_size;
+            packet->datalen = 0;
+            packet->startpos = 0;
+            packet->next = NULL;
+            queue->ring->slots[i] = packet;
+        }
+    }
+
+    return queue;
+}
+
 void SDL_FreeDataQueue(SDL_DataQueue *queue)
 {
     if (queue) {
+        if (queue->ring) {
+            size_t i;
+            for (i = 0; i < SDL_DATAQUEUE_RING_SLOTS; i++) {
+                SDL_free(queue->ring->slots[i]);
+            }
+            SDL_free(queue->ring);
+        }
         SDL_FreeDataQueueList(queue->head);
         SDL_FreeDataQueueList(queue->pool);
+        if (queue->reserved_detached) {
+            SDL_free(queue->reserved);
+        }
         SDL_DestroyMutex(queue->lock);
         SDL_free(queue);
     }
@@ -105,10 +172,39 @@ void SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack)
         return;
     }
 
+    if (queue->ring) {
+        /* this is only safe because neither side is running right now; the ring keeps its packets. */
+        SDL_DataQueueRing *ring = queue->ring;
+        SDL_AtomicSet(&ring->head, SDL_AtomicGet(&ring->tail));
+        ring->read_pos = 0;
+        ring->write_pos = queue->packet_size;
+        SDL_AtomicSet(&ring->queued, 0);
+        SDL_AtomicSet(&ring->overflow, 0);
+    }
+
     SDL_LockMutex(queue->lock);
 
     packet = queue->head;
 
+    /* a reserved packet is still being written to, so take it out of the
+       queue instead of recycling it. Whatever it held is dropped. */
+    if (queue->reserved && !queue->reserved_detached) {
+        SDL_DataQueuePacket *reserved = queue->reserved;
+        SDL_assert(reserved == queue->tail);
+        if (packet == reserved) {
+            packet = NULL;
+        } else {
+            SDL_DataQueuePacket *last = packet;
+            while (last->next != reserved) {
+                last = last->next;
+            }
+            last->next = NULL;
+            queue->tail = last;
+        }
+        reserved->startpos = reserved->datalen;
+        queue->reserved_detached = SDL_TRUE;
+    }
+
     /* merge the available pool and the current queue into one list. */
     if (packet) {
         queue->tail->next = queue->pool;
@@ -140,27 +236,39 @@ void SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack)
 }
 
 /* You must hold queue->lock before calling this! */
-static SDL_DataQueuePacket *AllocateDataQueuePacket(SDL_DataQueue *queue)
+static SDL_DataQueuePacket *TakeDataQueuePacket(SDL_DataQueue *queue, const size_t len)
 {
     SDL_DataQueuePacket *packet;
 
     SDL_assert(queue != NULL);
 
     packet = queue->pool;
-    if (packet) {
+    if (packet && len <= packet->capacity) {
         /* we have one available in the pool. */
         queue->pool = packet->next;
     } else {
         /* Have to allocate a new one! */
-        packet = (SDL_DataQueuePacket *)SDL_malloc(sizeof(SDL_DataQueuePacket) + queue->packet_size);
+        const size_t capacity = SDL_max(len, queue->packet_size);
+        packet = (SDL_DataQueuePacket *)SDL_malloc(sizeof(SDL_DataQueuePacket) + capacity);
         if (!packet) {
             return NULL;
         }
+        packet->capacity = capacity;
     }
 
     packet->datalen = 0;
     packet->startpos = 0;
     packet->next = NULL;
+    return packet;
+}
+
+/* You must hold queue->lock before calling this! */
+static SDL_DataQueuePacket *AllocateDataQueuePacket(SDL_DataQueue *queue)
+{
+    SDL_DataQueuePacket *packet = TakeDataQueuePacket(queue, 0);
+    if (!packet) {
+        return NULL;
+    }
 
     SDL_assert((queue->head != NULL) == (queue->queued_bytes != 0));
     if (!queue->tail) {
@@ -172,11 +280,10 @@ static SDL_DataQueuePacket *AllocateDataQueuePacket(SDL_DataQueue *queue)
     return packet;
 }
 
-int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _len)
+static int WriteToDataQueueLocked(SDL_DataQueue *queue, const void *_data, const size_t _len)
 {
     size_t len = _len;
     const Uint8 *data = (const Uint8 *)_data;
-    const size_t packet_size = queue ? queue->packet_size : 0;
     SDL_DataQueuePacket *orighead;
     SDL_DataQueuePacket *origtail;
     size_t origlen;
@@ -188,14 +295,19 @@ int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _
 
     SDL_LockMutex(queue->lock);
 
+    if (queue->reserved) {
+        SDL_UnlockMutex(queue->lock);
+        return SDL_SetError("Data queue has space reserved that hasn't been committed");
+    }
+
     orighead = queue->head;
     origtail = queue->tail;
     origlen = origtail ? origtail->datalen : 0;
 
     while (len > 0) {
         SDL_DataQueuePacket *packet = queue->tail;
-        SDL_assert(packet == NULL || (packet->datalen <= packet_size));
-        if (!packet || (packet->datalen >= packet_size)) {
+        SDL_assert(packet == NULL || (packet->datalen <= packet->capacity));
+        if (!packet || (packet->datalen >= packet->capacity)) {
             /* tail packet missing or completely full; we need a new packet. */
             packet = AllocateDataQueuePacket(queue);
             if (!packet) {
@@ -217,7 +329,7 @@ int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _
             }
         }
 
-        datalen = SDL_min(len, packet_size - packet->datalen);
+        datalen = SDL_min(len, packet->capacity - packet->datalen);
         SDL_memcpy(packet->data + packet->datalen, data, datalen);
         data += datalen;
         len -= datalen;
@@ -230,8 +342,7 @@ int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _
     return 0;
 }
 
-size_t
-SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
+static size_t PeekIntoDataQueueLocked(SDL_DataQueue *queue, void *_buf, const size_t _len)
 {
     size_t len = _len;
     Uint8 *buf = (Uint8 *)_buf;
@@ -259,12 +370,11 @@ SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
     return (size_t)(ptr - buf);
 }
 
-size_t
-SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
+/* if buf is NULL, the data is thrown away instead of copied. */
+static size_t ReadFromDataQueueInternal(SDL_DataQueue *queue, Uint8 *buf, const size_t _len)
 {
     size_t len = _len;
-    Uint8 *buf = (Uint8 *)_buf;
-    Uint8 *ptr = buf;
+    size_t total = 0;
     SDL_DataQueuePacket *packet;
 
     if (!queue) {
@@ -278,17 +388,27 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
         const size_t cpy = SDL_min(len, avail);
         SDL_assert(queue->queued_bytes >= avail);
 
-        SDL_memcpy(ptr, packet->data + packet->startpos, cpy);
+        if (buf) {
+            SDL_memcpy(buf + total, packet->data + packet->startpos, cpy);
+        }
         packet->startpos += cpy;
-        ptr += cpy;
+        total += cpy;
         queue->queued_bytes -= cpy;
         len -= cpy;
 
         if (packet->startpos == packet->datalen) { /* packet is done, put it in the pool. */
             queue->head = packet->next;
             SDL_assert((packet->next != NULL) || (packet == queue->tail));
-            packet->next = queue->pool;
-            queue->pool = packet;
+            if (packet == queue->reserved) {
+                /* still being written to; SDL_CommitSpaceInDataQueue() will put it back. */
+                packet->next = NULL;
+                queue->reserved_detached = SDL_TRUE;
+            } else if (packet->capacity > queue->packet_size) {
+                SDL_free(packet); /* don't keep oversized packets around. */
+            } else {
+                packet->next = queue->pool;
+                queue->pool = packet;
+            }
         }
     }
 
@@ -300,14 +420,322 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
 
     SDL_UnlockMutex(queue->lock);
 
-    return (size_t)(ptr - buf);
+    return total;
+}
+
+/* Producer side of a lock-free queue. */
+static int WriteToDataQueueRing(SDL_DataQueue *queue, const Uint8 *data, size_t len)
+{
+    SDL_DataQueueRing *ring = queue->ring;
+    const size_t packet_size = queue->packet_size;
+    int retval = 0;
+
+    while (len > 0) {
+        Uint32 tail = (Uint32)SDL_AtomicGet(&ring->tail);
+        SDL_DataQueuePacket *packet;
+        size_t cpy;
+
+        /* once anything went to the locked list, everything after it has to, too. */
+        if (SDL_AtomicGet(&ring->overflow) > 0) {
+            break;
+        }
+
+        if (ring->write_pos == packet_size) {
+            /* current slot is full (or there isn't one); open the next one. */
+            const Uint32 slot = tail % SDL_DATAQUEUE_RING_SLOTS;
+            if ((tail - (Uint32)SDL_AtomicGet(&ring->head)) == SDL_DATAQUEUE_RING_SLOTS) {
+                break; /* ring is full. */
+            }
+            if (!ring->slots[slot]) {
+                packet = (SDL_DataQueuePacket *)SDL_malloc(sizeof(SDL_DataQueuePacket) + packet_size);
+                if (!packet) {
+                    break; /* the locked list will report the error if it can't allocate either. */
+                }
+                packet->capacity = packet_size;
+                packet->datalen = 0;
+                packet->startpos = 0;
+                packet->next = NULL;
+                ring->slots[slot] = packet;
+            }
+            SDL_AtomicSet(&ring->filled[slot], 0);
+            ring->write_pos = 0;
+            SDL_AtomicSet(&ring->tail, (int)++tail);
+        }
+
+        packet = ring->slots[(tail - 1) % SDL_DATAQUEUE_RING_SLOTS];
+        cpy = SDL_min(len, packet_size - ring->write_pos);
+        SDL_memcpy(packet->data + ring->write_pos, data, cpy);
+        ring->write_pos += cpy;
+        /* count it first, so the consumer can't take it out before it's been added. */
+        SDL_AtomicAdd(&ring->queued, (int)cpy);
+        /* this publishes the data to the consumer. */
+        SDL_AtomicSet(&ring->filled[(tail - 1) % SDL_DATAQUEUE_RING_SLOTS], (int)ring->write_pos);
+        data += cpy;
+        len -= cpy;
+    }
+
+    if (len > 0) {
+        /* count it first, so the consumer can't take it out before it's been added. */
+        SDL_AtomicAdd(&ring->overflow, (int)len);
+        SDL_AtomicAdd(&ring->queued, (int)len);
+        retval = WriteToDataQueueLocked(queue, data, len);
+        if (retval < 0) {
+            SDL_AtomicAdd(&ring->queued, -(int)len);
+            SDL_AtomicAdd(&ring->overflow, -(int)len);
+        }
+    }
+    return retval;
+}
+
+/* Consumer side of a lock-free queue, for just the ring. If buf is NULL the
+   data is thrown away, and if consume is SDL_FALSE it's only peeked at. */
+static size_t ReadFromDataQueueRing(SDL_DataQueue *queue, Uint8 *buf, const size_t _len, SDL_bool consume)
+{
+    SDL_DataQueueRing *ring = queue->ring;
+    const size_t packet_size = queue->packet_size;
+    Uint32 head = (Uint32)SDL_AtomicGet(&ring->head);
+    size_t read_pos = ring->read_pos;
+    size_t len = _len;
+    size_t total = 0;
+
+    while (len > 0) {
+        const Uint32 slot = head % SDL_DATAQUEUE_RING_SLOTS;
+        size_t avail, cpy;
+
+        if (head == (Uint32)SDL_AtomicGet(&ring->tail)) {
+            break;
+        }
+
+        avail = (size_t)SDL_AtomicGet(&ring->filled[slot]) - read_pos;
+        if (avail == 0) {
+            break; /* the producer hasn't written more yet. */
+        }
+
+        cpy = SDL_min(len, avail);
+        if (buf) {
+            SDL_memcpy(buf + total, ring->slots[slot]->data + read_pos, cpy);
+        }
+        read_pos += cpy;
+        total += cpy;
+        len -= cpy;
+
+        if (read_pos == packet_size) { /* slot is done, hand it back to the producer. */
+            head++;
+            read_pos = 0;
+            if (consume) {
+                SDL_AtomicSet(&ring->head, (int)head);
+            }
+        }
+    }
+
+    if (consume) {
+        ring->read_pos = read_pos;
+        SDL_AtomicAdd(&ring->queued, -(int)total);
+    }
+    return total;
+}
+
+/* Consumer side of a lock-free queue, including the locked list. */
+static size_t ReadFromDataQueueLockFree(SDL_DataQueue *queue, Uint8 *buf, const size_t len, SDL_bool consume)
+{
+    SDL_DataQueueRing *ring = queue->ring;
+    size_t total = 0;
+
+    while (total < len) {
+        /* the producer only uses the locked list when the ring is full, so
+           once we see data there, everything written to the ring before it
+           is visible too and has to be read first. */
+        const int overflow = SDL_AtomicGet(&ring->overflow);
+        size_t amount;
+
+        total += ReadFromDataQueueRing(queue, buf ? buf + total : NULL, len - total, consume);
+        if (total == len || overflow <= 0) {
+            break;
+        }
+
+        if (consume) {
+            amount = ReadFromDataQueueInternal(queue, buf ? buf + total : NULL, len - total);
+            SDL_AtomicAdd(&ring->overflow, -(int)amount);
+            SDL_AtomicAdd(&ring->queued, -(int)amount);
+        } else {
+            amount = PeekIntoDataQueueLocked(queue, buf + total, len - total);
+            total += amount;
+            break; /* the ring isn't consumed, so we can't go around again. */
+        }
+        total += amount;
+        if (amount == 0) {
+            break;
+        }
+    }
+
+    return total;
+}
+
+int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *data, const size_t len)
+{
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    if (queue->ring) {
+        return WriteToDataQueueRing(queue, (const Uint8 *)data, len);
+    }
+    return WriteToDataQueueLocked(queue, data, len);
+}
+
+size_t
+SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *buf, const size_t len)
+{
+    if (queue && queue->ring) {
+        return ReadFromDataQueueLockFree(queue, (Uint8 *)buf, len, SDL_FALSE);
+    }
+    return PeekIntoDataQueueLocked(queue, buf, len);
+}
+
+size_t
+SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *buf, const size_t len)
+{
+    if (!buf) {
+        return 0;
+    }
+    if (queue && queue->ring) {
+        return ReadFromDataQueueLockFree(queue, (Uint8 *)buf, len, SDL_TRUE);
+    }
+    return ReadFromDataQueueInternal(queue, (Uint8 *)buf, len);
+}
+
+size_t
+SDL_DiscardFromDataQueue(SDL_DataQueue *queue, const size_t len)
+{
+    if (queue && queue->ring) {
+        return ReadFromDataQueueLockFree(queue, NULL, len, SDL_TRUE);
+    }
+    return ReadFromDataQueueInternal(queue, NULL, len);
+}
+
+const void *SDL_PeekDataQueueHead(SDL_DataQueue *queue, size_t *len)
+{
+    const void *retval = NULL;
+
+    *len = 0;
+    if (queue && queue->ring) {
+        SDL_DataQueueRing *ring = queue->ring;
+        const int overflow = SDL_AtomicGet(&ring->overflow);
+        const Uint32 head = (Uint32)SDL_AtomicGet(&ring->head);
+        if (head != (Uint32)SDL_AtomicGet(&ring->tail)) {
+            const Uint32 slot = head % SDL_DATAQUEUE_RING_SLOTS;
+            *len = (size_t)SDL_AtomicGet(&ring->filled[slot]) - ring->read_pos;
+            if (*len) {
+                return ring->slots[slot]->data + ring->read_pos;
+            }
+        }
+        if (overflow <= 0) {
+            return NULL;
+        }
+    }
+    if (queue) {
+        SDL_LockMutex(queue->lock);
+        if (queue->head) {
+            SDL_DataQueuePacket *packet = queue->head;
+            retval = packet->data + packet->startpos;
+            *len = packet->datalen - packet->startpos;
+        }
+        SDL_UnlockMutex(queue->lock);
+    }
+    return retval;
+}
+
+void *SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
+{
+    SDL_DataQueuePacket *packet;
+
+    if (!queue) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    }
+    if (queue->ring) {
+        SDL_Unsupported();
+        return NULL;
+    }
+
+    SDL_LockMutex(queue->lock);
+
+    if (queue->reserved) {
+        SDL_UnlockMutex(queue->lock);
+        SDL_SetError("Data queue already has space reserved");
+        return NULL;
+    }
+
+    /* use the end of the tail packet if it's big enough, otherwise start a
+       new one that isn't linked in until there's something in it. */
+    packet = queue->tail;
+    if (packet && (packet->capacity - packet->datalen) >= len) {
+        queue->reserved_detached = SDL_FALSE;
+    } else {
+        packet = TakeDataQueuePacket(queue, len);
+        if (!packet) {
+            SDL_UnlockMutex(queue->lock);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        queue->reserved_detached = SDL_TRUE;
+    }
+    queue->reserved = packet;
+
+    SDL_UnlockMutex(queue->lock);
+
+    return packet->data + packet->datalen;
+}
+
+void SDL_CommitSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
+{
+    SDL_DataQueuePacket *packet;
+
+    if (!queue) {
+        return;
+    }
+
+    SDL_LockMutex(queue->lock);
+
+    packet = queue->reserved;
+    if (packet) {
+        SDL_assert(len <= (packet->capacity - packet->datalen));
+        packet->datalen += len;
+        queue->queued_bytes += len;
+
+        if (queue->reserved_detached) {
+            if (packet->startpos == packet->datalen) {
+                /* nothing new, so it goes back to the pool. */
+                if (packet->capacity > queue->packet_size) {
+                    SDL_free(packet);
+                } else {
+                    packet->next = queue->pool;
+                    queue->pool = packet;
+                }
+            } else {
+                if (!queue->tail) {
+                    queue->head = packet;
+                } else {
+                    queue->tail->next = packet;
+                }
+                queue->tail = packet;
+            }
+        }
+
+        queue->reserved = NULL;
+        queue->reserved_detached = SDL_FALSE;
+    }
+
+    SDL_UnlockMutex(queue->lock);
 }
 
 size_t
 SDL_CountDataQueue(SDL_DataQueue *queue)
 {
     size_t retval = 0;
-    if (queue) {
+    if (queue && queue->ring) {
+        /* never let a counter that got out of step turn into a huge size_t. */
+        retval = (size_t)SDL_max(SDL_AtomicGet(&queue->ring->queued), 0);
+    } else if (queue) {
         SDL_LockMutex(queue->lock);
         retval = queue->queued_bytes;
         SDL_UnlockMutex(queue->lock);
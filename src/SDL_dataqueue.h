@@ -27,12 +27,31 @@ struct SDL_DataQueue;
 typedef struct SDL_DataQueue SDL_DataQueue;
 
 SDL_DataQueue *SDL_NewDataQueue(const size_t packetlen, const size_t initialslack);
+
+/* A queue that doesn't take a lock for writing, reading or counting, as long
+   as there's only ever one thread writing and one thread reading. Clearing it
+   still needs both sides stopped, and reserving space isn't supported. If it
+   runs out of memory, a write might be partially queued. */
+SDL_DataQueue *SDL_NewLockFreeDataQueue(const size_t packetlen, const size_t initialslack);
 void SDL_FreeDataQueue(SDL_DataQueue *queue);
 void SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack);
 int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *data, const size_t len);
 size_t SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *buf, const size_t len);
 size_t SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *buf, const size_t len);
+size_t SDL_DiscardFromDataQueue(SDL_DataQueue *queue, const size_t len);
 size_t SDL_CountDataQueue(SDL_DataQueue *queue);
+
+/* Returns the unread data at the front of the queue, which might be less than
+   SDL_CountDataQueue() if it spans packets. It stays valid until it's read,
+   discarded or the queue is cleared. */
+const void *SDL_PeekDataQueueHead(SDL_DataQueue *queue, size_t *len);
+
+/* Returns len contiguous bytes at the end of the queue to write into. The
+   data isn't part of the queue until it's committed, and nothing else can be
+   written to the queue until then. Commit 0 bytes to cancel. */
+void *SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len);
+void SDL_CommitSpaceInDataQueue(SDL_DataQueue *queue, const size_t len);
+
 SDL_mutex *SDL_GetDataQueueMutex(SDL_DataQueue *queue);  /* don't destroy this, obviously. */
 
 #endif /* SDL_dataqueue_h_ */
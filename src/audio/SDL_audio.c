@@ -567,7 +567,8 @@ static void SDLCALL SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream,
     len -= (int)dequeued;
 
     if (len > 0) { /* fill any remaining space in the stream with silence. */
-        SDL_assert(SDL_CountDataQueue(device->buffer_queue) == 0);
+        /* a lock-free queue might have been written to since we read it. */
+        SDL_assert(device->buffer_queue_lockfree || SDL_CountDataQueue(device->buffer_queue) == 0);
         SDL_memset(stream, device->callbackspec.silence, len);
     }
 }
@@ -601,9 +602,13 @@ int SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
     }
 
     if (len > 0) {
-        current_audio.impl.LockDevice(device);
-        rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
-        current_audio.impl.UnlockDevice(device);
+        if (device->buffer_queue_lockfree) {
+            rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
+        } else {
+            current_audio.impl.LockDevice(device);
+            rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
+            current_audio.impl.UnlockDevice(device);
+        }
     }
 
     return rc;
@@ -621,6 +626,10 @@ Uint32 SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
         return 0;                                                         /* just report zero bytes dequeued. */
     }
 
+    if (device->buffer_queue_lockfree) {
+        return (Uint32)SDL_ReadFromDataQueue(device->buffer_queue, data, len);
+    }
+
     current_audio.impl.LockDevice(device);
     rc = (Uint32)SDL_ReadFromDataQueue(device->buffer_queue, data, len);
     current_audio.impl.UnlockDevice(device);
@@ -639,9 +648,13 @@ Uint32 SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
     /* Nothing to do unless we're set up for queueing. */
     if (device->callbackspec.callback == SDL_BufferQueueDrainCallback ||
         device->callbackspec.callback == SDL_BufferQueueFillCallback) {
-        current_audio.impl.LockDevice(device);
-        retval = (Uint32)SDL_CountDataQueue(device->buffer_queue);
-        current_audio.impl.UnlockDevice(device);
+        if (device->buffer_queue_lockfree) {
+            retval = (Uint32)SDL_CountDataQueue(device->buffer_queue);
+        } else {
+            current_audio.impl.LockDevice(device);
+            retval = (Uint32)SDL_CountDataQueue(device->buffer_queue);
+            current_audio.impl.UnlockDevice(device);
+        }
     }
 
     return retval;
@@ -1494,7 +1507,12 @@ static SDL_AudioDeviceID open_audio_device(const char *devname, int iscapture,
 
     if (device->spec.callback == NULL) { /* use buffer queueing? */
         /* pool a few packets to start. Enough for two callbacks. */
-        device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
+        device->buffer_queue_lockfree = SDL_GetHintBoolean(SDL_HINT_AUDIO_QUEUE_LOCKFREE, SDL_FALSE);
+        if (device->buffer_queue_lockfree) {
+            device->buffer_queue = SDL_NewLockFreeDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
+        } else {
+            device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
+        }
         if (!device->buffer_queue) {
             close_audio_device(device);
             SDL_SetError("Couldn't create audio buffer queue");
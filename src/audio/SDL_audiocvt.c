@@ -196,8 +196,253 @@ static Sint32 ResamplerPadding(const Sint32 inrate, const Sint32 outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
+/* Every output frame reads the 12 input frames from srcindex-5 up to
+   srcindex+6. Only srcindex-5 to srcindex+5 have nonzero coefficients, the
+   last tap is always zero and only there to keep the inner products a
+   multiple of four wide. */
+#define RESAMPLER_TAPS         12
+#define RESAMPLER_LEFT_TAPS    6
+#define RESAMPLER_MAX_PHASES   1024
+#define RESAMPLER_MAX_CHANNELS 8
+
+typedef void (*SDL_ResampleFrameFunc)(const float *coefs, const float *src, const int chans, float *dst);
+
+/* After reducing the rates by their gcd, the filter coefficients repeat every
+   (outrate / gcd) output frames, so we compute them once per phase instead of
+   once per output sample. */
+typedef struct SDL_ResamplerTable
+{
+    int phases;   /* output frames per period, (outrate / gcd) */
+    int step;     /* input frames per period, (inrate / gcd) */
+    int *offsets; /* per phase, srcindex relative to the start of the period. */
+    float *coefs; /* per phase, RESAMPLER_TAPS coefficients, first tap is srcindex-5, last is srcindex+6. */
+    SDL_ResampleFrameFunc resample_frame;
+} SDL_ResamplerTable;
+
+static void SDL_ResampleFrame_Scalar(const float *coefs, const float *src, const int chans, float *dst)
+{
+    int i, chan;
+
+    for (chan = 0; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < RESAMPLER_TAPS; i++) {
+            outsample += src[(i * chans) + chan] * coefs[i];
+        }
+        dst[chan] = outsample;
+    }
+}
+
+#ifdef HAVE_SSE_INTRINSICS
+static void SDL_ResampleFrame_SSE(const float *coefs, const float *src, const int chans, float *dst)
+{
+    const __m128 c0 = _mm_load_ps(coefs);
+    const __m128 c1 = _mm_load_ps(coefs + 4);
+    const __m128 c2 = _mm_load_ps(coefs + 8);
+
+    if (chans == 1) {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(src), c0);
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 4), c1));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 8), c2));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(dst, sum);
+    } else if (chans == 2) {
+        /* duplicate each coefficient so it lines up with a left/right pair. */
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(src), _mm_unpacklo_ps(c0, c0));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 4), _mm_unpackhi_ps(c0, c0)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 8), _mm_unpacklo_ps(c1, c1)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 12), _mm_unpackhi_ps(c1, c1)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 16), _mm_unpacklo_ps(c2, c2)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + 20), _mm_unpackhi_ps(c2, c2)));
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        _mm_storel_pi((__m64 *)dst, sum);
+    } else if ((chans % 4) == 0) {
+        int i, chan;
+        for (chan = 0; chan < chans; chan += 4) {
+            __m128 sum = _mm_setzero_ps();
+            for (i = 0; i < RESAMPLER_TAPS; i++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (i * chans) + chan), _mm_set1_ps(coefs[i])));
+            }
+            _mm_storeu_ps(dst + chan, sum);
+        }
+    } else {
+        SDL_ResampleFrame_Scalar(coefs, src, chans, dst);
+    }
+}
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+static void SDL_ResampleFrame_NEON(const float *coefs, const float *src, const int chans, float *dst)
+{
+    const float32x4_t c0 = vld1q_f32(coefs);
+    const float32x4_t c1 = vld1q_f32(coefs + 4);
+    const float32x4_t c2 = vld1q_f32(coefs + 8);
+
+    if (chans == 1) {
+        float32x4_t sum = vmulq_f32(vld1q_f32(src), c0);
+        float32x2_t half;
+        sum = vmlaq_f32(sum, vld1q_f32(src + 4), c1);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 8), c2);
+        half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+        half = vpadd_f32(half, half);
+        vst1_lane_f32(dst, half, 0);
+    } else if (chans == 2) {
+        /* duplicate each coefficient so it lines up with a left/right pair. */
+        const float32x4x2_t d0 = vzipq_f32(c0, c0);
+        const float32x4x2_t d1 = vzipq_f32(c1, c1);
+        const float32x4x2_t d2 = vzipq_f32(c2, c2);
+        float32x4_t sum = vmulq_f32(vld1q_f32(src), d0.val[0]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 4), d0.val[1]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 8), d1.val[0]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 12), d1.val[1]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 16), d2.val[0]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + 20), d2.val[1]);
+        vst1_f32(dst, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+    } else if ((chans % 4) == 0) {
+        int i, chan;
+        for (chan = 0; chan < chans; chan += 4) {
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (i = 0; i < RESAMPLER_TAPS; i++) {
+                sum = vmlaq_n_f32(sum, vld1q_f32(src + (i * chans) + chan), coefs[i]);
+            }
+            vst1q_f32(dst + chan, sum);
+        }
+    } else {
+        SDL_ResampleFrame_Scalar(coefs, src, chans, dst);
+    }
+}
+#endif
+
+static void SDL_DestroyResamplerTable(SDL_ResamplerTable *table)
+{
+    if (table) {
+        SDL_free(table->offsets);
+        SDL_SIMDFree(table->coefs);
+        SDL_free(table);
+    }
+}
+
+/* Returns NULL if the rates don't reduce to a reasonable number of phases (or we're out of memory),
+   in which case SDL_ResampleAudio() computes the filter for every output frame instead. */
+static SDL_ResamplerTable *SDL_CreateResamplerTable(const int inrate, const int outrate)
+{
+    SDL_ResamplerTable *table;
+    int gcd = outrate, rem = inrate;
+    int phase, j;
+
+    if (inrate <= 0 || outrate <= 0 || inrate == outrate) {
+        return NULL;
+    }
+
+    while (rem) {
+        const int tmp = gcd % rem;
+        gcd = rem;
+        rem = tmp;
+    }
+
+    if ((outrate / gcd) > RESAMPLER_MAX_PHASES) {
+        return NULL;
+    }
+
+    table = (SDL_ResamplerTable *)SDL_calloc(1, sizeof(SDL_ResamplerTable));
+    if (!table) {
+        return NULL;
+    }
+
+    table->phases = outrate / gcd;
+    table->step = inrate / gcd;
+    table->offsets = (int *)SDL_malloc(table->phases * sizeof(int));
+    table->coefs = (float *)SDL_SIMDAlloc(table->phases * RESAMPLER_TAPS * sizeof(float));
+    if (!table->offsets || !table->coefs) {
+        SDL_DestroyResamplerTable(table);
+        return NULL;
+    }
+
+    /* These are the same calculations SDL_ResampleAudio() does per output frame. */
+    for (phase = 0; phase < table->phases; phase++) {
+        float *coefs = table->coefs + (phase * RESAMPLER_TAPS);
+        const int srcfraction = (int)(((Sint64)phase * inrate) % outrate);
+        const float interpolation1 = ((float)srcfraction) / ((float)outrate);
+        const int filterindex1 = (int)((Sint64)srcfraction * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate);
+        const float interpolation2 = 1.0f - interpolation1;
+        const int filterindex2 = (int)((Sint64)(outrate - srcfraction) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate);
+
+        table->offsets[phase] = (int)((Sint64)phase * inrate / outrate);
+        SDL_memset(coefs, '\0', RESAMPLER_TAPS * sizeof(float));
+
+        for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+            const int filt_ind = filterindex1 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+            coefs[RESAMPLER_LEFT_TAPS - 1 - j] = ResamplerFilter[filt_ind] + (interpolation1 * ResamplerFilterDifference[filt_ind]);
+        }
+
+        for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+            const int filt_ind = filterindex2 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+            coefs[RESAMPLER_LEFT_TAPS + j] = ResamplerFilter[filt_ind] + (interpolation2 * ResamplerFilterDifference[filt_ind]);
+        }
+    }
+
+    table->resample_frame = SDL_ResampleFrame_Scalar;
+#ifdef HAVE_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        table->resample_frame = SDL_ResampleFrame_SSE;
+    }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        table->resample_frame = SDL_ResampleFrame_NEON;
+    }
+#endif
+
+    return table;
+}
+
+static void SDL_ResampleAudioPolyphase(const SDL_ResamplerTable *table, const int chans, const int paddinglen,
+                                       const float *lpadding, const float *rpadding,
+                                       const float *inbuf, const int inframes,
+                                       float *dst, const int outframes)
+{
+    const SDL_ResampleFrameFunc resample_frame = table->resample_frame;
+    float window[RESAMPLER_TAPS * RESAMPLER_MAX_CHANNELS];
+    int srcbase = 0;
+    int phase = 0;
+    int i, j;
+
+    SDL_assert(chans <= RESAMPLER_MAX_CHANNELS);
+
+    for (i = 0; i < outframes; i++) {
+        const int srcstart = srcbase + table->offsets[phase] - (RESAMPLER_LEFT_TAPS - 1);
+        const float *coefs = table->coefs + (phase * RESAMPLER_TAPS);
+
+        if (srcstart >= 0 && (srcstart + RESAMPLER_TAPS) <= inframes) {
+            resample_frame(coefs, inbuf + (srcstart * chans), chans, dst);
+        } else {
+            /* near the edges, gather the frames from the padding first. */
+            for (j = 0; j < RESAMPLER_TAPS; j++) {
+                const int srcframe = srcstart + j;
+                const float *src;
+                if (srcframe < 0) {
+                    src = lpadding + ((paddinglen + srcframe) * chans);
+                } else if (srcframe >= inframes) {
+                    src = rpadding + ((srcframe - inframes) * chans);
+                } else {
+                    src = inbuf + (srcframe * chans);
+                }
+                SDL_memcpy(window + (j * chans), src, chans * sizeof(float));
+            }
+            resample_frame(coefs, window, chans, dst);
+        }
+
+        dst += chans;
+        if (++phase == table->phases) {
+            phase = 0;
+            srcbase += table->step;
+        }
+    }
+}
+
 /* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof(float)) bytes. */
 static int SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+                             const SDL_ResamplerTable *table,
                              const float *lpadding, const float *rpadding,
                              const float *inbuf, const int inbuflen,
                              float *outbuf, const int outbuflen)
@@ -218,6 +463,11 @@ static int SDL_ResampleAudio(const int chans, const int inrate, const int outrat
     float *dst = outbuf;
     int i, j, chan;
 
+    if (table && chans <= RESAMPLER_MAX_CHANNELS) {
+        SDL_ResampleAudioPolyphase(table, chans, paddinglen, lpadding, rpadding, inbuf, inframes, outbuf, outframes);
+        return outframes * chans * sizeof(float);
+    }
+
     for (i = 0; i < outframes; i++) {
         const int srcindex = (int)((Sint64)i * inrate / outrate);
         /* Calculating the following way avoids subtraction or modulo of large
@@ -509,6 +759,7 @@ static void SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioF
     const int requestedpadding = ResamplerPadding(inrate, outrate);
     int paddingsamples;
     float *padding;
+    SDL_ResamplerTable *table;
 
     if (requestedpadding < SDL_MAX_SINT32 / chans) {
         paddingsamples = requestedpadding * chans;
@@ -524,8 +775,12 @@ static void SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioF
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    /* building the table is cheap next to the conversion itself, and the cvt has nowhere to keep it. */
+    table = SDL_CreateResamplerTable(inrate, outrate);
+
+    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, table, padding, padding, src, srclen, dst, dstlen);
 
+    SDL_DestroyResamplerTable(table);
     SDL_free(padding);
 
     SDL_memmove(cvt->buf, dst, cvt->len_cvt); /* !!! FIXME: remove this if we can get the resampler to work in-place again. */
@@ -866,9 +1121,17 @@ struct _SDL_AudioStream
     int resampler_padding_samples;
     float *resampler_padding;
     void *resampler_state;
+    SDL_ResamplerTable *resampler_table;
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
     SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
+    Uint8 *put_reserved;     /* what SDL_AudioStreamReservePut() handed out, if anything. */
+    int put_reserved_len;
+    Uint8 *put_buffer;       /* for reservations that have to go through the staging buffer anyway. */
+    int put_buffer_len;
+    const Uint8 *get_reserved; /* what SDL_AudioStreamReserveGet() handed out, if anything. */
+    int get_reserved_len;
+    Uint8 get_frame[4 * 8];  /* a sample frame that spans two queue packets. */
 };
 
 static Uint8 *EnsureStreamBufferSize(SDL_AudioStream *stream, int newlen)
@@ -988,7 +1251,7 @@ static int SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf,
 
     SDL_assert(inbuf != ((const float *)outbuf)); /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    retval = SDL_ResampleAudio(chans, inrate, outrate, stream->resampler_table, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof(float)), inbufend - cpy, cpy);
@@ -1005,6 +1268,7 @@ static void SDL_ResetAudioStreamResampler(SDL_AudioStream *stream)
 static void SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
 {
     SDL_free(stream->resampler_state);
+    SDL_DestroyResamplerTable(stream->resampler_table);
 }
 
 SDL_AudioStream *SDL_NewAudioStream(const SDL_AudioFormat src_format,
@@ -1098,6 +1362,9 @@ SDL_AudioStream *SDL_NewAudioStream(const SDL_AudioFormat src_format,
                 return NULL;
             }
 
+            /* this is allowed to fail; we'll just resample the slow way. */
+            retval->resampler_table = SDL_CreateResamplerTable(src_rate, dst_rate);
+
             retval->resampler_func = SDL_ResampleAudioStream;
             retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
             retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
@@ -1119,13 +1386,56 @@ SDL_AudioStream *SDL_NewAudioStream(const SDL_AudioFormat src_format,
     return retval;
 }
 
+/* How much work buffer it takes to resample len bytes of input, including the padding we prepend. */
+static int GetStreamWorkBufferLen(SDL_AudioStream *stream, int len)
+{
+    int workbuflen = len;
+    if (stream->cvt_before_resampling.needed) {
+        workbuflen *= stream->cvt_before_resampling.len_mult;
+    }
+    return workbuflen + (stream->resampler_padding_samples * (int)sizeof(float));
+}
+
+/* Finish the conversion in the queue's own memory and commit it, so we don't copy it again. */
+static int SDL_AudioStreamCommitOutput(SDL_AudioStream *stream, Uint8 *outbuf, int buflen, int *maxputbytes)
+{
+    if (stream->cvt_after_resampling.needed && (buflen > 0)) {
+        stream->cvt_after_resampling.buf = outbuf;
+        stream->cvt_after_resampling.len = buflen;
+        if (SDL_ConvertAudio(&stream->cvt_after_resampling) == -1) {
+            SDL_CommitSpaceInDataQueue(stream->queue, 0);
+            return -1; /* uhoh! */
+        }
+        buflen = stream->cvt_after_resampling.len_cvt;
+
+#if DEBUG_AUDIOSTREAM
+        SDL_Log("AUDIOSTREAM: After final conversion we have %d bytes\n", buflen);
+#endif
+    }
+
+#if DEBUG_AUDIOSTREAM
+    SDL_Log("AUDIOSTREAM: Final output is %d bytes\n", buflen);
+#endif
+
+    if (maxputbytes) {
+        const int maxbytes = *maxputbytes;
+        if (buflen > maxbytes) {
+            buflen = maxbytes;
+        }
+        *maxputbytes -= buflen;
+    }
+
+    SDL_CommitSpaceInDataQueue(stream->queue, (size_t)buflen);
+    return 0;
+}
+
 static int SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, int *maxputbytes)
 {
     int buflen = len;
     int workbuflen;
     Uint8 *workbuf;
-    Uint8 *resamplebuf = NULL;
-    int resamplebuflen = 0;
+    Uint8 *outbuf;
+    int outbuflen;
     int neededpaddingbytes;
     int paddingbytes;
 
@@ -1137,34 +1447,30 @@ static int SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf,
        !!! FIXME:  isn't a multiple of 16. In these cases, we should chop off
        !!! FIXME:  a few samples at the end and convert them separately. */
 
+    if (stream->dst_rate == stream->src_rate) {
+        /* no resampling, so convert in place, right in the queue. */
+        outbuflen = buflen;
+        if (stream->cvt_after_resampling.needed) {
+            outbuflen *= stream->cvt_after_resampling.len_mult;
+        }
+        outbuf = (Uint8 *)SDL_ReserveSpaceInDataQueue(stream->queue, outbuflen);
+        if (!outbuf) {
+            return -1; /* probably out of memory. */
+        }
+        /* SDL_AudioStreamCommitPut() might have had the app write here directly. */
+        if (outbuf != buf) {
+            SDL_memcpy(outbuf, buf, buflen);
+        }
+        return SDL_AudioStreamCommitOutput(stream, outbuf, buflen, maxputbytes);
+    }
+
     /* no padding prepended on first run. */
     neededpaddingbytes = stream->resampler_padding_samples * sizeof(float);
     paddingbytes = stream->first_run ? 0 : neededpaddingbytes;
     stream->first_run = SDL_FALSE;
 
     /* Make sure the work buffer can hold all the data we need at once... */
-    workbuflen = buflen;
-    if (stream->cvt_before_resampling.needed) {
-        workbuflen *= stream->cvt_before_resampling.len_mult;
-    }
-
-    if (stream->dst_rate != stream->src_rate) {
-        /* resamples can't happen in place, so make space for second buf. */
-        const int framesize = stream->pre_resample_channels * sizeof(float);
-        const int frames = workbuflen / framesize;
-        resamplebuflen = ((int)SDL_ceil(frames * stream->rate_incr)) * framesize;
-#if DEBUG_AUDIOSTREAM
-        SDL_Log("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, resamplebuflen, stream->rate_incr);
-#endif
-        workbuflen += resamplebuflen;
-    }
-
-    if (stream->cvt_after_resampling.needed) {
-        /* !!! FIXME: buffer might be big enough already? */
-        workbuflen *= stream->cvt_after_resampling.len_mult;
-    }
-
-    workbuflen += neededpaddingbytes;
+    workbuflen = GetStreamWorkBufferLen(stream, buflen);
 
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: Putting %d bytes of preconverted audio, need %d byte work buffer\n", buflen, workbuflen);
@@ -1175,9 +1481,10 @@ static int SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf,
         return -1; /* probably out of memory. */
     }
 
-    resamplebuf = workbuf; /* default if not resampling. */
-
-    SDL_memcpy(workbuf + paddingbytes, buf, buflen);
+    /* SDL_AudioStreamCommitPut() might have had the app write here directly. */
+    if (workbuf + paddingbytes != buf) {
+        SDL_memcpy(workbuf + paddingbytes, buf, buflen);
+    }
 
     if (stream->cvt_before_resampling.needed) {
         stream->cvt_before_resampling.buf = workbuf + paddingbytes;
@@ -1192,60 +1499,49 @@ static int SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf,
 #endif
     }
 
-    if (stream->dst_rate != stream->src_rate) {
-        /* save off some samples at the end; they are used for padding now so
-           the resampler is coherent and then used at the start of the next
-           put operation. Prepend last put operation's padding, too. */
+    /* save off some samples at the end; they are used for padding now so
+       the resampler is coherent and then used at the start of the next
+       put operation. Prepend last put operation's padding, too. */
 
-        /* prepend prior put's padding. :P */
-        if (paddingbytes) {
-            SDL_memcpy(workbuf, stream->resampler_padding, paddingbytes);
-            buflen += paddingbytes;
-        }
-
-        /* save off the data at the end for the next run. */
-        SDL_memcpy(stream->resampler_padding, workbuf + (buflen - neededpaddingbytes), neededpaddingbytes);
+    /* prepend prior put's padding. :P */
+    if (paddingbytes) {
+        SDL_memcpy(workbuf, stream->resampler_padding, paddingbytes);
+        buflen += paddingbytes;
+    }
 
-        resamplebuf = workbuf + buflen; /* skip to second piece of workbuf. */
-        SDL_assert(buflen >= neededpaddingbytes);
-        if (buflen > neededpaddingbytes) {
-            buflen = stream->resampler_func(stream, workbuf, buflen - neededpaddingbytes, resamplebuf, resamplebuflen);
-        } else {
-            buflen = 0;
-        }
+    /* save off the data at the end for the next run. */
+    SDL_memcpy(stream->resampler_padding, workbuf + (buflen - neededpaddingbytes), neededpaddingbytes);
 
-#if DEBUG_AUDIOSTREAM
-        SDL_Log("AUDIOSTREAM: After resampling we have %d bytes\n", buflen);
-#endif
+    SDL_assert(buflen >= neededpaddingbytes);
+    if (buflen == neededpaddingbytes) {
+        return 0; /* nothing to resample yet. */
     }
 
-    if (stream->cvt_after_resampling.needed && (buflen > 0)) {
-        stream->cvt_after_resampling.buf = resamplebuf;
-        stream->cvt_after_resampling.len = buflen;
-        if (SDL_ConvertAudio(&stream->cvt_after_resampling) == -1) {
-            return -1; /* uhoh! */
+    /* resamples can't happen in place, so resample right into the queue. */
+    {
+        const int framesize = stream->pre_resample_channels * sizeof(float);
+        const int frames = (buflen - neededpaddingbytes) / framesize;
+        const int resamplebuflen = ((int)SDL_ceil(frames * stream->rate_incr)) * framesize;
+        outbuflen = resamplebuflen;
+        if (stream->cvt_after_resampling.needed) {
+            outbuflen *= stream->cvt_after_resampling.len_mult;
         }
-        buflen = stream->cvt_after_resampling.len_cvt;
-
 #if DEBUG_AUDIOSTREAM
-        SDL_Log("AUDIOSTREAM: After final conversion we have %d bytes\n", buflen);
+        SDL_Log("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", buflen - neededpaddingbytes, resamplebuflen, stream->rate_incr);
 #endif
+
+        outbuf = (Uint8 *)SDL_ReserveSpaceInDataQueue(stream->queue, outbuflen);
+        if (!outbuf) {
+            return -1; /* probably out of memory. */
+        }
+        buflen = stream->resampler_func(stream, workbuf, buflen - neededpaddingbytes, outbuf, resamplebuflen);
     }
 
 #if DEBUG_AUDIOSTREAM
-    SDL_Log("AUDIOSTREAM: Final output is %d bytes\n", buflen);
+    SDL_Log("AUDIOSTREAM: After resampling we have %d bytes\n", buflen);
 #endif
 
-    if (maxputbytes) {
-        const int maxbytes = *maxputbytes;
-        if (buflen > maxbytes) {
-            buflen = maxbytes;
-        }
-        *maxputbytes -= buflen;
-    }
-
-    /* resamplebuf holds the final output, even if we didn't resample. */
-    return buflen ? SDL_WriteToDataQueue(stream->queue, resamplebuf, buflen) : 0;
+    return SDL_AudioStreamCommitOutput(stream, outbuf, buflen, maxputbytes);
 }
 
 int SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
@@ -1274,6 +1570,9 @@ int SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
     if ((len % stream->src_sample_frame_size) != 0) {
         return SDL_SetError("Can't add partial sample frames");
     }
+    if (stream->put_reserved) {
+        return SDL_SetError("Audio stream has reserved space that hasn't been committed");
+    }
 
     if (!stream->cvt_before_resampling.needed &&
         (stream->dst_rate == stream->src_rate) &&
@@ -1320,6 +1619,9 @@ int SDL_AudioStreamFlush(SDL_AudioStream *stream)
     if (!stream) {
         return SDL_InvalidParamError("stream");
     }
+    if (stream->put_reserved) {
+        return SDL_SetError("Audio stream has reserved space that hasn't been committed");
+    }
 
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: flushing! staging_buffer_filled=%d bytes\n", stream->staging_buffer_filled);
@@ -1391,6 +1693,166 @@ int SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
     return (int)SDL_ReadFromDataQueue(stream->queue, buf, len);
 }
 
+void *SDL_AudioStreamReservePut(SDL_AudioStream *stream, int len)
+{
+    Uint8 *ptr;
+
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return NULL;
+    }
+    if (len <= 0) {
+        SDL_InvalidParamError("len");
+        return NULL;
+    }
+    if ((len % stream->src_sample_frame_size) != 0) {
+        SDL_SetError("Can't add partial sample frames");
+        return NULL;
+    }
+    if (stream->put_reserved) {
+        SDL_SetError("Audio stream has reserved space that hasn't been committed");
+        return NULL;
+    }
+
+    if (stream->dst_rate == stream->src_rate) {
+        /* the data gets converted in place, right in the queue. */
+        int outlen = len;
+        if (stream->cvt_after_resampling.needed) {
+            outlen *= stream->cvt_after_resampling.len_mult;
+        }
+        ptr = (Uint8 *)SDL_ReserveSpaceInDataQueue(stream->queue, outlen);
+    } else if (!stream->staging_buffer_filled && len >= stream->staging_buffer_size) {
+        /* this is where SDL_AudioStreamPutInternal() would copy it to. */
+        const int paddingbytes = stream->first_run ? 0 : (stream->resampler_padding_samples * (int)sizeof(float));
+        ptr = EnsureStreamBufferSize(stream, GetStreamWorkBufferLen(stream, len));
+        if (ptr) {
+            ptr += paddingbytes;
+        }
+    } else {
+        /* it's going through the staging buffer, so it has to be copied once anyhow. */
+        if (stream->put_buffer_len < len) {
+            ptr = (Uint8 *)SDL_realloc(stream->put_buffer, len);
+            if (!ptr) {
+                SDL_OutOfMemory();
+                return NULL;
+            }
+            stream->put_buffer = ptr;
+            stream->put_buffer_len = len;
+        }
+        ptr = stream->put_buffer;
+    }
+
+    if (ptr) {
+        stream->put_reserved = ptr;
+        stream->put_reserved_len = len;
+    }
+    return ptr;
+}
+
+int SDL_AudioStreamCommitPut(SDL_AudioStream *stream, int len)
+{
+    Uint8 *ptr;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (!stream->put_reserved) {
+        return SDL_SetError("Audio stream has no reserved space to commit");
+    }
+    if (len < 0 || len > stream->put_reserved_len) {
+        return SDL_InvalidParamError("len");
+    }
+    if ((len % stream->src_sample_frame_size) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    ptr = stream->put_reserved;
+    stream->put_reserved = NULL;
+    stream->put_reserved_len = 0;
+
+    if (stream->dst_rate == stream->src_rate) {
+        if (!len) {
+            SDL_CommitSpaceInDataQueue(stream->queue, 0);
+            return 0;
+        }
+        return SDL_AudioStreamCommitOutput(stream, ptr, len, NULL);
+    } else if (!len) {
+        return 0;
+    } else if (ptr == stream->put_buffer) {
+        return SDL_AudioStreamPut(stream, ptr, len);
+    }
+
+    /* a shorter commit can still go through the staging buffer, and
+       SDL_AudioStreamPut() would copy the rest back into the work buffer. */
+    if (len < stream->staging_buffer_size) {
+        SDL_memcpy(stream->staging_buffer, ptr, len);
+        stream->staging_buffer_filled = len;
+        return 0;
+    }
+    return SDL_AudioStreamPutInternal(stream, ptr, len, NULL);
+}
+
+const void *SDL_AudioStreamReserveGet(SDL_AudioStream *stream, int *len)
+{
+    const void *ptr;
+    size_t avail = 0;
+    int wanted;
+
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return NULL;
+    }
+    if (!len || *len <= 0) {
+        SDL_InvalidParamError("len");
+        return NULL;
+    }
+    if ((*len % stream->dst_sample_frame_size) != 0) {
+        SDL_SetError("Can't request partial sample frames");
+        return NULL;
+    }
+
+    wanted = *len;
+    *len = 0;
+
+    ptr = SDL_PeekDataQueueHead(stream->queue, &avail);
+    avail = SDL_min(avail, (size_t)wanted);
+    avail -= avail % stream->dst_sample_frame_size;
+    if (!avail && SDL_CountDataQueue(stream->queue) >= (size_t)stream->dst_sample_frame_size) {
+        /* the next frame is split across two packets, so hand out a copy of it. */
+        SDL_assert(stream->dst_sample_frame_size <= (int)sizeof(stream->get_frame));
+        avail = SDL_PeekIntoDataQueue(stream->queue, stream->get_frame, stream->dst_sample_frame_size);
+        ptr = stream->get_frame;
+    }
+    if (!avail) {
+        return NULL; /* nothing to get right now. */
+    }
+
+    stream->get_reserved = (const Uint8 *)ptr;
+    stream->get_reserved_len = (int)avail;
+    *len = (int)avail;
+    return ptr;
+}
+
+int SDL_AudioStreamCommitGet(SDL_AudioStream *stream, int len)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (!stream->get_reserved) {
+        return SDL_SetError("Audio stream has no reserved data to commit");
+    }
+    if (len < 0 || len > stream->get_reserved_len) {
+        return SDL_InvalidParamError("len");
+    }
+    if ((len % stream->dst_sample_frame_size) != 0) {
+        return SDL_SetError("Can't request partial sample frames");
+    }
+
+    stream->get_reserved = NULL;
+    stream->get_reserved_len = 0;
+    return (int)SDL_DiscardFromDataQueue(stream->queue, len);
+}
+
 /* number of converted/resampled bytes available */
 int SDL_AudioStreamAvailable(SDL_AudioStream *stream)
 {
@@ -1402,6 +1864,11 @@ void SDL_AudioStreamClear(SDL_AudioStream *stream)
     if (!stream) {
         SDL_InvalidParamError("stream");
     } else {
+        if (stream->put_reserved) {
+            SDL_AudioStreamCommitPut(stream, 0);
+        }
+        stream->get_reserved = NULL;
+        stream->get_reserved_len = 0;
         SDL_ClearDataQueue(stream->queue, (size_t)stream->packetlen * 2);
         if (stream->reset_resampler_func) {
             stream->reset_resampler_func(stream);
@@ -1421,6 +1888,7 @@ void SDL_FreeAudioStream(SDL_AudioStream *stream)
         SDL_FreeDataQueue(stream->queue);
         SDL_free(stream->staging_buffer);
         SDL_free(stream->work_buffer_base);
+        SDL_free(stream->put_buffer);
         SDL_free(stream->resampler_padding);
         SDL_free(stream);
     }
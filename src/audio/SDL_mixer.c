@@ -27,6 +27,14 @@
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
 
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS
+#endif
+
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
  */
@@ -85,6 +93,266 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s - 128) * v) / SDL_MIX_MAXVOLUME) + 128)
 #define ADJUST_VOLUME_U16(s, v) (s = (((s - 32768) * v) / SDL_MIX_MAXVOLUME) + 32768)
 
+/* Mixers for native byte order samples, set to a CPU-specific implementation. */
+typedef void (*SDL_MixS16Func)(Sint16 *dst, const Sint16 *src, Uint32 num_samples, int volume);
+typedef void (*SDL_MixS32Func)(Sint32 *dst, const Sint32 *src, Uint32 num_samples, int volume);
+typedef void (*SDL_MixF32Func)(float *dst, const float *src, Uint32 num_samples, int volume);
+
+static SDL_MixS16Func SDL_Mix_S16 = NULL;
+static SDL_MixS32Func SDL_Mix_S32 = NULL;
+static SDL_MixF32Func SDL_Mix_F32 = NULL;
+
+/* The SIMD mixers produce exactly the same samples as these, and use them for leftover samples. */
+static void SDL_Mix_S16_Scalar(Sint16 *dst, const Sint16 *src, Uint32 num_samples, int volume)
+{
+    Sint16 src1;
+    int dst_sample;
+    const int max_audioval = SDL_MAX_SINT16;
+    const int min_audioval = SDL_MIN_SINT16;
+
+    while (num_samples--) {
+        src1 = *(src++);
+        ADJUST_VOLUME(src1, volume);
+        dst_sample = src1 + *dst;
+        if (dst_sample > max_audioval) {
+            dst_sample = max_audioval;
+        } else if (dst_sample < min_audioval) {
+            dst_sample = min_audioval;
+        }
+        *(dst++) = dst_sample;
+    }
+}
+
+static void SDL_Mix_S32_Scalar(Sint32 *dst, const Sint32 *src, Uint32 num_samples, int volume)
+{
+    Sint64 src1;
+    Sint64 dst_sample;
+    const Sint64 max_audioval = SDL_MAX_SINT32;
+    const Sint64 min_audioval = SDL_MIN_SINT32;
+
+    while (num_samples--) {
+        src1 = (Sint64)*(src++);
+        ADJUST_VOLUME(src1, volume);
+        dst_sample = src1 + *dst;
+        if (dst_sample > max_audioval) {
+            dst_sample = max_audioval;
+        } else if (dst_sample < min_audioval) {
+            dst_sample = min_audioval;
+        }
+        *(dst++) = (Sint32)dst_sample;
+    }
+}
+
+static void SDL_Mix_F32_Scalar(float *dst, const float *src, Uint32 num_samples, int volume)
+{
+    const float fmaxvolume = 1.0f / ((float)SDL_MIX_MAXVOLUME);
+    const float fvolume = (float)volume;
+    float src1;
+    double dst_sample;
+    /* !!! FIXME: are these right? */
+    const double max_audioval = 3.402823466e+38F;
+    const double min_audioval = -3.402823466e+38F;
+
+    while (num_samples--) {
+        src1 = ((*(src++) * fvolume) * fmaxvolume);
+        dst_sample = ((double)src1) + ((double)*dst);
+        if (dst_sample > max_audioval) {
+            dst_sample = max_audioval;
+        } else if (dst_sample < min_audioval) {
+            dst_sample = min_audioval;
+        }
+        *(dst++) = (float)dst_sample;
+    }
+}
+
+#ifdef HAVE_SSE2_INTRINSICS
+static void SDL_Mix_S16_SSE2(Sint16 *dst, const Sint16 *src, Uint32 num_samples, int volume)
+{
+    if (volume == SDL_MIX_MAXVOLUME) {
+        for (; num_samples >= 8; num_samples -= 8, src += 8, dst += 8) {
+            const __m128i s = _mm_loadu_si128((const __m128i *)src);
+            const __m128i d = _mm_loadu_si128((const __m128i *)dst);
+            _mm_storeu_si128((__m128i *)dst, _mm_adds_epi16(d, s));
+        }
+    } else if (volume > 0 && volume < SDL_MIX_MAXVOLUME) {
+        const __m128i vol = _mm_set1_epi16((short)volume);
+        const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+
+        for (; num_samples >= 8; num_samples -= 8, src += 8, dst += 8) {
+            const __m128i s = _mm_loadu_si128((const __m128i *)src);
+            const __m128i d = _mm_loadu_si128((const __m128i *)dst);
+            const __m128i lo = _mm_mullo_epi16(s, vol);
+            const __m128i hi = _mm_mulhi_epi16(s, vol);
+            __m128i p0 = _mm_unpacklo_epi16(lo, hi);
+            __m128i p1 = _mm_unpackhi_epi16(lo, hi);
+
+            /* Divide by SDL_MIX_MAXVOLUME rounding towards zero, like the scalar division does */
+            p0 = _mm_srai_epi32(_mm_add_epi32(p0, _mm_and_si128(_mm_srai_epi32(p0, 31), bias)), 7);
+            p1 = _mm_srai_epi32(_mm_add_epi32(p1, _mm_and_si128(_mm_srai_epi32(p1, 31), bias)), 7);
+
+            _mm_storeu_si128((__m128i *)dst, _mm_adds_epi16(d, _mm_packs_epi32(p0, p1)));
+        }
+    }
+
+    SDL_Mix_S16_Scalar(dst, src, num_samples, volume);
+}
+
+static void SDL_Mix_S32_SSE2(Sint32 *dst, const Sint32 *src, Uint32 num_samples, int volume)
+{
+    if (volume > 0 && volume <= SDL_MIX_MAXVOLUME) {
+        /* Doubles hold every intermediate value exactly, so this matches the 64-bit integer math */
+        const __m128d vol = _mm_set1_pd((double)volume / SDL_MIX_MAXVOLUME);
+        const __m128d max_audioval = _mm_set1_pd((double)SDL_MAX_SINT32);
+        const __m128d min_audioval = _mm_set1_pd((double)SDL_MIN_SINT32);
+
+        for (; num_samples >= 4; num_samples -= 4, src += 4, dst += 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *)src);
+            const __m128i d = _mm_loadu_si128((const __m128i *)dst);
+            const __m128i s_hi = _mm_unpackhi_epi64(s, s);
+            const __m128i d_hi = _mm_unpackhi_epi64(d, d);
+            __m128d lo, hi;
+
+            lo = _mm_cvtepi32_pd(_mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(s), vol)));
+            hi = _mm_cvtepi32_pd(_mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(s_hi), vol)));
+            lo = _mm_add_pd(lo, _mm_cvtepi32_pd(d));
+            hi = _mm_add_pd(hi, _mm_cvtepi32_pd(d_hi));
+            lo = _mm_max_pd(_mm_min_pd(lo, max_audioval), min_audioval);
+            hi = _mm_max_pd(_mm_min_pd(hi, max_audioval), min_audioval);
+
+            _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi)));
+        }
+    }
+
+    SDL_Mix_S32_Scalar(dst, src, num_samples, volume);
+}
+
+static void SDL_Mix_F32_SSE2(float *dst, const float *src, Uint32 num_samples, int volume)
+{
+    const __m128 fvolume = _mm_set1_ps((float)volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float)SDL_MIX_MAXVOLUME));
+    const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+
+    /* Adding two floats in double precision and rounding back gives the same result as adding in single precision */
+    for (; num_samples >= 4; num_samples -= 4, src += 4, dst += 4) {
+        const __m128 s = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src), fvolume), fmaxvolume);
+        __m128 d = _mm_add_ps(_mm_loadu_ps(dst), s);
+
+        /* Overflow to infinity gets clamped like the scalar code, NaN passes through */
+        d = _mm_min_ps(max_audioval, d);
+        d = _mm_max_ps(min_audioval, d);
+        _mm_storeu_ps(dst, d);
+    }
+
+    SDL_Mix_F32_Scalar(dst, src, num_samples, volume);
+}
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+static void SDL_Mix_S16_NEON(Sint16 *dst, const Sint16 *src, Uint32 num_samples, int volume)
+{
+    if (volume == SDL_MIX_MAXVOLUME) {
+        for (; num_samples >= 8; num_samples -= 8, src += 8, dst += 8) {
+            vst1q_s16(dst, vqaddq_s16(vld1q_s16(dst), vld1q_s16(src)));
+        }
+    } else if (volume > 0 && volume < SDL_MIX_MAXVOLUME) {
+        const int16x4_t vol = vdup_n_s16((int16_t)volume);
+        const int32x4_t bias = vdupq_n_s32(SDL_MIX_MAXVOLUME - 1);
+
+        for (; num_samples >= 8; num_samples -= 8, src += 8, dst += 8) {
+            const int16x8_t s = vld1q_s16(src);
+            int32x4_t p0 = vmull_s16(vget_low_s16(s), vol);
+            int32x4_t p1 = vmull_s16(vget_high_s16(s), vol);
+
+            /* Divide by SDL_MIX_MAXVOLUME rounding towards zero, like the scalar division does */
+            p0 = vshrq_n_s32(vaddq_s32(p0, vandq_s32(vshrq_n_s32(p0, 31), bias)), 7);
+            p1 = vshrq_n_s32(vaddq_s32(p1, vandq_s32(vshrq_n_s32(p1, 31), bias)), 7);
+
+            vst1q_s16(dst, vqaddq_s16(vld1q_s16(dst), vcombine_s16(vmovn_s32(p0), vmovn_s32(p1))));
+        }
+    }
+
+    SDL_Mix_S16_Scalar(dst, src, num_samples, volume);
+}
+
+static void SDL_Mix_S32_NEON(Sint32 *dst, const Sint32 *src, Uint32 num_samples, int volume)
+{
+    if (volume > 0 && volume <= SDL_MIX_MAXVOLUME) {
+        const int32x2_t vol = vdup_n_s32(volume);
+        const int64x2_t bias = vdupq_n_s64(SDL_MIX_MAXVOLUME - 1);
+
+        for (; num_samples >= 4; num_samples -= 4, src += 4, dst += 4) {
+            const int32x4_t s = vld1q_s32(src);
+            const int32x4_t d = vld1q_s32(dst);
+            int64x2_t p0 = vmull_s32(vget_low_s32(s), vol);
+            int64x2_t p1 = vmull_s32(vget_high_s32(s), vol);
+
+            p0 = vshrq_n_s64(vaddq_s64(p0, vandq_s64(vshrq_n_s64(p0, 63), bias)), 7);
+            p1 = vshrq_n_s64(vaddq_s64(p1, vandq_s64(vshrq_n_s64(p1, 63), bias)), 7);
+            p0 = vaddq_s64(p0, vmovl_s32(vget_low_s32(d)));
+            p1 = vaddq_s64(p1, vmovl_s32(vget_high_s32(d)));
+
+            vst1q_s32(dst, vcombine_s32(vqmovn_s64(p0), vqmovn_s64(p1)));
+        }
+    }
+
+    SDL_Mix_S32_Scalar(dst, src, num_samples, volume);
+}
+
+#ifdef __aarch64__ /* 32-bit NEON flushes denormals to zero, which the scalar code doesn't */
+static void SDL_Mix_F32_NEON(float *dst, const float *src, Uint32 num_samples, int volume)
+{
+    const float32x4_t fvolume = vdupq_n_f32((float)volume);
+    const float32x4_t fmaxvolume = vdupq_n_f32(1.0f / ((float)SDL_MIX_MAXVOLUME));
+    const float32x4_t max_audioval = vdupq_n_f32(3.402823466e+38F);
+    const float32x4_t min_audioval = vdupq_n_f32(-3.402823466e+38F);
+
+    for (; num_samples >= 4; num_samples -= 4, src += 4, dst += 4) {
+        const float32x4_t s = vmulq_f32(vmulq_f32(vld1q_f32(src), fvolume), fmaxvolume);
+        float32x4_t d = vaddq_f32(vld1q_f32(dst), s);
+
+        d = vminq_f32(d, max_audioval);
+        d = vmaxq_f32(d, min_audioval);
+        vst1q_f32(dst, d);
+    }
+
+    SDL_Mix_F32_Scalar(dst, src, num_samples, volume);
+}
+#endif
+#endif
+
+static void SDL_ChooseAudioMixers(void)
+{
+    if (SDL_Mix_S16) {
+        return;
+    }
+
+    SDL_Mix_F32 = SDL_Mix_F32_Scalar;
+    SDL_Mix_S32 = SDL_Mix_S32_Scalar;
+
+#ifdef HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SDL_Mix_F32 = SDL_Mix_F32_SSE2;
+        SDL_Mix_S32 = SDL_Mix_S32_SSE2;
+        SDL_Mix_S16 = SDL_Mix_S16_SSE2;
+        return;
+    }
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+#ifdef __aarch64__
+        SDL_Mix_F32 = SDL_Mix_F32_NEON;
+#endif
+        SDL_Mix_S32 = SDL_Mix_S32_NEON;
+        SDL_Mix_S16 = SDL_Mix_S16_NEON;
+        return;
+    }
+#endif
+
+    SDL_Mix_S16 = SDL_Mix_S16_Scalar;
+}
+
 void SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
                         Uint32 len, int volume)
 {
@@ -92,6 +360,23 @@ void SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
         return;
     }
 
+    /* Native byte order 16-bit, 32-bit and float samples go through the SIMD mixers when available */
+    SDL_ChooseAudioMixers();
+
+    switch (format) {
+    case AUDIO_S16SYS:
+        SDL_Mix_S16((Sint16 *)dst, (const Sint16 *)src, len / 2, volume);
+        return;
+    case AUDIO_S32SYS:
+        SDL_Mix_S32((Sint32 *)dst, (const Sint32 *)src, len / 4, volume);
+        return;
+    case AUDIO_F32SYS:
+        SDL_Mix_F32((float *)dst, (const float *)src, len / 4, volume);
+        return;
+    default:
+        break;
+    }
+
     switch (format) {
 
     case AUDIO_U8:
@@ -342,4 +627,249 @@ void SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
     }
 }
 
+/* Number of samples SDL_MixAudioBuffers() accumulates at a time, small enough to stay in the L1 cache */
+#define MIX_CHUNK_SAMPLES 512
+
+/* Add a chunk of source samples, scaled by volume, to an accumulator.
+   The scaling matches SDL_MixAudioFormat(), only the clamping is left for later. */
+#define MIX_ACCUMULATE(load)                                               \
+    if (volume == SDL_MIX_MAXVOLUME) {                                     \
+        for (i = 0; i < num_samples; ++i) {                                \
+            accum[i] += (load);                                            \
+        }                                                                  \
+    } else {                                                               \
+        for (i = 0; i < num_samples; ++i) {                                \
+            accum[i] += ((load) * volume) / SDL_MIX_MAXVOLUME;             \
+        }                                                                  \
+    }
+
+static void SDL_AccumulateInt(Sint32 *accum, const Uint8 *src, SDL_AudioFormat format, int num_samples, int volume)
+{
+    const Uint16 *src16 = (const Uint16 *)src;
+    int i;
+
+    switch (format) {
+    case AUDIO_U8:
+        MIX_ACCUMULATE((int)src[i] - 128);
+        break;
+    case AUDIO_S8:
+        MIX_ACCUMULATE((int)((const Sint8 *)src)[i]);
+        break;
+    case AUDIO_S16LSB:
+        MIX_ACCUMULATE((int)(Sint16)SDL_SwapLE16(src16[i]));
+        break;
+    case AUDIO_S16MSB:
+        MIX_ACCUMULATE((int)(Sint16)SDL_SwapBE16(src16[i]));
+        break;
+    case AUDIO_U16LSB:
+        MIX_ACCUMULATE((int)SDL_SwapLE16(src16[i]) - 32768);
+        break;
+    case AUDIO_U16MSB:
+        MIX_ACCUMULATE((int)SDL_SwapBE16(src16[i]) - 32768);
+        break;
+    default:
+        SDL_assert(!"unhandled audio format");
+        break;
+    }
+}
+
+static void SDL_AccumulateInt64(Sint64 *accum, const Uint8 *src, SDL_AudioFormat format, int num_samples, int volume)
+{
+    const Uint32 *src32 = (const Uint32 *)src;
+    int i;
+
+    if (format == AUDIO_S32LSB) {
+        MIX_ACCUMULATE((Sint64)(Sint32)SDL_SwapLE32(src32[i]));
+    } else {
+        MIX_ACCUMULATE((Sint64)(Sint32)SDL_SwapBE32(src32[i]));
+    }
+}
+
+static void SDL_AccumulateFloat(float *accum, const Uint8 *src, SDL_AudioFormat format, int num_samples, int volume)
+{
+    const float fmaxvolume = 1.0f / ((float)SDL_MIX_MAXVOLUME);
+    const float fvolume = (float)volume;
+    const float *srcf = (const float *)src;
+    int i;
+
+    if (format == AUDIO_F32LSB) {
+        for (i = 0; i < num_samples; ++i) {
+            accum[i] += (SDL_SwapFloatLE(srcf[i]) * fvolume) * fmaxvolume;
+        }
+    } else {
+        for (i = 0; i < num_samples; ++i) {
+            accum[i] += (SDL_SwapFloatBE(srcf[i]) * fvolume) * fmaxvolume;
+        }
+    }
+}
+
+#undef MIX_ACCUMULATE
+
+static void SDL_StoreInt(Uint8 *dst, const Sint32 *accum, SDL_AudioFormat format, int num_samples)
+{
+    Uint16 *dst16 = (Uint16 *)dst;
+    int i;
+
+    switch (format) {
+    case AUDIO_U8:
+        for (i = 0; i < num_samples; ++i) {
+            dst[i] = (Uint8)(SDL_clamp(accum[i], SDL_MIN_SINT8, SDL_MAX_SINT8) + 128);
+        }
+        break;
+    case AUDIO_S8:
+        for (i = 0; i < num_samples; ++i) {
+            ((Sint8 *)dst)[i] = (Sint8)SDL_clamp(accum[i], SDL_MIN_SINT8, SDL_MAX_SINT8);
+        }
+        break;
+    case AUDIO_S16LSB:
+        for (i = 0; i < num_samples; ++i) {
+            dst16[i] = SDL_SwapLE16((Uint16)(Sint16)SDL_clamp(accum[i], SDL_MIN_SINT16, SDL_MAX_SINT16));
+        }
+        break;
+    case AUDIO_S16MSB:
+        for (i = 0; i < num_samples; ++i) {
+            dst16[i] = SDL_SwapBE16((Uint16)(Sint16)SDL_clamp(accum[i], SDL_MIN_SINT16, SDL_MAX_SINT16));
+        }
+        break;
+    case AUDIO_U16LSB:
+        for (i = 0; i < num_samples; ++i) {
+            dst16[i] = SDL_SwapLE16((Uint16)(SDL_clamp(accum[i], SDL_MIN_SINT16, SDL_MAX_SINT16) + 32768));
+        }
+        break;
+    case AUDIO_U16MSB:
+        for (i = 0; i < num_samples; ++i) {
+            dst16[i] = SDL_SwapBE16((Uint16)(SDL_clamp(accum[i], SDL_MIN_SINT16, SDL_MAX_SINT16) + 32768));
+        }
+        break;
+    default:
+        SDL_assert(!"unhandled audio format");
+        break;
+    }
+}
+
+static void SDL_StoreInt64(Uint8 *dst, const Sint64 *accum, SDL_AudioFormat format, int num_samples)
+{
+    Uint32 *dst32 = (Uint32 *)dst;
+    int i;
+
+    if (format == AUDIO_S32LSB) {
+        for (i = 0; i < num_samples; ++i) {
+            dst32[i] = SDL_SwapLE32((Uint32)(Sint32)SDL_clamp(accum[i], SDL_MIN_SINT32, SDL_MAX_SINT32));
+        }
+    } else {
+        for (i = 0; i < num_samples; ++i) {
+            dst32[i] = SDL_SwapBE32((Uint32)(Sint32)SDL_clamp(accum[i], SDL_MIN_SINT32, SDL_MAX_SINT32));
+        }
+    }
+}
+
+static void SDL_StoreFloat(Uint8 *dst, const float *accum, SDL_AudioFormat format, int num_samples)
+{
+    /* !!! FIXME: are these right? Same limits as SDL_MixAudioFormat(). */
+    const float max_audioval = 3.402823466e+38F;
+    const float min_audioval = -3.402823466e+38F;
+    float *dstf = (float *)dst;
+    int i;
+
+    if (format == AUDIO_F32LSB) {
+        for (i = 0; i < num_samples; ++i) {
+            dstf[i] = SDL_SwapFloatLE(SDL_clamp(accum[i], min_audioval, max_audioval));
+        }
+    } else {
+        for (i = 0; i < num_samples; ++i) {
+            dstf[i] = SDL_SwapFloatBE(SDL_clamp(accum[i], min_audioval, max_audioval));
+        }
+    }
+}
+
+int SDL_MixAudioBuffers(Uint8 *dst, const Uint8 **srcs, const int *volumes, int num_srcs,
+                        SDL_AudioFormat format, Uint32 len)
+{
+    union
+    {
+        Sint32 i32[MIX_CHUNK_SAMPLES];
+        Sint64 i64[MIX_CHUNK_SAMPLES];
+        float f32[MIX_CHUNK_SAMPLES];
+    } accum;
+    const int sample_size = SDL_AUDIO_BITSIZE(format) / 8;
+    Uint32 num_samples, offset;
+    int i, n;
+
+    if (dst == NULL) {
+        return SDL_InvalidParamError("dst");
+    }
+    if (num_srcs < 0 || (num_srcs > 0 && srcs == NULL)) {
+        return SDL_InvalidParamError("srcs");
+    }
+
+    switch (format) {
+    case AUDIO_U8:
+    case AUDIO_S8:
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB:
+    case AUDIO_U16LSB:
+    case AUDIO_U16MSB:
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB:
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB:
+        break;
+    default:
+        return SDL_SetError("SDL_MixAudioBuffers(): unknown audio format");
+    }
+
+    /* With a single source there's only one clamp anyway */
+    if (num_srcs == 1) {
+        if (srcs[0] != NULL) {
+            SDL_MixAudioFormat(dst, srcs[0], format, len, volumes ? volumes[0] : SDL_MIX_MAXVOLUME);
+        }
+        return 0;
+    }
+
+    num_samples = len / sample_size;
+    for (offset = 0; offset < num_samples; offset += n) {
+        const Uint32 byte_offset = offset * sample_size;
+        Uint8 *out = dst + byte_offset;
+
+        n = (int)SDL_min(num_samples - offset, MIX_CHUNK_SAMPLES);
+
+        /* Start from the destination at full volume, then add every source, then clamp once */
+        SDL_memset(&accum, 0, n * sizeof(Sint64));
+        if (SDL_AUDIO_ISFLOAT(format)) {
+            SDL_AccumulateFloat(accum.f32, out, format, n, SDL_MIX_MAXVOLUME);
+        } else if (sample_size == 4) {
+            SDL_AccumulateInt64(accum.i64, out, format, n, SDL_MIX_MAXVOLUME);
+        } else {
+            SDL_AccumulateInt(accum.i32, out, format, n, SDL_MIX_MAXVOLUME);
+        }
+
+        for (i = 0; i < num_srcs; ++i) {
+            const int volume = volumes ? volumes[i] : SDL_MIX_MAXVOLUME;
+            const Uint8 *in;
+
+            if (volume == 0 || srcs[i] == NULL) {
+                continue;
+            }
+            in = srcs[i] + byte_offset;
+            if (SDL_AUDIO_ISFLOAT(format)) {
+                SDL_AccumulateFloat(accum.f32, in, format, n, volume);
+            } else if (sample_size == 4) {
+                SDL_AccumulateInt64(accum.i64, in, format, n, volume);
+            } else {
+                SDL_AccumulateInt(accum.i32, in, format, n, volume);
+            }
+        }
+
+        if (SDL_AUDIO_ISFLOAT(format)) {
+            SDL_StoreFloat(out, accum.f32, format, n);
+        } else if (sample_size == 4) {
+            SDL_StoreInt64(out, accum.i64, format, n);
+        } else {
+            SDL_StoreInt(out, accum.i32, format, n);
+        }
+    }
+
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -161,6 +161,9 @@ struct SDL_AudioDevice
     /* Queued buffers (if app not using callback). */
     SDL_DataQueue *buffer_queue;
 
+    /* SDL_TRUE if buffer_queue is lock-free (SDL_HINT_AUDIO_QUEUE_LOCKFREE). */
+    SDL_bool buffer_queue_lockfree;
+
     /* * * */
     /* Data private to this driver */
     struct SDL_PrivateAudioData *hidden;
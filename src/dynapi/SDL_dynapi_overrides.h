@@ -898,3 +898,14 @@
 #define SDL_DestroyWindowSurface SDL_DestroyWindowSurface_REAL
 #define SDL_GDKGetDefaultUser SDL_GDKGetDefaultUser_REAL
 #define SDL_GameControllerGetSteamHandle SDL_GameControllerGetSteamHandle_REAL
+#define SDL_PushEvents SDL_PushEvents_REAL
+#define SDL_GetEventQueueStats SDL_GetEventQueueStats_REAL
+#define SDL_GetEventQueueTypeCount SDL_GetEventQueueTypeCount_REAL
+#define SDL_ResetEventQueueStats SDL_ResetEventQueueStats_REAL
+#define SDL_MixAudioBuffers SDL_MixAudioBuffers_REAL
+#define SDL_AudioStreamReservePut SDL_AudioStreamReservePut_REAL
+#define SDL_AudioStreamCommitPut SDL_AudioStreamCommitPut_REAL
+#define SDL_AudioStreamReserveGet SDL_AudioStreamReserveGet_REAL
+#define SDL_AudioStreamCommitGet SDL_AudioStreamCommitGet_REAL
+#define SDL_RenderGetStats SDL_RenderGetStats_REAL
+#define SDL_UnpremultiplyAlpha SDL_UnpremultiplyAlpha_REAL
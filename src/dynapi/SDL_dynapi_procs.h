@@ -985,3 +985,14 @@ SDL_DYNAPI_PROC(int,SDL_DestroyWindowSurface,(SDL_Window *a),(a),return)
 SDL_DYNAPI_PROC(int,SDL_GDKGetDefaultUser,(XUserHandle *a),(a),return)
 #endif
 SDL_DYNAPI_PROC(Uint64,SDL_GameControllerGetSteamHandle,(SDL_GameController *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_PushEvents,(SDL_Event *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetEventQueueStats,(SDL_EventQueueStats *a),(a),return)
+SDL_DYNAPI_PROC(Uint32,SDL_GetEventQueueTypeCount,(Uint32 a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_ResetEventQueueStats,(void),(),)
+SDL_DYNAPI_PROC(int,SDL_MixAudioBuffers,(Uint8 *a, const Uint8 **b, const int *c, int d, SDL_AudioFormat e, Uint32 f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(void*,SDL_AudioStreamReservePut,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamCommitPut,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(const void*,SDL_AudioStreamReserveGet,(SDL_AudioStream *a, int *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamCommitGet,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_RenderGetStats,(SDL_Renderer *a, SDL_RenderStats *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_UnpremultiplyAlpha,(int a, int b, Uint32 c, const void *d, int e, Uint32 f, void *g, int h),(a,b,c,d,e,f,g,h),return)
@@ -37,6 +37,15 @@
 /* An arbitrary limit so we don't have unbounded growth */
 #define SDL_MAX_QUEUED_EVENTS 65535
 
+/* Number of slots in the lock-free event ring, must be a power of two */
+#define SDL_EVENT_RING_SIZE 4096
+
+/* How far back from the end of the queue to look for an event to merge with */
+#define SDL_MAX_COALESCE_DISTANCE 8
+
+/* Number of events SDL_PumpEvents() collects before adding them to the queue at once */
+#define SDL_EVENT_BATCH_SIZE 128
+
 /* Determines how often we wake to call SDL_PumpEvents() in SDL_WaitEventTimeout_Device() */
 #define PERIODIC_POLL_INTERVAL_MS 3000
 
@@ -78,6 +87,29 @@ typedef struct _SDL_SysWMEntry
     struct _SDL_SysWMEntry *next;
 } SDL_SysWMEntry;
 
+/* A slot in the lock-free event ring.
+   The sequence number tells producers and the consumer who owns the slot. */
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_Event event;
+} SDL_EventRingCell;
+
+/* Bounded multi-producer ring that events are pushed into without taking
+   the queue lock. The consumer moves them into the event list, with the
+   queue locked, before looking at the queue. SysWM messages are kept in a
+   side table indexed by slot so the cells stay small. */
+typedef struct
+{
+    SDL_atomic_t enqueue_pos;
+    char cache_pad0[SDL_CACHELINE_SIZE - sizeof(SDL_atomic_t)];
+    Uint32 dequeue_pos;
+    char cache_pad1[SDL_CACHELINE_SIZE - sizeof(Uint32)];
+    SDL_EventRingCell *cells;
+    SDL_SysWMmsg *wmmsgs;
+    void *memory;
+} SDL_EventRing;
+
 static struct
 {
     SDL_mutex *lock;
@@ -89,7 +121,31 @@ static struct
     SDL_EventEntry *free;
     SDL_SysWMEntry *wmmsg_used;
     SDL_SysWMEntry *wmmsg_free;
-} SDL_EventQ = { NULL, SDL_FALSE, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
+    SDL_EventRing *ring;       /* read with SDL_AtomicGetPtr() outside of the lock */
+    SDL_atomic_t ring_pushers; /* threads pushing into the ring without the lock */
+} SDL_EventQ = { NULL, SDL_FALSE, { 0 }, 0, NULL, NULL, NULL, NULL, NULL, NULL, { 0 } };
+
+/* Event queue statistics -- protected by the queue lock, except where atomic */
+static struct
+{
+    Uint32 *type_counts[256];
+    Uint32 events_added;
+    SDL_atomic_t events_dropped;
+    Uint32 latency_histogram[SDL_EVENT_LATENCY_BUCKETS];
+    Uint32 last_report;
+} SDL_EventStats;
+
+static Uint32 SDL_EventStatsInterval = 0;
+
+/* Events pushed by the thread running SDL_PumpEvents() while it pumps,
+   added to the queue together when the batch fills up or pumping ends.
+   Only the owning thread touches count and events. */
+static struct
+{
+    void *owner; /* SDL_ThreadID() of the pumping thread, read with SDL_AtomicGetPtr() */
+    int count;
+    SDL_Event events[SDL_EVENT_BATCH_SIZE];
+} SDL_EventBatch;
 
 #ifndef SDL_JOYSTICK_DISABLED
 
@@ -152,6 +208,112 @@ static void SDLCALL SDL_EventLoggingChanged(void *userdata, const char *name, co
     SDL_EventLoggingVerbosity = (hint && *hint) ? SDL_clamp(SDL_atoi(hint), 0, 3) : 0;
 }
 
+static SDL_bool SDL_coalesce_motion = SDL_FALSE;
+
+static void SDLCALL SDL_CoalesceMotionChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_coalesce_motion = SDL_GetStringBoolean(hint, SDL_FALSE);
+}
+
+static void SDLCALL SDL_EventStatsIntervalChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_EventStatsInterval = (hint && *hint) ? (Uint32)SDL_max(SDL_atoi(hint), 0) : 0;
+}
+
+/* Count an event going into the event list -- called with the queue locked */
+static void SDL_CountEvent(const SDL_Event *event)
+{
+    const Uint8 hi = ((event->type >> 8) & 0xff);
+    const Uint8 lo = (event->type & 0xff);
+
+    ++SDL_EventStats.events_added;
+
+    if (!SDL_EventStats.type_counts[hi]) {
+        SDL_EventStats.type_counts[hi] = (Uint32 *)SDL_calloc(256, sizeof(Uint32));
+        if (!SDL_EventStats.type_counts[hi]) {
+            /* Out of memory, this type just won't be counted */
+            return;
+        }
+    }
+    ++SDL_EventStats.type_counts[hi][lo];
+}
+
+/* Record how long an event spent in the queue -- called with the queue locked */
+static void SDL_CountEventLatency(const SDL_Event *event, Uint32 now)
+{
+    const Uint32 timestamp = event->common.timestamp;
+    Uint32 latency;
+    int bucket = 0;
+
+    /* Events added with SDL_PeepEvents() may not have a meaningful timestamp */
+    if (timestamp == 0 || !SDL_TICKS_PASSED(now, timestamp)) {
+        return;
+    }
+
+    for (latency = now - timestamp; latency && bucket < SDL_EVENT_LATENCY_BUCKETS - 1; latency >>= 1) {
+        ++bucket;
+    }
+    ++SDL_EventStats.latency_histogram[bucket];
+}
+
+/* Log the event queue statistics -- called with the queue locked */
+static void SDL_LogEventQueueStats(void)
+{
+    char histogram[SDL_EVENT_LATENCY_BUCKETS * 12];
+    char types[256];
+    char type[32];
+    size_t len, typelen;
+    int i, j;
+
+    histogram[0] = '\0';
+    for (i = 0, len = 0; i < SDL_EVENT_LATENCY_BUCKETS && len < sizeof(histogram); ++i) {
+        len += SDL_snprintf(histogram + len, sizeof(histogram) - len, " %u", (unsigned int)SDL_EventStats.latency_histogram[i]);
+    }
+
+    SDL_Log("SDL EVENT QUEUE: %d events in-flight, maximum %d, %u added, %u dropped\n",
+            SDL_AtomicGet(&SDL_EventQ.count), SDL_EventQ.max_events_seen,
+            (unsigned int)SDL_EventStats.events_added, (unsigned int)SDL_AtomicGet(&SDL_EventStats.events_dropped));
+    SDL_Log("SDL EVENT QUEUE: latency histogram:%s\n", histogram);
+
+    /* Log the counts by type over as many lines as it takes */
+    types[0] = '\0';
+    len = 0;
+    for (i = 0; i < SDL_arraysize(SDL_EventStats.type_counts); ++i) {
+        if (!SDL_EventStats.type_counts[i]) {
+            continue;
+        }
+        for (j = 0; j < 256; ++j) {
+            if (!SDL_EventStats.type_counts[i][j]) {
+                continue;
+            }
+            typelen = (size_t)SDL_snprintf(type, sizeof(type), " 0x%x=%u", (i << 8) | j, (unsigned int)SDL_EventStats.type_counts[i][j]);
+            if (len + typelen >= sizeof(types)) {
+                SDL_Log("SDL EVENT QUEUE: events by type:%s\n", types);
+                len = 0;
+            }
+            SDL_strlcpy(types + len, type, sizeof(types) - len);
+            len += typelen;
+        }
+    }
+    SDL_Log("SDL EVENT QUEUE: events by type:%s\n", types);
+}
+
+/* Clear the event queue statistics -- called with the queue locked */
+static void SDL_ClearEventQueueStats(void)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(SDL_EventStats.type_counts); ++i) {
+        if (SDL_EventStats.type_counts[i]) {
+            SDL_memset(SDL_EventStats.type_counts[i], 0, 256 * sizeof(Uint32));
+        }
+    }
+    SDL_EventStats.events_added = 0;
+    SDL_AtomicSet(&SDL_EventStats.events_dropped, 0);
+    SDL_zeroa(SDL_EventStats.latency_histogram);
+    SDL_EventQ.max_events_seen = SDL_AtomicGet(&SDL_EventQ.count);
+}
+
 static void SDL_LogEvent(const SDL_Event *event)
 {
     char name[64];
@@ -533,11 +695,61 @@ static void SDL_LogEvent(const SDL_Event *event)
 #undef uint
 }
 
+static int SDL_CreateEventRing(void)
+{
+    SDL_EventRing *ring;
+    Uint32 i;
+
+    ring = (SDL_EventRing *)SDL_calloc(1, sizeof(*ring));
+    if (ring == NULL) {
+        return SDL_OutOfMemory();
+    }
+
+    /* Keep the cells aligned to a cache line so neighbouring slots don't share more lines than needed */
+    ring->memory = SDL_malloc(SDL_EVENT_RING_SIZE * sizeof(SDL_EventRingCell) + SDL_CACHELINE_SIZE);
+    ring->wmmsgs = (SDL_SysWMmsg *)SDL_malloc(SDL_EVENT_RING_SIZE * sizeof(SDL_SysWMmsg));
+    if (ring->memory == NULL || ring->wmmsgs == NULL) {
+        SDL_free(ring->memory);
+        SDL_free(ring->wmmsgs);
+        SDL_free(ring);
+        return SDL_OutOfMemory();
+    }
+    ring->cells = (SDL_EventRingCell *)(((uintptr_t)ring->memory + (SDL_CACHELINE_SIZE - 1)) & ~(uintptr_t)(SDL_CACHELINE_SIZE - 1));
+
+    for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+        SDL_AtomicSet(&ring->cells[i].sequence, (int)i);
+    }
+    SDL_AtomicSet(&ring->enqueue_pos, 0);
+    ring->dequeue_pos = 0;
+
+    SDL_AtomicSetPtr((void **)&SDL_EventQ.ring, ring);
+    return 0;
+}
+
+static void SDL_DrainEventRing(SDL_EventRing *ring);
+
+/* Called with the queue locked, events left in the ring are moved to the event list */
+static void SDL_DestroyEventRing(void)
+{
+    SDL_EventRing *ring = SDL_EventQ.ring;
+
+    if (ring) {
+        /* Stop new pushes, and wait for the ones in progress to be done with the ring */
+        SDL_AtomicSetPtr((void **)&SDL_EventQ.ring, NULL);
+        while (SDL_AtomicGet(&SDL_EventQ.ring_pushers) > 0) {
+            SDL_Delay(0);
+        }
+        SDL_DrainEventRing(ring);
+        SDL_free(ring->memory);
+        SDL_free(ring->wmmsgs);
+        SDL_free(ring);
+    }
+}
+
 /* Public functions */
 
 void SDL_StopEventLoop(void)
 {
-    const char *report = SDL_GetHint("SDL_EVENT_QUEUE_STATISTICS");
     int i;
     SDL_EventEntry *entry;
     SDL_SysWMEntry *wmmsg;
@@ -546,11 +758,12 @@ void SDL_StopEventLoop(void)
 
     SDL_EventQ.active = SDL_FALSE;
 
-    if (report && SDL_atoi(report)) {
-        SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d\n",
-                SDL_EventQ.max_events_seen);
+    if (SDL_GetHintBoolean(SDL_HINT_EVENT_QUEUE_STATISTICS, SDL_FALSE)) {
+        SDL_LogEventQueueStats();
     }
 
+    SDL_DestroyEventRing();
+
     /* Clean out EventQ */
     for (entry = SDL_EventQ.head; entry;) {
         SDL_EventEntry *next = entry->next;
@@ -575,12 +788,18 @@ void SDL_StopEventLoop(void)
 
     SDL_AtomicSet(&SDL_EventQ.count, 0);
     SDL_EventQ.max_events_seen = 0;
+    for (i = 0; i < SDL_arraysize(SDL_EventStats.type_counts); ++i) {
+        SDL_free(SDL_EventStats.type_counts[i]);
+    }
+    SDL_zero(SDL_EventStats);
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
     SDL_EventQ.wmmsg_used = NULL;
     SDL_EventQ.wmmsg_free = NULL;
     SDL_AtomicSet(&SDL_sentinel_pending, 0);
+    SDL_AtomicSetPtr(&SDL_EventBatch.owner, NULL);
+    SDL_EventBatch.count = 0;
 
     /* Clear disabled event state */
     for (i = 0; i < SDL_arraysize(SDL_disabled_events); ++i) {
@@ -635,6 +854,11 @@ int SDL_StartEventLoop(void)
     }
 #endif /* !SDL_THREADS_DISABLED */
 
+    if (!SDL_EventQ.ring && SDL_GetHintBoolean(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_FALSE)) {
+        /* Not fatal, we'll just use the locked queue */
+        (void)SDL_CreateEventRing();
+    }
+
     /* Process most event types */
     (void)SDL_EventState(SDL_TEXTINPUT, SDL_DISABLE);
     (void)SDL_EventState(SDL_TEXTEDITING, SDL_DISABLE);
@@ -649,6 +873,102 @@ int SDL_StartEventLoop(void)
     return 0;
 }
 
+/* Get a free list entry -- called with the queue locked */
+static SDL_EventEntry *SDL_AllocEventEntry(void)
+{
+    SDL_EventEntry *entry;
+
+    if (SDL_EventQ.free == NULL) {
+        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
+    } else {
+        entry = SDL_EventQ.free;
+        SDL_EventQ.free = entry->next;
+    }
+    return entry;
+}
+
+/* Append an entry to the end of the event list -- called with the queue locked */
+static void SDL_LinkEvent(SDL_EventEntry *entry)
+{
+    if (SDL_EventQ.tail) {
+        SDL_EventQ.tail->next = entry;
+        entry->prev = SDL_EventQ.tail;
+        SDL_EventQ.tail = entry;
+        entry->next = NULL;
+    } else {
+        SDL_assert(!SDL_EventQ.head);
+        SDL_EventQ.head = entry;
+        SDL_EventQ.tail = entry;
+        entry->prev = NULL;
+        entry->next = NULL;
+    }
+}
+
+/* Merge an event into an equivalent event still waiting at the end of the queue -- called with the queue locked
+   Returns SDL_TRUE if the event was merged and doesn't need to be added. */
+static SDL_bool SDL_CoalesceEvent(const SDL_Event *event)
+{
+    SDL_EventEntry *entry;
+    int distance = 0;
+
+    switch (event->type) {
+    case SDL_MOUSEMOTION:
+    case SDL_CONTROLLERAXISMOTION:
+    case SDL_CONTROLLERSENSORUPDATE:
+        break;
+    default:
+        return SDL_FALSE;
+    }
+
+    /* Only look past events of the same type, so nothing moves across another kind of event */
+    for (entry = SDL_EventQ.tail; entry && entry->event.type == event->type && distance < SDL_MAX_COALESCE_DISTANCE; entry = entry->prev, ++distance) {
+        SDL_Event *queued = &entry->event;
+
+        switch (event->type) {
+        case SDL_MOUSEMOTION:
+            if (queued->motion.windowID == event->motion.windowID &&
+                queued->motion.which == event->motion.which &&
+                queued->motion.state == event->motion.state) {
+                queued->motion.timestamp = event->motion.timestamp;
+                queued->motion.x = event->motion.x;
+                queued->motion.y = event->motion.y;
+                queued->motion.xrel += event->motion.xrel;
+                queued->motion.yrel += event->motion.yrel;
+                return SDL_TRUE;
+            }
+            /* Merging past motion from another mouse or with other buttons held would reorder it */
+            return SDL_FALSE;
+        case SDL_CONTROLLERAXISMOTION:
+            if (queued->caxis.which == event->caxis.which &&
+                queued->caxis.axis == event->caxis.axis) {
+                queued->caxis.timestamp = event->caxis.timestamp;
+                queued->caxis.value = event->caxis.value;
+                return SDL_TRUE;
+            }
+            if (queued->caxis.which == event->caxis.which) {
+                /* Moving this axis ahead of another axis of the same controller would reorder them */
+                return SDL_FALSE;
+            }
+            break;
+        case SDL_CONTROLLERSENSORUPDATE:
+            if (queued->csensor.which == event->csensor.which &&
+                queued->csensor.sensor == event->csensor.sensor) {
+                queued->csensor.timestamp = event->csensor.timestamp;
+                SDL_memcpy(queued->csensor.data, event->csensor.data, sizeof(queued->csensor.data));
+                queued->csensor.timestamp_us = event->csensor.timestamp_us;
+                return SDL_TRUE;
+            }
+            if (queued->csensor.which == event->csensor.which) {
+                return SDL_FALSE;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return SDL_FALSE;
+}
+
 /* Add an event to the event queue -- called with the queue locked */
 static int SDL_AddEvent(SDL_Event *event)
 {
@@ -657,24 +977,25 @@ static int SDL_AddEvent(SDL_Event *event)
     int final_count;
 
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
+        SDL_AtomicAdd(&SDL_EventStats.events_dropped, 1);
         SDL_SetError("Event queue is full (%d events)", initial_count);
         return 0;
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (entry == NULL) {
-            return 0;
-        }
-    } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
-    }
-
     if (SDL_EventLoggingVerbosity > 0) {
         SDL_LogEvent(event);
     }
 
+    if (SDL_coalesce_motion && SDL_CoalesceEvent(event)) {
+        SDL_CountEvent(event);
+        return 1;
+    }
+
+    entry = SDL_AllocEventEntry();
+    if (entry == NULL) {
+        return 0;
+    }
+
     entry->event = *event;
     if (event->type == SDL_POLLSENTINEL) {
         SDL_AtomicAdd(&SDL_sentinel_pending, 1);
@@ -683,18 +1004,8 @@ static int SDL_AddEvent(SDL_Event *event)
         entry->event.syswm.msg = &entry->msg;
     }
 
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
-    }
+    SDL_LinkEvent(entry);
+    SDL_CountEvent(event);
 
     final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
     if (final_count > SDL_EventQ.max_events_seen) {
@@ -704,6 +1015,127 @@ static int SDL_AddEvent(SDL_Event *event)
     return 1;
 }
 
+/* Move everything published in the event ring to the end of the event list -- called with the queue locked */
+static void SDL_DrainEventRing(SDL_EventRing *ring)
+{
+    const int final_count = SDL_AtomicGet(&SDL_EventQ.count);
+
+    for (;;) {
+        const Uint32 pos = ring->dequeue_pos;
+        SDL_EventRingCell *cell = &ring->cells[pos & (SDL_EVENT_RING_SIZE - 1)];
+        SDL_EventEntry *entry;
+
+        if ((Uint32)SDL_AtomicGet(&cell->sequence) != pos + 1) {
+            /* Empty, or a producer hasn't finished writing this slot yet */
+            break;
+        }
+        SDL_MemoryBarrierAcquire();
+
+        if (SDL_coalesce_motion && SDL_CoalesceEvent(&cell->event)) {
+            SDL_CountEvent(&cell->event);
+            SDL_AtomicAdd(&SDL_EventQ.count, -1);
+            SDL_AtomicSet(&cell->sequence, (int)(pos + SDL_EVENT_RING_SIZE));
+            ring->dequeue_pos = pos + 1;
+            continue;
+        }
+
+        entry = SDL_AllocEventEntry();
+        if (entry) {
+            entry->event = cell->event;
+            if (entry->event.type == SDL_SYSWMEVENT) {
+                entry->msg = ring->wmmsgs[pos & (SDL_EVENT_RING_SIZE - 1)];
+                entry->event.syswm.msg = &entry->msg;
+            }
+        } else {
+            /* Out of memory, the event is lost */
+            if (cell->event.type == SDL_POLLSENTINEL) {
+                SDL_AtomicAdd(&SDL_sentinel_pending, -1);
+            }
+            SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        }
+
+        /* Hand the slot back to the producers for the next lap around the ring */
+        SDL_AtomicSet(&cell->sequence, (int)(pos + SDL_EVENT_RING_SIZE));
+        ring->dequeue_pos = pos + 1;
+
+        if (entry) {
+            SDL_LinkEvent(entry);
+            SDL_CountEvent(&entry->event);
+        }
+    }
+
+    if (final_count > SDL_EventQ.max_events_seen) {
+        SDL_EventQ.max_events_seen = final_count;
+    }
+}
+
+/* Add an event to the event ring without locking the queue.
+   Returns SDL_FALSE if the ring is full and the event wasn't added. */
+static SDL_bool SDL_PushEventRing(SDL_EventRing *ring, SDL_Event *event)
+{
+    SDL_EventRingCell *cell;
+    Uint32 pos = (Uint32)SDL_AtomicGet(&ring->enqueue_pos);
+
+    for (;;) {
+        int diff;
+
+        cell = &ring->cells[pos & (SDL_EVENT_RING_SIZE - 1)];
+        diff = (int)((Uint32)SDL_AtomicGet(&cell->sequence) - pos);
+        if (diff == 0) {
+            /* The slot is free, try to claim it */
+            if (SDL_AtomicCAS(&ring->enqueue_pos, (int)pos, (int)(pos + 1))) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The consumer hasn't caught up with this slot yet, the ring is full */
+            return SDL_FALSE;
+        }
+        pos = (Uint32)SDL_AtomicGet(&ring->enqueue_pos);
+    }
+
+    cell->event = *event;
+    if (event->type == SDL_SYSWMEVENT) {
+        ring->wmmsgs[pos & (SDL_EVENT_RING_SIZE - 1)] = *event->syswm.msg;
+    }
+
+    /* Publish the slot to the consumer */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&cell->sequence, (int)(pos + 1));
+    return SDL_TRUE;
+}
+
+/* Add an event to the event ring without locking the queue.
+   Returns -1 if the ring is full, the event should then be added with the queue locked. */
+static int SDL_AddEventLockFree(SDL_EventRing *ring, SDL_Event *event)
+{
+    const int initial_count = SDL_AtomicAdd(&SDL_EventQ.count, 1);
+
+    if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        SDL_AtomicAdd(&SDL_EventStats.events_dropped, 1);
+        SDL_SetError("Event queue is full (%d events)", initial_count);
+        return 0;
+    }
+
+    if (event->type == SDL_POLLSENTINEL) {
+        SDL_AtomicAdd(&SDL_sentinel_pending, 1);
+    }
+
+    if (SDL_PushEventRing(ring, event)) {
+        if (SDL_EventLoggingVerbosity > 0) {
+            SDL_LogEvent(event);
+        }
+        return 1;
+    }
+
+    /* Undo the reservation, SDL_AddEvent() counts for itself */
+    if (event->type == SDL_POLLSENTINEL) {
+        SDL_AtomicAdd(&SDL_sentinel_pending, -1);
+    }
+    SDL_AtomicAdd(&SDL_EventQ.count, -1);
+    return -1;
+}
+
 /* Remove an event from the queue -- called with the queue locked */
 static void SDL_CutEvent(SDL_EventEntry *entry)
 {
@@ -754,15 +1186,87 @@ static int SDL_SendWakeupEvent(void)
     return 0;
 }
 
+static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventaction action,
+                                  Uint32 minType, Uint32 maxType, SDL_bool include_sentinel);
+
+static SDL_bool SDL_IsBatchingEvents(void)
+{
+    return SDL_AtomicGetPtr(&SDL_EventBatch.owner) == (void *)(uintptr_t)SDL_ThreadID();
+}
+
+/* Add the events batched so far to the queue, if the calling thread is batching */
+static void SDL_FlushEventBatch(void)
+{
+    if (SDL_IsBatchingEvents() && SDL_EventBatch.count > 0) {
+        const int count = SDL_EventBatch.count;
+        int added;
+
+        SDL_EventBatch.count = 0;
+        added = SDL_PeepEventsInternal(SDL_EventBatch.events, count, SDL_ADDEVENT, 0, 0, SDL_FALSE);
+        if (added < count) {
+            /* SDL_PushEvent() made sure there was room, so another thread
+               filled the queue up in the meantime. Those drops were counted
+               in the statistics, the caller was already told they were queued. */
+            SDL_SetError("%d batched events were dropped", count - SDL_max(added, 0));
+        }
+    }
+}
+
+static void SDL_BeginEventBatch(void)
+{
+    /* Only one thread pumps events, but don't let a nested pump take over the batch */
+    if (SDL_AtomicCASPtr(&SDL_EventBatch.owner, NULL, (void *)(uintptr_t)SDL_ThreadID())) {
+        SDL_EventBatch.count = 0;
+    }
+}
+
+static void SDL_EndEventBatch(void)
+{
+    if (SDL_IsBatchingEvents()) {
+        SDL_FlushEventBatch();
+        SDL_AtomicSetPtr(&SDL_EventBatch.owner, NULL);
+    }
+}
+
 /* Lock the event queue, take a peep at it, and unlock it */
 static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventaction action,
                                   Uint32 minType, Uint32 maxType, SDL_bool include_sentinel)
 {
     int i, used, sentinels_expected = 0;
 
+    /* Anything batched by this thread goes first, so it sees the queue in order */
+    SDL_FlushEventBatch();
+
     /* Lock the event queue */
     used = 0;
 
+    if (action == SDL_ADDEVENT && SDL_AtomicGetPtr((void **)&SDL_EventQ.ring)) {
+        SDL_EventRing *ring;
+
+        /* The ring is only freed once no thread is pushing into it */
+        SDL_AtomicAdd(&SDL_EventQ.ring_pushers, 1);
+        ring = (SDL_EventRing *)SDL_AtomicGetPtr((void **)&SDL_EventQ.ring);
+        for (i = 0; ring && i < numevents; ++i) {
+            const int added = SDL_AddEventLockFree(ring, &events[i]);
+            if (added < 0) {
+                break;
+            }
+            used += added;
+        }
+        SDL_AtomicAdd(&SDL_EventQ.ring_pushers, -1);
+
+        if (ring && i == numevents) {
+            if (used > 0) {
+                SDL_SendWakeupEvent();
+            }
+            return used;
+        }
+
+        /* The ring is full or gone, add the rest with the queue locked */
+        events += i;
+        numevents -= i;
+    }
+
     SDL_LockMutex(SDL_EventQ.lock);
     {
         /* Don't look after we've quit */
@@ -772,9 +1276,23 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventact
                 SDL_SetError("The event system has been shut down");
             }
             SDL_UnlockMutex(SDL_EventQ.lock);
-            return -1;
+            return used > 0 ? used : -1;
+        }
+        if (SDL_EventQ.ring) {
+            SDL_DrainEventRing(SDL_EventQ.ring);
         }
         if (action == SDL_ADDEVENT) {
+            if (SDL_EventQ.ring) {
+                /* Slots claimed before the ring filled up may not be published yet,
+                   wait for them so events from one thread stay in order */
+                SDL_EventRing *ring = SDL_EventQ.ring;
+                const Uint32 end = (Uint32)SDL_AtomicGet(&ring->enqueue_pos);
+
+                while ((int)(end - ring->dequeue_pos) > 0) {
+                    SDL_Delay(0);
+                    SDL_DrainEventRing(ring);
+                }
+            }
             for (i = 0; i < numevents; ++i) {
                 used += SDL_AddEvent(&events[i]);
             }
@@ -782,6 +1300,7 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventact
             SDL_EventEntry *entry, *next;
             SDL_SysWMEntry *wmmsg, *wmmsg_next;
             Uint32 type;
+            const Uint32 now = SDL_GetTicks();
 
             if (action == SDL_GETEVENT) {
                 /* Clean out any used wmmsg data
@@ -819,6 +1338,7 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventact
                         }
 
                         if (action == SDL_GETEVENT) {
+                            SDL_CountEventLatency(&entry->event, now);
                             SDL_CutEvent(entry);
                         }
                     }
@@ -886,6 +1406,8 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     SDL_PumpEvents();
 #endif
 
+    SDL_FlushEventBatch();
+
     /* Lock the event queue */
     SDL_LockMutex(SDL_EventQ.lock);
     {
@@ -894,6 +1416,9 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
+        if (SDL_EventQ.ring) {
+            SDL_DrainEventRing(SDL_EventQ.ring);
+        }
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -910,6 +1435,9 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
 {
     SDL_VideoDevice *_this = SDL_GetVideoDevice();
 
+    /* Collect the events generated while pumping and add them to the queue together */
+    SDL_BeginEventBatch();
+
     /* Release any keys held down from last frame */
     SDL_ReleaseAutoReleaseKeys();
 
@@ -934,6 +1462,19 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
 
     SDL_SendPendingSignalEvents(); /* in case we had a signal handler fire, etc. */
 
+    SDL_EndEventBatch();
+
+    if (SDL_EventStatsInterval > 0) {
+        const Uint32 now = SDL_GetTicks();
+
+        SDL_LockMutex(SDL_EventQ.lock);
+        if (SDL_TICKS_PASSED(now, SDL_EventStats.last_report + SDL_EventStatsInterval)) {
+            SDL_EventStats.last_report = now;
+            SDL_LogEventQueueStats();
+        }
+        SDL_UnlockMutex(SDL_EventQ.lock);
+    }
+
     if (push_sentinel && SDL_GetEventState(SDL_POLLSENTINEL) == SDL_ENABLE) {
         SDL_Event sentinel;
 
@@ -1169,6 +1710,41 @@ int SDL_WaitEventTimeout(SDL_Event *event, int timeout)
     }
 }
 
+/* Run the event filter and watchers on an event -- called with the watchers locked
+   Returns SDL_FALSE if the event filter rejected the event. */
+static SDL_bool SDL_DispatchEventWatchers(SDL_Event *event)
+{
+    if (SDL_EventOK.callback && !SDL_EventOK.callback(SDL_EventOK.userdata, event)) {
+        return SDL_FALSE;
+    }
+
+    if (SDL_event_watchers_count > 0) {
+        /* Make sure we only dispatch the current watcher list */
+        int i, event_watchers_count = SDL_event_watchers_count;
+
+        SDL_event_watchers_dispatching = SDL_TRUE;
+        for (i = 0; i < event_watchers_count; ++i) {
+            if (!SDL_event_watchers[i].removed) {
+                SDL_event_watchers[i].callback(SDL_event_watchers[i].userdata, event);
+            }
+        }
+        SDL_event_watchers_dispatching = SDL_FALSE;
+
+        if (SDL_event_watchers_removed) {
+            for (i = SDL_event_watchers_count; i--;) {
+                if (SDL_event_watchers[i].removed) {
+                    --SDL_event_watchers_count;
+                    if (i < SDL_event_watchers_count) {
+                        SDL_memmove(&SDL_event_watchers[i], &SDL_event_watchers[i + 1], (SDL_event_watchers_count - i) * sizeof(SDL_event_watchers[i]));
+                    }
+                }
+            }
+            SDL_event_watchers_removed = SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
 int SDL_PushEvent(SDL_Event *event)
 {
     event->common.timestamp = SDL_GetTicks();
@@ -1176,40 +1752,24 @@ int SDL_PushEvent(SDL_Event *event)
     if (SDL_EventOK.callback || SDL_event_watchers_count > 0) {
         SDL_LockMutex(SDL_event_watchers_lock);
         {
-            if (SDL_EventOK.callback && !SDL_EventOK.callback(SDL_EventOK.userdata, event)) {
+            if (!SDL_DispatchEventWatchers(event)) {
                 SDL_UnlockMutex(SDL_event_watchers_lock);
                 return 0;
             }
-
-            if (SDL_event_watchers_count > 0) {
-                /* Make sure we only dispatch the current watcher list */
-                int i, event_watchers_count = SDL_event_watchers_count;
-
-                SDL_event_watchers_dispatching = SDL_TRUE;
-                for (i = 0; i < event_watchers_count; ++i) {
-                    if (!SDL_event_watchers[i].removed) {
-                        SDL_event_watchers[i].callback(SDL_event_watchers[i].userdata, event);
-                    }
-                }
-                SDL_event_watchers_dispatching = SDL_FALSE;
-
-                if (SDL_event_watchers_removed) {
-                    for (i = SDL_event_watchers_count; i--;) {
-                        if (SDL_event_watchers[i].removed) {
-                            --SDL_event_watchers_count;
-                            if (i < SDL_event_watchers_count) {
-                                SDL_memmove(&SDL_event_watchers[i], &SDL_event_watchers[i + 1], (SDL_event_watchers_count - i) * sizeof(SDL_event_watchers[i]));
-                            }
-                        }
-                    }
-                    SDL_event_watchers_removed = SDL_FALSE;
-                }
-            }
         }
         SDL_UnlockMutex(SDL_event_watchers_lock);
     }
 
-    if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
+    /* SysWM messages aren't copied until they reach the queue, so they can't wait in the batch.
+       Events are only batched while there's room for them in the queue, so that
+       the result returned here is still right. */
+    if (event->type != SDL_SYSWMEVENT && SDL_IsBatchingEvents() &&
+        SDL_AtomicGet(&SDL_EventQ.count) + SDL_EventBatch.count < SDL_MAX_QUEUED_EVENTS) {
+        if (SDL_EventBatch.count == SDL_EVENT_BATCH_SIZE) {
+            SDL_FlushEventBatch();
+        }
+        SDL_EventBatch.events[SDL_EventBatch.count++] = *event;
+    } else if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
         return -1;
     }
 
@@ -1218,6 +1778,56 @@ int SDL_PushEvent(SDL_Event *event)
     return 1;
 }
 
+int SDL_PushEvents(SDL_Event *events, int numevents)
+{
+    const Uint32 timestamp = SDL_GetTicks();
+    const SDL_bool filtered = (SDL_EventOK.callback || SDL_event_watchers_count > 0);
+    int i, j, first, result, used = 0;
+
+    if (events == NULL) {
+        return SDL_InvalidParamError("events");
+    }
+    if (numevents <= 0) {
+        return 0;
+    }
+
+    for (i = 0; i < numevents; ++i) {
+        events[i].common.timestamp = timestamp;
+    }
+
+    if (filtered) {
+        SDL_LockMutex(SDL_event_watchers_lock);
+    }
+
+    /* Add each run of events that got past the event filter with a single call */
+    first = 0;
+    for (i = 0; i <= numevents; ++i) {
+        if (i < numevents && (!filtered || SDL_DispatchEventWatchers(&events[i]))) {
+            continue;
+        }
+        if (i > first) {
+            result = SDL_PeepEvents(&events[first], i - first, SDL_ADDEVENT, 0, 0);
+            if (result < 0) {
+                if (used == 0) {
+                    used = result;
+                }
+                break;
+            }
+            for (j = 0; j < result; ++j) {
+                SDL_GestureProcessEvent(&events[first + j]);
+            }
+            used += result;
+        }
+        first = i + 1;
+    }
+
+    if (filtered) {
+        SDL_UnlockMutex(SDL_event_watchers_lock);
+    }
+
+    return used;
+}
+
 void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
 {
     SDL_LockMutex(SDL_event_watchers_lock);
@@ -1296,9 +1906,14 @@ void SDL_DelEventWatch(SDL_EventFilter filter, void *userdata)
 
 void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
+    SDL_FlushEventBatch();
+
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        if (SDL_EventQ.ring) {
+            SDL_DrainEventRing(SDL_EventQ.ring);
+        }
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -1368,6 +1983,60 @@ Uint32 SDL_RegisterEvents(int numevents)
     return event_base;
 }
 
+int SDL_GetEventQueueStats(SDL_EventQueueStats *stats)
+{
+    if (stats == NULL) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (SDL_EventQ.ring) {
+            SDL_DrainEventRing(SDL_EventQ.ring);
+        }
+        stats->num_events = SDL_AtomicGet(&SDL_EventQ.count);
+        stats->max_events_seen = SDL_EventQ.max_events_seen;
+        stats->events_added = SDL_EventStats.events_added;
+        stats->events_dropped = (Uint32)SDL_AtomicGet(&SDL_EventStats.events_dropped);
+        SDL_memcpy(stats->latency_histogram, SDL_EventStats.latency_histogram, sizeof(stats->latency_histogram));
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    return 0;
+}
+
+Uint32 SDL_GetEventQueueTypeCount(Uint32 type)
+{
+    const Uint8 hi = ((type >> 8) & 0xff);
+    const Uint8 lo = (type & 0xff);
+    Uint32 count = 0;
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (SDL_EventQ.ring) {
+            SDL_DrainEventRing(SDL_EventQ.ring);
+        }
+        if (type <= SDL_LASTEVENT && SDL_EventStats.type_counts[hi]) {
+            count = SDL_EventStats.type_counts[hi][lo];
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    return count;
+}
+
+void SDL_ResetEventQueueStats(void)
+{
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        if (SDL_EventQ.ring) {
+            SDL_DrainEventRing(SDL_EventQ.ring);
+        }
+        SDL_ClearEventQueueStats();
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+}
+
 int SDL_SendAppEvent(SDL_EventType eventType)
 {
     int posted;
@@ -1407,6 +2076,23 @@ int SDL_SendLocaleChangedEvent(void)
     return SDL_SendAppEvent(SDL_LOCALECHANGED);
 }
 
+static void SDLCALL SDL_EventQueueLockFreeChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    /* The event loop creates the ring when it starts, this switches it while running */
+    SDL_LockMutex(SDL_EventQ.lock);
+    if (SDL_EventQ.active) {
+        if (SDL_GetStringBoolean(hint, SDL_FALSE)) {
+            if (!SDL_EventQ.ring) {
+                /* Not fatal, we'll just use the locked queue */
+                (void)SDL_CreateEventRing();
+            }
+        } else {
+            SDL_DestroyEventRing();
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+}
+
 int SDL_EventsInit(void)
 {
 #ifndef SDL_JOYSTICK_DISABLED
@@ -1417,7 +2103,13 @@ int SDL_EventsInit(void)
 #endif
     SDL_AddHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
     SDL_AddHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_QUEUE_STATISTICS_INTERVAL, SDL_EventStatsIntervalChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_EventQueueLockFreeChanged, NULL);
     if (SDL_StartEventLoop() < 0) {
+        SDL_DelHintCallback(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_EventQueueLockFreeChanged, NULL);
+        SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
+        SDL_DelHintCallback(SDL_HINT_EVENT_QUEUE_STATISTICS_INTERVAL, SDL_EventStatsIntervalChanged, NULL);
         SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
         return -1;
     }
@@ -1431,6 +2123,9 @@ void SDL_EventsQuit(void)
 {
     SDL_QuitQuit();
     SDL_StopEventLoop();
+    SDL_DelHintCallback(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_EventQueueLockFreeChanged, NULL);
+    SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
+    SDL_DelHintCallback(SDL_HINT_EVENT_QUEUE_STATISTICS_INTERVAL, SDL_EventStatsIntervalChanged, NULL);
     SDL_DelHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
     SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 #ifndef SDL_JOYSTICK_DISABLED
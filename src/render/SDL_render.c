@@ -28,6 +28,7 @@
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
 #include "../video/SDL_pixels_c.h"
+#include "../video/SDL_yuv_c.h"
 
 #if defined(__ANDROID__)
 #include "../core/android/SDL_android.h"
@@ -233,8 +234,194 @@ static SDL_INLINE void DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+static void FreeRenderCommand(SDL_Renderer *renderer, SDL_RenderCommand *cmd)
+{
+    cmd->next = renderer->render_commands_pool;
+    renderer->render_commands_pool = cmd;
+}
+
+static SDL_bool IsRenderStateCommandRedundant(const SDL_RenderCommand *active, const SDL_RenderCommand *cmd)
+{
+    if (!active) {
+        return SDL_FALSE;
+    }
+    switch (cmd->command) {
+    case SDL_RENDERCMD_SETVIEWPORT:
+        return SDL_memcmp(&active->data.viewport.rect, &cmd->data.viewport.rect, sizeof(SDL_Rect)) == 0;
+    case SDL_RENDERCMD_SETCLIPRECT:
+        return active->data.cliprect.enabled == cmd->data.cliprect.enabled &&
+               SDL_memcmp(&active->data.cliprect.rect, &cmd->data.cliprect.rect, sizeof(SDL_Rect)) == 0;
+    case SDL_RENDERCMD_SETDRAWCOLOR:
+        return active->data.color.r == cmd->data.color.r &&
+               active->data.color.g == cmd->data.color.g &&
+               active->data.color.b == cmd->data.color.b &&
+               active->data.color.a == cmd->data.color.a;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+static SDL_bool CanMergeRenderCommands(const SDL_RenderCommand *cmd, const SDL_RenderCommand *next)
+{
+    /* Lines are strips and copies are one primitive per command in some backends, so only lists are merged. */
+    if (cmd->command != next->command ||
+        (cmd->command != SDL_RENDERCMD_GEOMETRY && cmd->command != SDL_RENDERCMD_DRAW_POINTS && cmd->command != SDL_RENDERCMD_FILL_RECTS)) {
+        return SDL_FALSE;
+    }
+    if (cmd->data.draw.texture != next->data.draw.texture ||
+        cmd->data.draw.blend != next->data.draw.blend ||
+        cmd->data.draw.r != next->data.draw.r ||
+        cmd->data.draw.g != next->data.draw.g ||
+        cmd->data.draw.b != next->data.draw.b ||
+        cmd->data.draw.a != next->data.draw.a) {
+        return SDL_FALSE;
+    }
+    /* The vertex data has to be contiguous */
+    return cmd->data.draw.datasize && next->data.draw.datasize &&
+           next->data.draw.first == cmd->data.draw.first + cmd->data.draw.datasize;
+}
+
+/* Remove state changes that are never used or don't change anything, and
+ * merge consecutive draws of the same kind and state into one vertex range,
+ * so the backends see fewer commands and issue fewer draw calls. */
+static void OptimizeRenderCommands(SDL_Renderer *renderer)
+{
+    enum
+    {
+        STATE_VIEWPORT,
+        STATE_CLIPRECT,
+        STATE_DRAWCOLOR,
+        STATE_COUNT
+    };
+    SDL_RenderCommand *active[STATE_COUNT] = { NULL, NULL, NULL };
+    SDL_RenderCommand *pending[STATE_COUNT] = { NULL, NULL, NULL };
+    SDL_RenderCommand **link;
+    SDL_RenderCommand *cmd;
+    SDL_RenderCommand *last = NULL;
+    int i;
+
+    /* Drop state changes that are replaced before any draw, or that set the state already in effect */
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        int state;
+        switch (cmd->command) {
+        case SDL_RENDERCMD_NO_OP:
+            continue;
+        case SDL_RENDERCMD_SETVIEWPORT:
+            state = STATE_VIEWPORT;
+            break;
+        case SDL_RENDERCMD_SETCLIPRECT:
+            state = STATE_CLIPRECT;
+            break;
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+            state = STATE_DRAWCOLOR;
+            break;
+        default:
+            /* A clear or a draw uses all the pending state */
+            for (i = 0; i < STATE_COUNT; i++) {
+                if (pending[i]) {
+                    active[i] = pending[i];
+                    pending[i] = NULL;
+                }
+            }
+            continue;
+        }
+
+        if (pending[state]) {
+            pending[state]->command = SDL_RENDERCMD_NO_OP;
+            pending[state] = NULL;
+        }
+        if (IsRenderStateCommandRedundant(active[state], cmd)) {
+            cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            pending[state] = cmd;
+        }
+    }
+
+    /* Unlink the no-ops and merge the draws that are now next to each other */
+    link = &renderer->render_commands;
+    while ((cmd = *link) != NULL) {
+        if (cmd->command == SDL_RENDERCMD_NO_OP) {
+            *link = cmd->next;
+            FreeRenderCommand(renderer, cmd);
+        } else if (last && CanMergeRenderCommands(last, cmd)) {
+            last->data.draw.count += cmd->data.draw.count;
+            last->data.draw.datasize += cmd->data.draw.datasize;
+            *link = cmd->next;
+            FreeRenderCommand(renderer, cmd);
+        } else {
+            last = cmd;
+            link = &cmd->next;
+        }
+    }
+    renderer->render_commands_tail = last;
+}
+
+static Uint64 PerformanceCounterToNS(Uint64 ticks)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    return (ticks / freq) * 1000000000 + ((ticks % freq) * 1000000000) / freq;
+}
+
+static void CountRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderStats *stats = &renderer->stats;
+    const SDL_RenderCommand *cmd;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_SETVIEWPORT:
+            stats->viewport_commands++;
+            break;
+        case SDL_RENDERCMD_SETCLIPRECT:
+            stats->cliprect_commands++;
+            break;
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+            stats->drawcolor_commands++;
+            break;
+        case SDL_RENDERCMD_CLEAR:
+            stats->clear_commands++;
+            break;
+        case SDL_RENDERCMD_DRAW_POINTS:
+            stats->point_commands++;
+            break;
+        case SDL_RENDERCMD_DRAW_LINES:
+            stats->line_commands++;
+            break;
+        case SDL_RENDERCMD_FILL_RECTS:
+            stats->rect_commands++;
+            break;
+        case SDL_RENDERCMD_COPY:
+            stats->copy_commands++;
+            break;
+        case SDL_RENDERCMD_COPY_EX:
+            stats->copyex_commands++;
+            break;
+        case SDL_RENDERCMD_GEOMETRY:
+            stats->geometry_commands++;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void CountTextureUpload(SDL_Texture *texture, const SDL_Rect *rect)
+{
+    size_t size;
+
+    if (SDL_ISPIXELFORMAT_FOURCC(texture->format)) {
+        if (SDL_CalculateYUVSize(texture->format, rect->w, rect->h, &size, NULL) < 0) {
+            return;
+        }
+    } else {
+        size = (size_t)rect->w * rect->h * SDL_BYTESPERPIXEL(texture->format);
+    }
+    texture->renderer->stats.texture_upload_bytes += size;
+}
+
 static int FlushRenderCommands(SDL_Renderer *renderer)
 {
+    Uint64 start;
     int retval;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
@@ -244,9 +431,20 @@ static int FlushRenderCommands(SDL_Renderer *renderer)
         return 0;
     }
 
+    start = SDL_GetPerformanceCounter();
+
+    OptimizeRenderCommands(renderer);
+
     DebugLogRenderCommands(renderer->render_commands);
+    CountRenderCommands(renderer);
 
-    retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    if (renderer->render_commands) {
+        retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    } else {
+        retval = 0; /* everything was optimized away */
+    }
+
+    renderer->stats.flush_time_ns += PerformanceCounterToNS(SDL_GetPerformanceCounter() - start);
 
     /* Move the whole render command queue to the unused pool so we can reuse them next time. */
     if (renderer->render_commands_tail) {
@@ -314,6 +512,7 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t numbytes,
     }
 
     renderer->vertex_data_used += aligner + numbytes;
+    renderer->stats.vertex_bytes += numbytes;
 
     return ((Uint8 *)renderer->vertex_data) + aligned;
 }
@@ -482,19 +681,34 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
             cmd->data.draw.a = color->a;
             cmd->data.draw.blend = blendMode;
             cmd->data.draw.texture = texture;
+            cmd->data.draw.datasize = 0;
         }
     }
     return cmd;
 }
 
+/* Remember the vertex data a draw command queued, so OptimizeRenderCommands()
+ * can merge it with the next one. Backends that keep their vertices elsewhere
+ * don't allocate from the vertex data, and their commands are never merged. */
+static void SetDrawCommandDataSize(SDL_Renderer *renderer, SDL_RenderCommand *cmd, size_t vertex_data_used)
+{
+    const size_t first = cmd->data.draw.first;
+    if (renderer->vertex_data_used > vertex_data_used && first >= vertex_data_used && first < renderer->vertex_data_used) {
+        cmd->data.draw.datasize = renderer->vertex_data_used - first;
+    }
+}
+
 static int QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points, const int count)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL);
     int retval = -1;
     if (cmd) {
+        const size_t vertex_data_used = renderer->vertex_data_used;
         retval = renderer->QueueDrawPoints(renderer, cmd, points, count);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            SetDrawCommandDataSize(renderer, cmd, vertex_data_used);
         }
     }
     return retval;
@@ -522,6 +736,7 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
     cmd = PrepQueueCmdDraw(renderer, (use_rendergeometry ? SDL_RENDERCMD_GEOMETRY : SDL_RENDERCMD_FILL_RECTS), NULL);
 
     if (cmd) {
+        const size_t vertex_data_used = renderer->vertex_data_used;
         if (use_rendergeometry) {
             SDL_bool isstack1;
             SDL_bool isstack2;
@@ -583,6 +798,9 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
                 cmd->command = SDL_RENDERCMD_NO_OP;
             }
         }
+        if (retval >= 0) {
+            SetDrawCommandDataSize(renderer, cmd, vertex_data_used);
+        }
     }
     return retval;
 }
@@ -627,6 +845,7 @@ static int QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
     int retval = -1;
     cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_GEOMETRY, texture);
     if (cmd) {
+        const size_t vertex_data_used = renderer->vertex_data_used;
         retval = renderer->QueueGeometry(renderer, cmd, texture,
                                          xy, xy_stride,
                                          color, color_stride, uv, uv_stride,
@@ -634,6 +853,8 @@ static int QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
                                          scale_x, scale_y);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            SetDrawCommandDataSize(renderer, cmd, vertex_data_used);
         }
     }
     return retval;
@@ -1253,6 +1474,188 @@ static SDL_ScaleMode SDL_GetScaleMode(void)
     }
 }
 
+/* Textures are packed with a border of 1 pixel repeating their edges, so
+ * filtering at the edges doesn't pick up the neighbouring textures. */
+#define SDL_TEXTURE_ATLAS_SIZE     1024
+#define SDL_TEXTURE_ATLAS_MAX_SIZE 128
+#define SDL_TEXTURE_ATLAS_BORDER   1
+
+static SDL_bool AllocateAtlasRect(SDL_TextureAtlas *atlas, int w, int h, SDL_Point *position)
+{
+    const int atlas_w = atlas->texture->w;
+    const int atlas_h = atlas->texture->h;
+    int i, best = -1;
+
+    /* Prefer the lowest shelf the texture fits on, without wasting more than half of it */
+    for (i = 0; i < atlas->num_shelves; ++i) {
+        if (atlas->shelves[i].h >= h && atlas->shelves[i].h <= 2 * h &&
+            atlas->shelves[i].used + w <= atlas_w &&
+            (best < 0 || atlas->shelves[i].h < atlas->shelves[best].h)) {
+            best = i;
+        }
+    }
+
+    if (best < 0 && atlas->num_shelves < SDL_TEXTURE_ATLAS_MAX_SHELVES) {
+        const int y = atlas->num_shelves ? atlas->shelves[atlas->num_shelves - 1].y + atlas->shelves[atlas->num_shelves - 1].h : 0;
+        if (y + h <= atlas_h) {
+            best = atlas->num_shelves++;
+            atlas->shelves[best].y = y;
+            atlas->shelves[best].h = h;
+            atlas->shelves[best].used = 0;
+        }
+    }
+
+    if (best < 0) {
+        /* Any shelf with room left will do */
+        for (i = 0; i < atlas->num_shelves; ++i) {
+            if (atlas->shelves[i].h >= h && atlas->shelves[i].used + w <= atlas_w &&
+                (best < 0 || atlas->shelves[i].h < atlas->shelves[best].h)) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            return SDL_FALSE;
+        }
+    }
+
+    position->x = atlas->shelves[best].used;
+    position->y = atlas->shelves[best].y;
+    atlas->shelves[best].used += w;
+    return SDL_TRUE;
+}
+
+static SDL_bool AddTextureToAtlas(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    const int w = texture->w + 2 * SDL_TEXTURE_ATLAS_BORDER;
+    const int h = texture->h + 2 * SDL_TEXTURE_ATLAS_BORDER;
+    SDL_TextureAtlas *atlas;
+    SDL_Point position;
+
+    for (atlas = renderer->atlases; atlas; atlas = atlas->next) {
+        if (atlas->texture->format == texture->format && AllocateAtlasRect(atlas, w, h, &position)) {
+            break;
+        }
+    }
+
+    if (!atlas) {
+        int atlas_w = SDL_TEXTURE_ATLAS_SIZE;
+        int atlas_h = SDL_TEXTURE_ATLAS_SIZE;
+
+        if (renderer->info.max_texture_width) {
+            atlas_w = SDL_min(atlas_w, renderer->info.max_texture_width);
+        }
+        if (renderer->info.max_texture_height) {
+            atlas_h = SDL_min(atlas_h, renderer->info.max_texture_height);
+        }
+        if (w > atlas_w || h > atlas_h) {
+            return SDL_FALSE;
+        }
+
+        atlas = (SDL_TextureAtlas *)SDL_calloc(1, sizeof(*atlas));
+        if (!atlas) {
+            return SDL_FALSE;
+        }
+        atlas->texture = SDL_CreateTexture(renderer, texture->format, SDL_TEXTUREACCESS_STATIC, atlas_w, atlas_h);
+        if (!atlas->texture) {
+            SDL_free(atlas);
+            return SDL_FALSE;
+        }
+        AllocateAtlasRect(atlas, w, h, &position);
+        atlas->next = renderer->atlases;
+        renderer->atlases = atlas;
+    }
+
+    ++atlas->num_textures;
+    texture->atlas = atlas;
+    texture->atlas_rect.x = position.x + SDL_TEXTURE_ATLAS_BORDER;
+    texture->atlas_rect.y = position.y + SDL_TEXTURE_ATLAS_BORDER;
+    texture->atlas_rect.w = texture->w;
+    texture->atlas_rect.h = texture->h;
+    return SDL_TRUE;
+}
+
+static void RemoveTextureFromAtlas(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer = texture->renderer;
+    SDL_TextureAtlas *atlas = texture->atlas;
+
+    texture->atlas = NULL;
+    if (--atlas->num_textures == 0) {
+        SDL_TextureAtlas **link = &renderer->atlases;
+        while (*link != atlas) {
+            link = &(*link)->next;
+        }
+        *link = atlas->next;
+
+        SDL_DestroyTexture(atlas->texture);
+        SDL_free(atlas);
+    }
+}
+
+/* Use the atlas texture to draw a texture packed into it */
+static SDL_Texture *PrepareAtlasDraw(SDL_Texture *texture)
+{
+    SDL_Texture *atlas = texture->atlas->texture;
+
+    atlas->color = texture->color;
+    atlas->modMode = texture->modMode;
+    atlas->blendMode = texture->blendMode;
+    if (atlas->scaleMode != texture->scaleMode) {
+        /* Anything already queued is drawn with the previous scale mode */
+        FlushRenderCommandsIfTextureNeeded(atlas);
+        SDL_SetTextureScaleMode(atlas, texture->scaleMode);
+    }
+    return atlas;
+}
+
+static int SDL_UpdateTextureAtlas(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch)
+{
+    const int bpp = SDL_BYTESPERPIXEL(texture->format);
+    const int left = (rect->x == 0) ? SDL_TEXTURE_ATLAS_BORDER : 0;
+    const int top = (rect->y == 0) ? SDL_TEXTURE_ATLAS_BORDER : 0;
+    const int right = (rect->x + rect->w == texture->w) ? SDL_TEXTURE_ATLAS_BORDER : 0;
+    const int bottom = (rect->y + rect->h == texture->h) ? SDL_TEXTURE_ATLAS_BORDER : 0;
+    SDL_Rect atlas_rect;
+    Uint8 *padded;
+    int padded_pitch, x, y, retval;
+
+    atlas_rect.x = texture->atlas_rect.x + rect->x - left;
+    atlas_rect.y = texture->atlas_rect.y + rect->y - top;
+    atlas_rect.w = rect->w + left + right;
+    atlas_rect.h = rect->h + top + bottom;
+
+    if (!left && !top && !right && !bottom) {
+        return SDL_UpdateTexture(texture->atlas->texture, &atlas_rect, pixels, pitch);
+    }
+
+    /* Repeat the edges of the texture into its border */
+    padded_pitch = atlas_rect.w * bpp;
+    padded = (Uint8 *)SDL_malloc((size_t)padded_pitch * atlas_rect.h);
+    if (!padded) {
+        return SDL_OutOfMemory();
+    }
+    for (y = 0; y < atlas_rect.h; ++y) {
+        const int src_y = SDL_clamp(y - top, 0, rect->h - 1);
+        const Uint8 *src = (const Uint8 *)pixels + (size_t)src_y * pitch;
+        Uint8 *dst = padded + (size_t)y * padded_pitch;
+
+        for (x = 0; x < left; ++x) {
+            SDL_memcpy(dst, src, bpp);
+            dst += bpp;
+        }
+        SDL_memcpy(dst, src, (size_t)rect->w * bpp);
+        dst += (size_t)rect->w * bpp;
+        for (x = 0; x < right; ++x) {
+            SDL_memcpy(dst, src + (size_t)(rect->w - 1) * bpp, bpp);
+            dst += bpp;
+        }
+    }
+    retval = SDL_UpdateTexture(texture->atlas->texture, &atlas_rect, padded, padded_pitch);
+    SDL_free(padded);
+
+    return retval;
+}
+
 SDL_Texture *SDL_CreateTexture(SDL_Renderer *renderer, Uint32 format, int access, int w, int h)
 {
     SDL_Texture *texture;
@@ -1298,6 +1701,29 @@ SDL_Texture *SDL_CreateTexture(SDL_Renderer *renderer, Uint32 format, int access
     texture->color.a = 255;
     texture->scaleMode = SDL_GetScaleMode();
     texture->renderer = renderer;
+
+    /* Add the texture to an atlas before it's in the list of textures, so
+     * it's always destroyed before its atlas. */
+    if (access == SDL_TEXTUREACCESS_STATIC &&
+        w <= SDL_TEXTURE_ATLAS_MAX_SIZE && h <= SDL_TEXTURE_ATLAS_MAX_SIZE &&
+        !SDL_ISPIXELFORMAT_FOURCC(format) && !SDL_ISPIXELFORMAT_INDEXED(format) &&
+        IsSupportedFormat(renderer, format) &&
+        SDL_GetHintBoolean(SDL_HINT_RENDER_TEXTURE_ATLAS, SDL_FALSE)) {
+        /* If there's no room, the texture just gets created on its own, so
+           don't leave the atlas error behind. */
+        const char *error = SDL_GetError();
+        char *saved_error = *error ? SDL_strdup(error) : NULL;
+
+        if (!AddTextureToAtlas(renderer, texture)) {
+            if (saved_error) {
+                SDL_SetError("%s", saved_error);
+            } else {
+                SDL_ClearError();
+            }
+        }
+        SDL_free(saved_error);
+    }
+
     texture->next = renderer->textures;
     if (renderer->textures) {
         renderer->textures->prev = texture;
@@ -1307,7 +1733,9 @@ SDL_Texture *SDL_CreateTexture(SDL_Renderer *renderer, Uint32 format, int access
     /* FOURCC format cannot be used directly by renderer back-ends for target texture */
     texture_is_fourcc_and_target = (access == SDL_TEXTUREACCESS_TARGET && SDL_ISPIXELFORMAT_FOURCC(texture->format));
 
-    if (texture_is_fourcc_and_target == SDL_FALSE && IsSupportedFormat(renderer, format)) {
+    if (texture->atlas) {
+        /* The pixels are stored in the atlas texture */
+    } else if (texture_is_fourcc_and_target == SDL_FALSE && IsSupportedFormat(renderer, format)) {
         if (renderer->CreateTexture(renderer, texture) < 0) {
             SDL_DestroyTexture(texture);
             return NULL;
@@ -1636,7 +2064,7 @@ int SDL_SetTextureScaleMode(SDL_Texture *texture, SDL_ScaleMode scaleMode)
     texture->scaleMode = scaleMode;
     if (texture->native) {
         return SDL_SetTextureScaleMode(texture->native, scaleMode);
-    } else {
+    } else if (!texture->atlas) {
         renderer->SetTextureScaleMode(renderer, texture, scaleMode);
     }
     return 0;
@@ -1786,12 +2214,18 @@ int SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect,
 #endif
     } else if (texture->native) {
         return SDL_UpdateTextureNative(texture, &real_rect, pixels, pitch);
+    } else if (texture->atlas) {
+        return SDL_UpdateTextureAtlas(texture, &real_rect, pixels, pitch);
     } else {
         SDL_Renderer *renderer = texture->renderer;
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
             return -1;
         }
-        return renderer->UpdateTexture(renderer, texture, &real_rect, pixels, pitch);
+        if (renderer->UpdateTexture(renderer, texture, &real_rect, pixels, pitch) < 0) {
+            return -1;
+        }
+        CountTextureUpload(texture, &real_rect);
+        return 0;
     }
 }
 
@@ -1956,7 +2390,11 @@ int SDL_UpdateYUVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
                 return -1;
             }
-            return renderer->UpdateTextureYUV(renderer, texture, &real_rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
+            if (renderer->UpdateTextureYUV(renderer, texture, &real_rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch) < 0) {
+                return -1;
+            }
+            CountTextureUpload(texture, &real_rect);
+            return 0;
         } else {
             return SDL_Unsupported();
         }
@@ -1990,8 +2428,10 @@ int SDL_UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect,
     }
 
     if (texture->format != SDL_PIXELFORMAT_NV12 &&
-        texture->format != SDL_PIXELFORMAT_NV21) {
-        return SDL_SetError("Texture format must by NV12 or NV21");
+        texture->format != SDL_PIXELFORMAT_NV21 &&
+        texture->format != SDL_PIXELFORMAT_P010 &&
+        texture->format != SDL_PIXELFORMAT_P016) {
+        return SDL_SetError("Texture format must by NV12, NV21, P010 or P016");
     }
 
     real_rect.x = 0;
@@ -2016,7 +2456,11 @@ int SDL_UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
                 return -1;
             }
-            return renderer->UpdateTextureNV(renderer, texture, &real_rect, Yplane, Ypitch, UVplane, UVpitch);
+            if (renderer->UpdateTextureNV(renderer, texture, &real_rect, Yplane, Ypitch, UVplane, UVpitch) < 0) {
+                return -1;
+            }
+            CountTextureUpload(texture, &real_rect);
+            return 0;
         } else {
             return SDL_Unsupported();
         }
@@ -2080,6 +2524,7 @@ int SDL_LockTexture(SDL_Texture *texture, const SDL_Rect *rect,
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
             return -1;
         }
+        texture->locked_rect = *rect; /* counted as uploaded on unlock */
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -2178,6 +2623,7 @@ void SDL_UnlockTexture(SDL_Texture *texture)
     } else {
         SDL_Renderer *renderer = texture->renderer;
         renderer->UnlockTexture(renderer, texture);
+        CountTextureUpload(texture, &texture->locked_rect);
     }
 
     SDL_FreeSurface(texture->locked_surface);
@@ -3448,6 +3894,10 @@ int SDL_RenderCopyF(SDL_Renderer *renderer, SDL_Texture *texture,
 
     if (texture->native) {
         texture = texture->native;
+    } else if (texture->atlas) {
+        real_srcrect.x += texture->atlas_rect.x;
+        real_srcrect.y += texture->atlas_rect.y;
+        texture = PrepareAtlasDraw(texture);
     }
 
     texture->last_command_generation = renderer->render_command_generation;
@@ -3587,6 +4037,10 @@ int SDL_RenderCopyExF(SDL_Renderer *renderer, SDL_Texture *texture,
 
     if (texture->native) {
         texture = texture->native;
+    } else if (texture->atlas) {
+        real_srcrect.x += texture->atlas_rect.x;
+        real_srcrect.y += texture->atlas_rect.y;
+        texture = PrepareAtlasDraw(texture);
     }
 
     if (center) {
@@ -4082,6 +4536,8 @@ int SDL_RenderGeometryRaw(SDL_Renderer *renderer,
     int i;
     int retval = 0;
     int count = indices ? num_indices : num_vertices;
+    float *atlas_uv = NULL;
+    SDL_bool isstack = SDL_FALSE;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
@@ -4163,24 +4619,52 @@ int SDL_RenderGeometryRaw(SDL_Renderer *renderer,
         }
     }
 
+    if (texture && texture->atlas) {
+        /* Map the texture coordinates into the atlas texture */
+        const SDL_Texture *atlas = texture->atlas->texture;
+        const float x = (float)texture->atlas_rect.x;
+        const float y = (float)texture->atlas_rect.y;
+        const float w = (float)texture->w;
+        const float h = (float)texture->h;
+
+        atlas_uv = SDL_small_alloc(float, num_vertices * 2, &isstack);
+        if (!atlas_uv) {
+            return SDL_OutOfMemory();
+        }
+        for (i = 0; i < num_vertices; ++i) {
+            const float *uv_ = (const float *)((const char *)uv + i * uv_stride);
+            atlas_uv[i * 2 + 0] = (x + uv_[0] * w) / (float)atlas->w;
+            atlas_uv[i * 2 + 1] = (y + uv_[1] * h) / (float)atlas->h;
+        }
+        uv = atlas_uv;
+        uv_stride = 2 * sizeof(float);
+        texture = PrepareAtlasDraw(texture);
+    }
+
     if (texture) {
         texture->last_command_generation = renderer->render_command_generation;
     }
 
-    /* For the software renderer, try to reinterpret triangles as SDL_Rect */
     if (renderer->info.flags & SDL_RENDERER_SOFTWARE) {
-        return SDL_SW_RenderGeometryRaw(renderer, texture,
-                                        xy, xy_stride, color, color_stride, uv, uv_stride, num_vertices,
-                                        indices, num_indices, size_indices);
+        /* For the software renderer, try to reinterpret triangles as SDL_Rect */
+        retval = SDL_SW_RenderGeometryRaw(renderer, texture,
+                                          xy, xy_stride, color, color_stride, uv, uv_stride, num_vertices,
+                                          indices, num_indices, size_indices);
+    } else {
+        retval = QueueCmdGeometry(renderer, texture,
+                                  xy, xy_stride, color, color_stride, uv, uv_stride,
+                                  num_vertices,
+                                  indices, num_indices, size_indices,
+                                  renderer->scale.x, renderer->scale.y);
+        if (retval >= 0) {
+            retval = FlushRenderCommandsIfNotBatching(renderer);
+        }
     }
 
-    retval = QueueCmdGeometry(renderer, texture,
-                              xy, xy_stride, color, color_stride, uv, uv_stride,
-                              num_vertices,
-                              indices, num_indices, size_indices,
-                              renderer->scale.x, renderer->scale.y);
-
-    return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
+    if (atlas_uv) {
+        SDL_small_free(atlas_uv, isstack);
+    }
+    return retval;
 }
 
 int SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
@@ -4255,11 +4739,13 @@ static void SDL_RenderSimulateVSync(SDL_Renderer *renderer)
 void SDL_RenderPresent(SDL_Renderer *renderer)
 {
     SDL_bool presented = SDL_TRUE;
+    Uint64 start;
 
     CHECK_RENDERER_MAGIC(renderer, );
 
     FlushRenderCommands(renderer); /* time to send everything to the GPU! */
 
+    start = SDL_GetPerformanceCounter();
 #if DONT_DRAW_WHILE_HIDDEN
     /* Don't present while we're hidden */
     if (renderer->hidden) {
@@ -4269,6 +4755,12 @@ void SDL_RenderPresent(SDL_Renderer *renderer)
         if (renderer->RenderPresent(renderer) < 0) {
         presented = SDL_FALSE;
     }
+    renderer->stats.present_time_ns += PerformanceCounterToNS(SDL_GetPerformanceCounter() - start);
+
+    /* This frame is done, start counting the next one */
+    renderer->stats.frames_presented = renderer->last_frame_stats.frames_presented + 1;
+    renderer->last_frame_stats = renderer->stats;
+    SDL_zero(renderer->stats);
 
     if (renderer->simulate_vsync ||
         (!presented && renderer->wanted_vsync)) {
@@ -4276,6 +4768,17 @@ void SDL_RenderPresent(SDL_Renderer *renderer)
     }
 }
 
+int SDL_RenderGetStats(SDL_Renderer *renderer, SDL_RenderStats *stats)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    *stats = renderer->last_frame_stats;
+    return 0;
+}
+
 void SDL_DestroyTexture(SDL_Texture *texture)
 {
     SDL_Renderer *renderer;
@@ -4303,6 +4806,9 @@ void SDL_DestroyTexture(SDL_Texture *texture)
     if (texture->native) {
         SDL_DestroyTexture(texture->native);
     }
+    if (texture->atlas) {
+        RemoveTextureFromAtlas(texture);
+    }
 #if SDL_HAVE_YUV
     if (texture->yuv) {
         SDL_SW_DestroyYUVTexture(texture->yuv);
@@ -4376,6 +4882,8 @@ int SDL_GL_BindTexture(SDL_Texture *texture, float *texw, float *texh)
     renderer = texture->renderer;
     if (texture->native) {
         return SDL_GL_BindTexture(texture->native, texw, texh);
+    } else if (texture->atlas) {
+        return SDL_SetError("Texture is packed into a texture atlas, see SDL_HINT_RENDER_TEXTURE_ATLAS");
     } else if (renderer && renderer->GL_BindTexture) {
         FlushRenderCommandsIfTextureNeeded(texture); /* in case the app is going to mess with it. */
         return renderer->GL_BindTexture(renderer, texture, texw, texh);
@@ -4392,6 +4900,8 @@ int SDL_GL_UnbindTexture(SDL_Texture *texture)
     renderer = texture->renderer;
     if (texture->native) {
         return SDL_GL_UnbindTexture(texture->native);
+    } else if (texture->atlas) {
+        return SDL_SetError("Texture is packed into a texture atlas, see SDL_HINT_RENDER_TEXTURE_ATLAS");
     } else if (renderer && renderer->GL_UnbindTexture) {
         FlushRenderCommandsIfTextureNeeded(texture); /* in case the app messed with it. */
         return renderer->GL_UnbindTexture(renderer, texture);
@@ -48,6 +48,25 @@ typedef struct SDL_DRect
 
 typedef struct SDL_RenderDriver SDL_RenderDriver;
 
+#define SDL_TEXTURE_ATLAS_MAX_SHELVES 64
+
+/* A texture that small static textures are packed into, see SDL_HINT_RENDER_TEXTURE_ATLAS */
+typedef struct SDL_TextureAtlas
+{
+    SDL_Texture *texture;
+    int num_textures; /**< The number of textures packed into the atlas, it's destroyed when this drops to 0 */
+
+    /* Textures are packed left to right on shelves, space isn't reused until the atlas is empty */
+    int num_shelves;
+    struct
+    {
+        int y, h;
+        int used;
+    } shelves[SDL_TEXTURE_ATLAS_MAX_SHELVES];
+
+    struct SDL_TextureAtlas *next;
+} SDL_TextureAtlas;
+
 /* Define the SDL texture structure */
 struct SDL_Texture
 {
@@ -71,6 +90,10 @@ struct SDL_Texture
     SDL_Rect locked_rect;
     SDL_Surface *locked_surface; /**< Locked region exposed as a SDL surface */
 
+    /* Support for small static textures sharing one texture */
+    SDL_TextureAtlas *atlas;
+    SDL_Rect atlas_rect; /**< The area of the atlas texture holding this texture's pixels */
+
     Uint32 last_command_generation; /* last command queue generation this texture was in. */
 
     void *driverdata; /**< Driver specific texture representation */
@@ -117,6 +140,7 @@ typedef struct SDL_RenderCommand
             Uint8 r, g, b, a;
             SDL_BlendMode blend;
             SDL_Texture *texture;
+            size_t datasize; /* bytes of vertex data at 'first', 0 if the command can't be merged with the next one. */
         } draw;
         struct
         {
@@ -258,6 +282,7 @@ struct SDL_Renderer
 
     /* The list of textures */
     SDL_Texture *textures;
+    SDL_TextureAtlas *atlases;
     SDL_Texture *target;
     SDL_mutex *target_mutex;
 
@@ -282,6 +307,9 @@ struct SDL_Renderer
     size_t vertex_data_used;
     size_t vertex_data_allocation;
 
+    SDL_RenderStats stats;            /**< Statistics of the frame being drawn, backends count draw_calls */
+    SDL_RenderStats last_frame_stats; /**< Statistics of the last presented frame */
+
     void *driverdata;
 };
 
@@ -40,6 +40,8 @@ SDL_SW_YUVTexture *SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
     case SDL_PIXELFORMAT_YVYU:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
         break;
     default:
         SDL_SetError("Unsupported YUV format");
@@ -97,6 +99,14 @@ SDL_SW_YUVTexture *SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
         swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
         break;
 
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        swdata->pitches[0] = w * 2;
+        swdata->pitches[1] = 4 * ((w + 1) / 2);
+        swdata->planes[0] = swdata->pixels;
+        swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
+        break;
+
     default:
         SDL_assert(0 && "We should never get here (caught above)");
         break;
@@ -215,7 +225,35 @@ int SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect,
                 dst += 2 * ((swdata->w + 1) / 2);
             }
         }
-    }
+    } break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+    {
+        const Uint8 *src;
+        Uint8 *dst;
+        int row;
+        size_t length;
+
+        /* Copy the Y plane */
+        src = (const Uint8 *)pixels;
+        dst = swdata->planes[0] + rect->y * swdata->pitches[0] + rect->x * 2;
+        length = (size_t)rect->w * 2;
+        for (row = 0; row < rect->h; ++row) {
+            SDL_memcpy(dst, src, length);
+            src += pitch;
+            dst += swdata->pitches[0];
+        }
+
+        /* Copy the UV plane, it follows the Y plane of the source rectangle */
+        src = (const Uint8 *)pixels + rect->h * pitch;
+        dst = swdata->planes[1] + (rect->y / 2) * swdata->pitches[1] + (rect->x / 2) * 4;
+        length = 4 * (((size_t)rect->w + 1) / 2);
+        for (row = 0; row < (rect->h + 1) / 2; ++row) {
+            SDL_memcpy(dst, src, length);
+            src += 4 * ((pitch + 3) / 4);
+            dst += swdata->pitches[1];
+        }
+    } break;
     }
     return 0;
 }
@@ -278,6 +316,8 @@ int SDL_SW_UpdateNVTexturePlanar(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect
                                  const Uint8 *Yplane, int Ypitch,
                                  const Uint8 *UVplane, int UVpitch)
 {
+    /* 1 byte per sample for NV12 and NV21, 2 for P010 and P016 */
+    const int sample_size = SDL_BYTESPERPIXEL(swdata->format);
     const Uint8 *src;
     Uint8 *dst;
     int row;
@@ -285,24 +325,22 @@ int SDL_SW_UpdateNVTexturePlanar(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect
 
     /* Copy the Y plane */
     src = Yplane;
-    dst = swdata->pixels + rect->y * swdata->w + rect->x;
-    length = rect->w;
+    dst = swdata->planes[0] + rect->y * swdata->pitches[0] + rect->x * sample_size;
+    length = (size_t)rect->w * sample_size;
     for (row = 0; row < rect->h; ++row) {
         SDL_memcpy(dst, src, length);
         src += Ypitch;
-        dst += swdata->w;
+        dst += swdata->pitches[0];
     }
 
     /* Copy the UV or VU plane */
     src = UVplane;
-    dst = swdata->pixels + swdata->h * swdata->w;
-    dst += rect->y * ((swdata->w + 1) / 2) + rect->x;
-    length = (rect->w + 1) / 2;
-    length *= 2;
+    dst = swdata->planes[1] + (rect->y / 2) * swdata->pitches[1] + (rect->x / 2) * 2 * sample_size;
+    length = (((size_t)rect->w + 1) / 2) * 2 * sample_size;
     for (row = 0; row < (rect->h + 1) / 2; ++row) {
         SDL_memcpy(dst, src, length);
         src += UVpitch;
-        dst += 2 * ((swdata->w + 1) / 2);
+        dst += swdata->pitches[1];
     }
 
     return 0;
@@ -316,8 +354,10 @@ int SDL_SW_LockYUVTexture(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect,
     case SDL_PIXELFORMAT_IYUV:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
         if (rect && (rect->x != 0 || rect->y != 0 || rect->w != swdata->w || rect->h != swdata->h)) {
-            return SDL_SetError("YV12, IYUV, NV12, NV21 textures only support full surface locks");
+            return SDL_SetError("YV12, IYUV, NV12, NV21, P010, P016 textures only support full surface locks");
         }
         break;
     }
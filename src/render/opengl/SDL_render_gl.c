@@ -1290,6 +1290,7 @@ static int GL_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                 if (count > 2) {
                     /* joined lines cannot be grouped */
                     data->glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)count);
+                    renderer->stats.draw_calls++;
                 } else {
                     /* let's group non joined lines */
                     SDL_RenderCommand *finalcmd = cmd;
@@ -1312,6 +1313,7 @@ static int GL_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                     }
 
                     data->glDrawArrays(GL_LINES, 0, (GLsizei)count);
+                    renderer->stats.draw_calls++;
                     cmd = finalcmd; /* skip any copy commands we just combined in here. */
                 }
             }
@@ -1372,6 +1374,7 @@ static int GL_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
                 }
 
                 data->glDrawArrays(op, 0, (GLsizei)count);
+                renderer->stats.draw_calls++;
 
                 /* Restore previously set color when we're done. */
                 if (thiscmdtype != SDL_RENDERCMD_DRAW_POINTS) {
@@ -22,13 +22,19 @@
 
 #if SDL_VIDEO_RENDER_OGL_ES2
 
+#include "SDL_filesystem.h"
 #include "SDL_hints.h"
+#include "SDL_timer.h"
 #include "../../video/SDL_sysvideo.h" /* For SDL_GL_SwapWindowWithResult */
 #include "SDL_opengles2.h"
 #include "../SDL_sysrender.h"
 #include "../../video/SDL_blit.h"
 #include "SDL_shaders_gles2.h"
 
+#if defined(__WIN32__) || defined(__WINRT__)
+#include "../../core/windows/SDL_windows.h"
+#endif
+
 /* WebGL doesn't offer client-side arrays, so use Vertex Buffer Objects
    on Emscripten, which converts GLES2 into WebGL calls.
    In all other cases, attempt to use client-side arrays, as they tend to
@@ -80,8 +86,8 @@ typedef struct GLES2_TextureData
 typedef struct GLES2_ProgramCacheEntry
 {
     GLuint id;
-    GLuint vertex_shader;
-    GLuint fragment_shader;
+    GLES2_ShaderType vertex_type;
+    GLES2_ShaderType fragment_type;
     GLuint uniform_locations[16];
     GLfloat projection[4][4];
     struct GLES2_ProgramCacheEntry *prev;
@@ -95,6 +101,18 @@ typedef struct GLES2_ProgramCache
     GLES2_ProgramCacheEntry *tail;
 } GLES2_ProgramCache;
 
+/* The header of a program binary saved in the program binary cache */
+typedef struct GLES2_ProgramBinaryHeader
+{
+    Uint32 magic;
+    Uint32 driver_hash;
+    Uint32 source_hash;
+    Uint32 format;
+    Uint32 length;
+} GLES2_ProgramBinaryHeader;
+
+#define GLES2_PROGRAM_BINARY_MAGIC 0x50324C53 /* "SL2P" */
+
 typedef enum
 {
     GLES2_ATTRIBUTE_POSITION = 0,
@@ -160,6 +178,10 @@ typedef struct GLES2_RenderData
     GLuint shader_id_cache[GLES2_SHADER_COUNT];
 
     GLES2_ProgramCache program_cache;
+    char *program_binary_path; /* NULL if program binaries aren't cached */
+    Uint32 program_binary_driver_hash;
+    PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinaryOES;
+    PFNGLPROGRAMBINARYOESPROC glProgramBinaryOES;
     Uint8 clear_r, clear_g, clear_b, clear_a;
 
 #if USE_VERTEX_BUFFER_OBJECTS
@@ -396,15 +418,197 @@ static SDL_bool GLES2_SupportsBlendMode(SDL_Renderer *renderer, SDL_BlendMode bl
     return SDL_TRUE;
 }
 
-static GLES2_ProgramCacheEntry *GLES2_CacheProgram(GLES2_RenderData *data, GLuint vertex, GLuint fragment)
+static GLuint GLES2_CacheShader(GLES2_RenderData *data, GLES2_ShaderType type, GLenum shader_type);
+
+static void GLES2_InitProgramBinaryCache(GLES2_RenderData *data)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_OPENGLES2_PROGRAM_CACHE);
+    const GLenum names[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+    GLint num_formats = 0;
+    Uint32 hash = 0;
+    int i;
+
+    if (!hint || !*hint || SDL_strcmp(hint, "0") == 0) {
+        return;
+    }
+    if (!SDL_GL_ExtensionSupported("GL_OES_get_program_binary")) {
+        return;
+    }
+    data->glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS_OES, &num_formats);
+    if (num_formats <= 0) {
+        return; /* the driver can't save programs, even with the extension */
+    }
+    data->glGetProgramBinaryOES = (PFNGLGETPROGRAMBINARYOESPROC)SDL_GL_GetProcAddress("glGetProgramBinaryOES");
+    data->glProgramBinaryOES = (PFNGLPROGRAMBINARYOESPROC)SDL_GL_GetProcAddress("glProgramBinaryOES");
+    if (!data->glGetProgramBinaryOES || !data->glProgramBinaryOES) {
+        return;
+    }
+
+    /* Program binaries can only be loaded by the driver that saved them */
+    for (i = 0; i < SDL_arraysize(names); ++i) {
+        const char *string = (const char *)data->glGetString(names[i]);
+        if (string) {
+            hash = SDL_crc32(hash, string, SDL_strlen(string) + 1);
+        }
+    }
+    data->program_binary_driver_hash = hash;
+
+    if (SDL_strcmp(hint, "1") == 0) {
+        data->program_binary_path = SDL_GetPrefPath("libsdl", "gles2_programs");
+    } else {
+        data->program_binary_path = SDL_strdup(hint);
+    }
+}
+
+static Uint32 GLES2_GetProgramSourceHash(GLES2_RenderData *data, GLES2_ShaderType vtype, GLES2_ShaderType ftype)
+{
+    const char *sources[5];
+    Uint32 hash = 0;
+    int i;
+
+    sources[0] = GLES2_GetShaderPrologue(vtype);
+    sources[1] = GLES2_GetShader(vtype);
+    sources[2] = GLES2_GetShaderPrologue(ftype);
+    sources[3] = GLES2_GetShaderInclude(data->texcoord_precision_hint);
+    sources[4] = GLES2_GetShader(ftype);
+    for (i = 0; i < SDL_arraysize(sources); ++i) {
+        if (sources[i]) {
+            hash = SDL_crc32(hash, sources[i], SDL_strlen(sources[i]) + 1);
+        }
+    }
+    return hash;
+}
+
+static GLuint GLES2_LoadProgramBinary(GLES2_RenderData *data, const char *file, Uint32 source_hash)
+{
+    const GLES2_ProgramBinaryHeader *header;
+    GLint linkSuccessful = GL_FALSE;
+    GLuint id = 0;
+    size_t size = 0;
+    void *contents;
+
+    contents = SDL_LoadFile(file, &size);
+    if (!contents) {
+        return 0;
+    }
+
+    header = (const GLES2_ProgramBinaryHeader *)contents;
+    if (size >= sizeof(*header) &&
+        header->magic == GLES2_PROGRAM_BINARY_MAGIC &&
+        header->driver_hash == data->program_binary_driver_hash &&
+        header->source_hash == source_hash &&
+        header->length == size - sizeof(*header)) {
+        id = data->glCreateProgram();
+        data->glProgramBinaryOES(id, header->format, header + 1, header->length);
+        data->glGetProgramiv(id, GL_LINK_STATUS, &linkSuccessful);
+        if (!linkSuccessful) {
+            /* The driver rejected the binary, it will be compiled and saved again */
+            data->glDeleteProgram(id);
+            while (data->glGetError() != GL_NO_ERROR) {
+                /* continue; */
+            }
+            id = 0;
+        } else {
+            SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Loaded program binary %s", file);
+        }
+    }
+    SDL_free(contents);
+
+    return id;
+}
+
+/* Move a file over another one, replacing it in one step */
+static int GLES2_ReplaceFile(const char *src, const char *dst)
+{
+#if defined(__WIN32__) || defined(__WINRT__)
+    LPTSTR tsrc = WIN_UTF8ToString(src);
+    LPTSTR tdst = WIN_UTF8ToString(dst);
+    BOOL moved = FALSE;
+
+    if (tsrc && tdst) {
+        moved = MoveFileEx(tsrc, tdst, MOVEFILE_REPLACE_EXISTING);
+    }
+    SDL_free(tsrc);
+    SDL_free(tdst);
+    return moved ? 0 : -1;
+#elif defined(HAVE_STDIO_H)
+    return rename(src, dst);
+#else
+    return -1;
+#endif
+}
+
+static void GLES2_RemoveFile(const char *file)
+{
+#if defined(__WIN32__) || defined(__WINRT__)
+    LPTSTR tfile = WIN_UTF8ToString(file);
+
+    if (tfile) {
+        DeleteFile(tfile);
+        SDL_free(tfile);
+    }
+#elif defined(HAVE_STDIO_H)
+    remove(file);
+#endif
+}
+
+static void GLES2_SaveProgramBinary(GLES2_RenderData *data, GLuint id, const char *file, Uint32 source_hash)
+{
+    GLES2_ProgramBinaryHeader *header;
+    GLint length = 0;
+    GLsizei written = 0;
+    GLenum format = 0;
+    char *tmp_file;
+    SDL_RWops *rw;
+
+    data->glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH_OES, &length);
+    if (length <= 0) {
+        return;
+    }
+    header = (GLES2_ProgramBinaryHeader *)SDL_malloc(sizeof(*header) + length);
+    if (!header) {
+        return;
+    }
+
+    data->glGetProgramBinaryOES(id, length, &written, &format, header + 1);
+    if (written > 0) {
+        header->magic = GLES2_PROGRAM_BINARY_MAGIC;
+        header->driver_hash = data->program_binary_driver_hash;
+        header->source_hash = source_hash;
+        header->format = format;
+        header->length = (Uint32)written;
+
+        /* Write to a file of our own first, so other processes sharing the
+           cache never load a partially written binary */
+        if (SDL_asprintf(&tmp_file, "%s.%08" SDL_PRIx32 ".tmp", file,
+                         (Uint32)SDL_ThreadID() ^ (Uint32)SDL_GetPerformanceCounter()) >= 0) {
+            rw = SDL_RWFromFile(tmp_file, "wb");
+            if (rw) {
+                const SDL_bool complete = (SDL_RWwrite(rw, header, sizeof(*header) + written, 1) == 1);
+                if (SDL_RWclose(rw) == 0 && complete && GLES2_ReplaceFile(tmp_file, file) == 0) {
+                    SDL_LogDebug(SDL_LOG_CATEGORY_RENDER, "Saved program binary %s", file);
+                } else {
+                    GLES2_RemoveFile(tmp_file);
+                }
+            }
+            SDL_free(tmp_file);
+        }
+    }
+    SDL_free(header);
+}
+
+static GLES2_ProgramCacheEntry *GLES2_CacheProgram(GLES2_RenderData *data, GLES2_ShaderType vtype, GLES2_ShaderType ftype)
 {
     GLES2_ProgramCacheEntry *entry;
+    GLuint vertex, fragment;
     GLint linkSuccessful;
+    Uint32 source_hash = 0;
+    char *binary_file = NULL;
 
     /* Check if we've already cached this program */
     entry = data->program_cache.head;
     while (entry) {
-        if (entry->vertex_shader == vertex && entry->fragment_shader == fragment) {
+        if (entry->vertex_type == vtype && entry->fragment_type == ftype) {
             break;
         }
         entry = entry->next;
@@ -431,24 +635,57 @@ static GLES2_ProgramCacheEntry *GLES2_CacheProgram(GLES2_RenderData *data, GLuin
         SDL_OutOfMemory();
         return NULL;
     }
-    entry->vertex_shader = vertex;
-    entry->fragment_shader = fragment;
-
-    /* Create the program and link it */
-    entry->id = data->glCreateProgram();
-    data->glAttachShader(entry->id, vertex);
-    data->glAttachShader(entry->id, fragment);
-    data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_POSITION, "a_position");
-    data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_COLOR, "a_color");
-    data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_TEXCOORD, "a_texCoord");
-    data->glLinkProgram(entry->id);
-    data->glGetProgramiv(entry->id, GL_LINK_STATUS, &linkSuccessful);
-    if (!linkSuccessful) {
-        data->glDeleteProgram(entry->id);
-        SDL_free(entry);
-        SDL_SetError("Failed to link shader program");
-        return NULL;
+    entry->vertex_type = vtype;
+    entry->fragment_type = ftype;
+
+    /* Try the program binary cache first, it saves compiling the shaders */
+    if (data->program_binary_path) {
+        source_hash = GLES2_GetProgramSourceHash(data, vtype, ftype);
+        if (SDL_asprintf(&binary_file, "%sprogram_%08" SDL_PRIx32 ".bin", data->program_binary_path, source_hash) < 0) {
+            binary_file = NULL;
+        } else {
+            entry->id = GLES2_LoadProgramBinary(data, binary_file, source_hash);
+        }
+    }
+
+    if (!entry->id) {
+        /* Load the requested shaders */
+        vertex = data->shader_id_cache[(Uint32)vtype];
+        if (!vertex) {
+            vertex = GLES2_CacheShader(data, vtype, GL_VERTEX_SHADER);
+        }
+        fragment = data->shader_id_cache[(Uint32)ftype];
+        if (!fragment && vertex) {
+            fragment = GLES2_CacheShader(data, ftype, GL_FRAGMENT_SHADER);
+        }
+        if (!vertex || !fragment) {
+            SDL_free(binary_file);
+            SDL_free(entry);
+            return NULL;
+        }
+
+        /* Create the program and link it */
+        entry->id = data->glCreateProgram();
+        data->glAttachShader(entry->id, vertex);
+        data->glAttachShader(entry->id, fragment);
+        data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_POSITION, "a_position");
+        data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_COLOR, "a_color");
+        data->glBindAttribLocation(entry->id, GLES2_ATTRIBUTE_TEXCOORD, "a_texCoord");
+        data->glLinkProgram(entry->id);
+        data->glGetProgramiv(entry->id, GL_LINK_STATUS, &linkSuccessful);
+        if (!linkSuccessful) {
+            data->glDeleteProgram(entry->id);
+            SDL_free(binary_file);
+            SDL_free(entry);
+            SDL_SetError("Failed to link shader program");
+            return NULL;
+        }
+
+        if (binary_file) {
+            GLES2_SaveProgramBinary(data, entry->id, binary_file, source_hash);
+        }
     }
+    SDL_free(binary_file);
 
     /* Predetermine locations of uniform variables */
     entry->uniform_locations[GLES2_UNIFORM_PROJECTION] =
@@ -582,8 +819,6 @@ static int GLES2_CacheShaders(GLES2_RenderData *data)
 {
     int shader;
 
-    data->texcoord_precision_hint = GLES2_GetTexCoordPrecisionEnumFromHint();
-
     for (shader = 0; shader < GLES2_SHADER_FRAGMENT_TEXTURE_EXTERNAL_OES; ++shader) {
         GLenum shader_type;
 
@@ -601,8 +836,6 @@ static int GLES2_CacheShaders(GLES2_RenderData *data)
 
 static int GLES2_SelectProgram(GLES2_RenderData *data, GLES2_ImageSource source, int w, int h)
 {
-    GLuint vertex;
-    GLuint fragment;
     GLES2_ShaderType vtype, ftype;
     GLES2_ProgramCacheEntry *program;
 
@@ -689,32 +922,15 @@ static int GLES2_SelectProgram(GLES2_RenderData *data, GLES2_ImageSource source,
         goto fault;
     }
 
-    /* Load the requested shaders */
-    vertex = data->shader_id_cache[(Uint32)vtype];
-    if (!vertex) {
-        vertex = GLES2_CacheShader(data, vtype, GL_VERTEX_SHADER);
-        if (!vertex) {
-            goto fault;
-        }
-    }
-
-    fragment = data->shader_id_cache[(Uint32)ftype];
-    if (!fragment) {
-        fragment = GLES2_CacheShader(data, ftype, GL_FRAGMENT_SHADER);
-        if (!fragment) {
-            goto fault;
-        }
-    }
-
     /* Check if we need to change programs at all */
     if (data->drawstate.program &&
-        data->drawstate.program->vertex_shader == vertex &&
-        data->drawstate.program->fragment_shader == fragment) {
+        data->drawstate.program->vertex_type == vtype &&
+        data->drawstate.program->fragment_type == ftype) {
         return 0;
     }
 
     /* Generate a matching program */
-    program = GLES2_CacheProgram(data, vertex, fragment);
+    program = GLES2_CacheProgram(data, vtype, ftype);
     if (!program) {
         goto fault;
     }
@@ -1277,6 +1493,7 @@ static int GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
                 if (count > 2) {
                     /* joined lines cannot be grouped */
                     data->glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)count);
+                    renderer->stats.draw_calls++;
                 } else {
                     /* let's group non joined lines */
                     SDL_RenderCommand *finalcmd = cmd;
@@ -1299,6 +1516,7 @@ static int GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
                     }
 
                     data->glDrawArrays(GL_LINES, 0, (GLsizei)count);
+                    renderer->stats.draw_calls++;
                     cmd = finalcmd; /* skip any copy commands we just combined in here. */
                 }
             }
@@ -1342,6 +1560,7 @@ static int GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
                     op = GL_POINTS;
                 }
                 data->glDrawArrays(op, 0, (GLsizei)count);
+                renderer->stats.draw_calls++;
             }
 
             cmd = finalcmd; /* skip any copy commands we just combined in here. */
@@ -1386,6 +1605,7 @@ static void GLES2_DestroyRenderer(SDL_Renderer *renderer)
                 entry = next;
             }
         }
+        SDL_free(data->program_binary_path);
 
         if (data->context) {
             while (data->framebuffers) {
@@ -2105,7 +2325,11 @@ static SDL_Renderer *GLES2_CreateRenderer(SDL_Window *window, Uint32 flags)
         goto error;
     }
 
-    if (GLES2_CacheShaders(data) < 0) {
+    data->texcoord_precision_hint = GLES2_GetTexCoordPrecisionEnumFromHint();
+
+    /* With a program binary cache, shaders are only compiled for programs that aren't in it */
+    GLES2_InitProgramBinaryCache(data);
+    if (!data->program_binary_path && GLES2_CacheShaders(data) < 0) {
         SDL_GL_DeleteContext(data->context);
         SDL_free(renderer);
         SDL_free(data);
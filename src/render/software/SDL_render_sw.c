@@ -34,6 +34,9 @@
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
 #include "SDL_triangle.h"
+#include "../../thread/SDL_systhread.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_pixels_c.h"
 
 /* SDL surface based renderer implementation */
 
@@ -44,10 +47,59 @@ typedef struct
     SDL_bool surface_cliprect_dirty;
 } SW_DrawStateCache;
 
+/* With SDL_HINT_RENDER_SOFTWARE_THREADS, commands whose pixels don't depend
+   on the clip rect are binned into tiles, and the tiles are drawn in parallel
+   with each tile clipped to itself. Anything else is drawn on the calling
+   thread once the commands before it are done. */
+#define SW_TILE_WIDTH  256
+#define SW_TILE_HEIGHT 64
+
+typedef struct
+{
+    const SDL_RenderCommand *cmd;
+    void *vertices;
+    SDL_Rect clip;          /* the command's clip rect, inside the surface. */
+    SDL_Rect srcrect;       /* copies: source and destination, already clipped. */
+    SDL_Rect dstrect;
+    SDL_BlitInfo blitinfo;  /* copies: the texture's blit state when the command was binned. */
+    SDL_BlitFunc blitfunc;
+} SW_TileCommand;
+
+typedef struct
+{
+    int *commands; /* indices into SW_TileQueue::commands, in order. */
+    int num_commands;
+    int max_commands;
+} SW_TileBin;
+
+typedef struct
+{
+    SDL_WorkerPool *workers;
+    SDL_Surface *surface;
+    SW_TileCommand *commands;
+    int num_commands;
+    int max_commands;
+    SW_TileBin *bins;
+    int *active_bins; /* bins with commands in them. */
+    int num_active_bins;
+    int max_bins;
+    int tiles_x;
+    int tiles_y;
+} SW_TileQueue;
+
+/* Areas of the window surface drawn to since the last present. Overlapping
+   areas are merged, and once the list is full new areas are merged into the
+   rect they grow the least. */
+#define SW_MAX_DIRTY_RECTS 8
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    SW_TileQueue *tiles; /* NULL unless drawing with more than one thread. */
+    SDL_Rect dirty_rects[SW_MAX_DIRTY_RECTS];
+    int num_dirty_rects;
+    SDL_bool dirty_all; /* the whole window surface needs to be presented. */
 } SW_RenderData;
 
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
@@ -61,6 +113,7 @@ static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
         if (surface) {
             data->surface = data->window = surface;
+            data->dirty_all = SDL_TRUE;
         }
     }
     return data->surface;
@@ -73,6 +126,8 @@ static void SW_WindowEvent(SDL_Renderer *renderer, const SDL_WindowEvent *event)
     if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
         data->surface = NULL;
         data->window = NULL;
+    } else if (event->event == SDL_WINDOWEVENT_EXPOSED) {
+        data->dirty_all = SDL_TRUE;
     }
 }
 
@@ -636,30 +691,705 @@ static void PrepTextureForCopy(const SDL_RenderCommand *cmd)
     SDL_SetSurfaceBlendMode(surface, blend);
 }
 
+static void GetDrawStateClipRect(const SW_DrawStateCache *drawstate, SDL_Rect *rect)
+{
+    const SDL_Rect *viewport = drawstate->viewport;
+    const SDL_Rect *cliprect = drawstate->cliprect;
+    SDL_assert_release(viewport != NULL); /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
+
+    if (cliprect) {
+        SDL_Rect clip_rect;
+        clip_rect.x = cliprect->x + viewport->x;
+        clip_rect.y = cliprect->y + viewport->y;
+        clip_rect.w = cliprect->w;
+        clip_rect.h = cliprect->h;
+        SDL_IntersectRect(viewport, &clip_rect, rect);
+    } else {
+        *rect = *viewport;
+    }
+}
+
 static void SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
 {
     if (drawstate->surface_cliprect_dirty) {
-        const SDL_Rect *viewport = drawstate->viewport;
-        const SDL_Rect *cliprect = drawstate->cliprect;
-        SDL_assert_release(viewport != NULL); /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
-
-        if (cliprect) {
-            SDL_Rect clip_rect;
-            clip_rect.x = cliprect->x + viewport->x;
-            clip_rect.y = cliprect->y + viewport->y;
-            clip_rect.w = cliprect->w;
-            clip_rect.h = cliprect->h;
-            SDL_IntersectRect(viewport, &clip_rect, &clip_rect);
-            SDL_SetClipRect(surface, &clip_rect);
-        } else {
-            SDL_SetClipRect(surface, drawstate->viewport);
-        }
+        SDL_Rect clip_rect;
+        GetDrawStateClipRect(drawstate, &clip_rect);
+        SDL_SetClipRect(surface, &clip_rect);
         drawstate->surface_cliprect_dirty = SDL_FALSE;
     }
 }
 
+static SW_TileQueue *SW_CreateTileQueue(int num_threads)
+{
+    SW_TileQueue *tiles = (SW_TileQueue *)SDL_calloc(1, sizeof(*tiles));
+    if (!tiles) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    tiles->workers = SDL_CreateWorkerPool("SDLRenderSW", num_threads - 1);
+    if (!tiles->workers || SDL_GetWorkerPoolThreads(tiles->workers) == 0) {
+        SDL_DestroyWorkerPool(tiles->workers);
+        SDL_free(tiles);
+        return NULL;
+    }
+    return tiles;
+}
+
+static void SW_DestroyTileQueue(SW_TileQueue *tiles)
+{
+    int i;
+
+    if (!tiles) {
+        return;
+    }
+    SDL_DestroyWorkerPool(tiles->workers);
+    for (i = 0; i < tiles->max_bins; i++) {
+        SDL_free(tiles->bins[i].commands);
+    }
+    SDL_free(tiles->bins);
+    SDL_free(tiles->active_bins);
+    SDL_free(tiles->commands);
+    SDL_free(tiles);
+}
+
+/* Draws a binned command to view, which is clipped to the tile. */
+static void SW_DrawTileCommand(SDL_Surface *view, const SW_TileCommand *tcmd)
+{
+    const SDL_RenderCommand *cmd = tcmd->cmd;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR: {
+            const Uint8 r = cmd->data.color.r;
+            const Uint8 g = cmd->data.color.g;
+            const Uint8 b = cmd->data.color.b;
+            const Uint8 a = cmd->data.color.a;
+            SDL_FillRect(view, NULL, SDL_MapRGBA(view->format, r, g, b, a));
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int)cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *)(((Uint8 *)tcmd->vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawPoints(view, verts, count, SDL_MapRGBA(view->format, r, g, b, a));
+            } else {
+                SDL_BlendPoints(view, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int)cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)tcmd->vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_FillRects(view, verts, count, SDL_MapRGBA(view->format, r, g, b, a));
+            } else {
+                SDL_BlendFillRects(view, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            /* the same thing SDL_SoftBlit() does, but with our own copy of the blit info. */
+            const SDL_Surface *src = (SDL_Surface *)cmd->data.draw.texture->driverdata;
+            SDL_BlitInfo info = tcmd->blitinfo;
+            SDL_Rect dstrect;
+
+            if (!SDL_IntersectRect(&tcmd->dstrect, &view->clip_rect, &dstrect)) {
+                break;
+            }
+            info.src = (Uint8 *)src->pixels +
+                       (tcmd->srcrect.y + (dstrect.y - tcmd->dstrect.y)) * src->pitch +
+                       (tcmd->srcrect.x + (dstrect.x - tcmd->dstrect.x)) * info.src_fmt->BytesPerPixel;
+            info.src_w = dstrect.w;
+            info.src_h = dstrect.h;
+            info.src_pitch = src->pitch;
+            info.src_skip = info.src_pitch - info.src_w * info.src_fmt->BytesPerPixel;
+            info.dst = (Uint8 *)view->pixels + dstrect.y * view->pitch + dstrect.x * info.dst_fmt->BytesPerPixel;
+            info.dst_w = dstrect.w;
+            info.dst_h = dstrect.h;
+            info.dst_pitch = view->pitch;
+            info.dst_skip = info.dst_pitch - info.dst_w * info.dst_fmt->BytesPerPixel;
+            tcmd->blitfunc(&info);
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY: {
+            GeometryFillData *ptr = (GeometryFillData *)(((Uint8 *)tcmd->vertices) + cmd->data.draw.first);
+            const int count = (int)cmd->data.draw.count;
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            int j;
+
+            for (j = 0; j < count; j += 3, ptr += 3) {
+                SDL_Rect bounds;
+                SDL_SW_GetTriangleBounds(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &bounds);
+                if (SDL_HasIntersection(&bounds, &view->clip_rect)) {
+                    SDL_SW_FillTriangle(view, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
+                }
+            }
+            break;
+        }
+
+        default:
+            SDL_assert(!"Unexpected command in a tile");
+            break;
+    }
+}
+
+static void SW_DrawTile(void *userdata, int index, int thread_index)
+{
+    SW_TileQueue *tiles = (SW_TileQueue *)userdata;
+    const int bin_index = tiles->active_bins[index];
+    const SW_TileBin *bin = &tiles->bins[bin_index];
+    SDL_Surface view;
+    SDL_Rect tile;
+    int i;
+
+    /* a copy of the surface to draw the tile with, so each tile has its own
+       clip rect. Anything blitted to it gets a blit map of its own, too. */
+    view = *tiles->surface;
+    view.list_blitmap = NULL;
+
+    tile.x = (bin_index % tiles->tiles_x) * SW_TILE_WIDTH;
+    tile.y = (bin_index / tiles->tiles_x) * SW_TILE_HEIGHT;
+    tile.w = SW_TILE_WIDTH;
+    tile.h = SW_TILE_HEIGHT;
+
+    for (i = 0; i < bin->num_commands; i++) {
+        const SW_TileCommand *tcmd = &tiles->commands[bin->commands[i]];
+        if (SDL_IntersectRect(&tcmd->clip, &tile, &view.clip_rect)) {
+            SW_DrawTileCommand(&view, tcmd);
+        }
+    }
+}
+
+static void SW_FlushTileCommands(SW_TileQueue *tiles)
+{
+    int i;
+
+    if (tiles->num_commands == 0) {
+        return;
+    }
+
+    tiles->num_active_bins = 0;
+    for (i = 0; i < tiles->tiles_x * tiles->tiles_y; i++) {
+        if (tiles->bins[i].num_commands > 0) {
+            tiles->active_bins[tiles->num_active_bins++] = i;
+        }
+    }
+
+    SDL_RunWorkerPool(tiles->workers, SW_DrawTile, tiles, tiles->num_active_bins);
+
+    for (i = 0; i < tiles->num_active_bins; i++) {
+        tiles->bins[tiles->active_bins[i]].num_commands = 0;
+    }
+    tiles->num_commands = 0;
+    tiles->surface = NULL;
+}
+
+/* Adds the command to the tiles it touches. The command must already be in
+   tiles->commands, at index. */
+static SDL_bool SW_BinTileCommand(SW_TileQueue *tiles, int index, const SDL_Rect *bounds)
+{
+    const int x0 = bounds->x / SW_TILE_WIDTH;
+    const int y0 = bounds->y / SW_TILE_HEIGHT;
+    const int x1 = (bounds->x + bounds->w - 1) / SW_TILE_WIDTH;
+    const int y1 = (bounds->y + bounds->h - 1) / SW_TILE_HEIGHT;
+    int x, y;
+
+    /* make room in every bin first, so the command is in all of them or none. */
+    for (y = y0; y <= y1; y++) {
+        for (x = x0; x <= x1; x++) {
+            SW_TileBin *bin = &tiles->bins[y * tiles->tiles_x + x];
+            if (bin->num_commands == bin->max_commands) {
+                const int max_commands = bin->max_commands ? bin->max_commands * 2 : 64;
+                int *commands = (int *)SDL_realloc(bin->commands, max_commands * sizeof(int));
+                if (!commands) {
+                    return SDL_FALSE;
+                }
+                bin->commands = commands;
+                bin->max_commands = max_commands;
+            }
+        }
+    }
+
+    for (y = y0; y <= y1; y++) {
+        for (x = x0; x <= x1; x++) {
+            SW_TileBin *bin = &tiles->bins[y * tiles->tiles_x + x];
+            bin->commands[bin->num_commands++] = index;
+        }
+    }
+    return SDL_TRUE;
+}
+
+/* Returns SDL_TRUE if the command was handled by the tiles. Any other drawing
+   command flushes the tiles, so it's drawn after everything before it. */
+static SDL_bool SW_QueueTileCommand(SW_TileQueue *tiles, SDL_Surface *surface, const SW_DrawStateCache *drawstate,
+                                    const SDL_RenderCommand *cmd, void *vertices)
+{
+    SW_TileCommand *tcmd;
+    SDL_Rect full_rect, bounds;
+    int i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+        case SDL_RENDERCMD_SETVIEWPORT:
+        case SDL_RENDERCMD_SETCLIPRECT:
+        case SDL_RENDERCMD_NO_OP:
+            return SDL_FALSE; /* just state, nothing to draw. */
+
+        case SDL_RENDERCMD_CLEAR:
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_FILL_RECTS:
+            break;
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            if (verts[0].w != verts[1].w || verts[0].h != verts[1].h) {
+                goto flush; /* scaled blits depend on the clip rect. */
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY:
+            if (cmd->data.draw.texture) {
+                goto flush;
+            }
+            break;
+
+        default:
+            goto flush;
+    }
+
+    if (SDL_MUSTLOCK(surface)) {
+        goto flush;
+    }
+
+    full_rect.x = 0;
+    full_rect.y = 0;
+    full_rect.w = surface->w;
+    full_rect.h = surface->h;
+
+    if (tiles->surface != surface) {
+        /* first command since the last flush, set up the bins for this surface. */
+        const int tiles_x = (surface->w + SW_TILE_WIDTH - 1) / SW_TILE_WIDTH;
+        const int tiles_y = (surface->h + SW_TILE_HEIGHT - 1) / SW_TILE_HEIGHT;
+        SDL_assert(tiles->num_commands == 0);
+        if (tiles_x * tiles_y > tiles->max_bins) {
+            SW_TileBin *bins = (SW_TileBin *)SDL_realloc(tiles->bins, tiles_x * tiles_y * sizeof(SW_TileBin));
+            int *active_bins;
+            if (!bins) {
+                return SDL_FALSE;
+            }
+            SDL_memset(bins + tiles->max_bins, 0, (tiles_x * tiles_y - tiles->max_bins) * sizeof(SW_TileBin));
+            tiles->bins = bins;
+            tiles->max_bins = tiles_x * tiles_y;
+            active_bins = (int *)SDL_realloc(tiles->active_bins, tiles->max_bins * sizeof(int));
+            if (!active_bins) {
+                return SDL_FALSE;
+            }
+            tiles->active_bins = active_bins;
+        }
+        tiles->surface = surface;
+        tiles->tiles_x = tiles_x;
+        tiles->tiles_y = tiles_y;
+    }
+
+    if (tiles->num_commands == tiles->max_commands) {
+        const int max_commands = tiles->max_commands ? tiles->max_commands * 2 : 128;
+        SW_TileCommand *commands = (SW_TileCommand *)SDL_realloc(tiles->commands, max_commands * sizeof(SW_TileCommand));
+        if (!commands) {
+            goto flush;
+        }
+        tiles->commands = commands;
+        tiles->max_commands = max_commands;
+    }
+
+    tcmd = &tiles->commands[tiles->num_commands];
+    tcmd->cmd = cmd;
+    tcmd->vertices = vertices;
+
+    if (cmd->command == SDL_RENDERCMD_CLEAR) {
+        /* By definition the clear ignores the clip rect */
+        tcmd->clip = full_rect;
+    } else {
+        GetDrawStateClipRect(drawstate, &tcmd->clip);
+        if (!SDL_IntersectRect(&tcmd->clip, &full_rect, &tcmd->clip)) {
+            return SDL_TRUE; /* everything is clipped away. */
+        }
+    }
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR:
+            bounds = tcmd->clip;
+            break;
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const int count = (int)cmd->data.draw.count;
+            SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+
+            /* Apply viewport */
+            if (drawstate->viewport->x || drawstate->viewport->y) {
+                for (i = 0; i < count; i++) {
+                    verts[i].x += drawstate->viewport->x;
+                    verts[i].y += drawstate->viewport->y;
+                }
+            }
+            if (!SDL_EnclosePoints(verts, count, &tcmd->clip, &bounds)) {
+                return SDL_TRUE;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const int count = (int)cmd->data.draw.count;
+            SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            SDL_bool empty = SDL_TRUE;
+
+            for (i = 0; i < count; i++) {
+                SDL_Rect rect;
+                /* Apply viewport */
+                verts[i].x += drawstate->viewport->x;
+                verts[i].y += drawstate->viewport->y;
+                if (SDL_IntersectRect(&verts[i], &tcmd->clip, &rect)) {
+                    if (empty) {
+                        bounds = rect;
+                        empty = SDL_FALSE;
+                    } else {
+                        SDL_UnionRect(&bounds, &rect, &bounds);
+                    }
+                }
+            }
+            if (empty) {
+                return SDL_TRUE;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            SDL_Surface *src = (SDL_Surface *)cmd->data.draw.texture->driverdata;
+            int srcx, srcy, dstx, dsty, w, h, delta;
+
+            PrepTextureForCopy(cmd);
+
+            /* make sure the blit map is current, like SDL_LowerBlit() would. RLE
+               and palette blits aren't safe to share between threads. */
+            if (src->locked || (src->format->palette != NULL) || (surface->format->palette != NULL)) {
+                goto flush;
+            }
+            /* switch back to a fast blit if we were previously stretching, like SDL_UpperBlit() does. */
+            if (src->map->info.flags & SDL_COPY_NEAREST) {
+                src->map->info.flags &= ~SDL_COPY_NEAREST;
+                SDL_InvalidateMap(src->map);
+            }
+            if (src->map->dst != surface && SDL_MapSurface(src, surface) < 0) {
+                goto flush;
+            }
+            if ((src->flags & SDL_RLEACCEL) || !src->map->data) {
+                goto flush;
+            }
+
+            /* Apply viewport */
+            verts[1].x += drawstate->viewport->x;
+            verts[1].y += drawstate->viewport->y;
+
+            /* clip the same way SDL_UpperBlit() does. */
+            srcx = verts[0].x;
+            w = verts[0].w;
+            dstx = verts[1].x;
+            if (srcx < 0) {
+                w += srcx;
+                dstx -= srcx;
+                srcx = 0;
+            }
+            w = SDL_min(w, src->w - srcx);
+
+            srcy = verts[0].y;
+            h = verts[0].h;
+            dsty = verts[1].y;
+            if (srcy < 0) {
+                h += srcy;
+                dsty -= srcy;
+                srcy = 0;
+            }
+            h = SDL_min(h, src->h - srcy);
+
+            delta = tcmd->clip.x - dstx;
+            if (delta > 0) {
+                w -= delta;
+                dstx += delta;
+                srcx += delta;
+            }
+            delta = dstx + w - tcmd->clip.x - tcmd->clip.w;
+            if (delta > 0) {
+                w -= delta;
+            }
+
+            delta = tcmd->clip.y - dsty;
+            if (delta > 0) {
+                h -= delta;
+                dsty += delta;
+                srcy += delta;
+            }
+            delta = dsty + h - tcmd->clip.y - tcmd->clip.h;
+            if (delta > 0) {
+                h -= delta;
+            }
+
+            if (w <= 0 || h <= 0) {
+                return SDL_TRUE;
+            }
+
+            tcmd->srcrect.x = srcx;
+            tcmd->srcrect.y = srcy;
+            tcmd->srcrect.w = w;
+            tcmd->srcrect.h = h;
+            tcmd->dstrect.x = dstx;
+            tcmd->dstrect.y = dsty;
+            tcmd->dstrect.w = w;
+            tcmd->dstrect.h = h;
+            tcmd->blitinfo = src->map->info;
+            tcmd->blitfunc = (SDL_BlitFunc)src->map->data;
+            bounds = tcmd->dstrect;
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY: {
+            const int count = (int)cmd->data.draw.count;
+            GeometryFillData *ptr = (GeometryFillData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            SDL_bool empty = SDL_TRUE;
+            SDL_Point vp;
+
+            /* Apply viewport */
+            vp.x = drawstate->viewport->x;
+            vp.y = drawstate->viewport->y;
+            trianglepoint_2_fixedpoint(&vp);
+            for (i = 0; i < count; i++) {
+                ptr[i].dst.x += vp.x;
+                ptr[i].dst.y += vp.y;
+            }
+
+            for (i = 0; i < count; i += 3, ptr += 3) {
+                SDL_Rect rect;
+                SDL_SW_GetTriangleBounds(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &rect);
+                if (SDL_IntersectRect(&rect, &tcmd->clip, &rect)) {
+                    if (empty) {
+                        bounds = rect;
+                        empty = SDL_FALSE;
+                    } else {
+                        SDL_UnionRect(&bounds, &rect, &bounds);
+                    }
+                }
+            }
+            if (empty) {
+                return SDL_TRUE;
+            }
+            break;
+        }
+
+        default:
+            SDL_assert(!"Unexpected command");
+            return SDL_FALSE;
+    }
+
+    if (!SW_BinTileCommand(tiles, tiles->num_commands, &bounds)) {
+        /* out of memory. The vertices are already adjusted for the viewport,
+           so draw it here, after everything before it. */
+        SW_TileCommand command = *tcmd;
+        SDL_Surface view = *surface;
+        SW_FlushTileCommands(tiles);
+        view.list_blitmap = NULL;
+        view.clip_rect = command.clip;
+        SW_DrawTileCommand(&view, &command);
+        return SDL_TRUE;
+    }
+    tiles->num_commands++;
+    return SDL_TRUE;
+
+flush:
+    SW_FlushTileCommands(tiles);
+    return SDL_FALSE;
+}
+
+static void SW_AddDirtyRect(SW_RenderData *data, const SDL_Rect *rect)
+{
+    SDL_Rect merged;
+    int i, best = 0;
+    Sint64 area, best_area = -1;
+
+    for (i = 0; i < data->num_dirty_rects; i++) {
+        if (SDL_HasIntersection(&data->dirty_rects[i], rect)) {
+            SDL_UnionRect(&data->dirty_rects[i], rect, &data->dirty_rects[i]);
+            return;
+        }
+    }
+
+    if (data->num_dirty_rects < SW_MAX_DIRTY_RECTS) {
+        data->dirty_rects[data->num_dirty_rects++] = *rect;
+        return;
+    }
+
+    for (i = 0; i < data->num_dirty_rects; i++) {
+        SDL_UnionRect(&data->dirty_rects[i], rect, &merged);
+        area = (Sint64)merged.w * merged.h - (Sint64)data->dirty_rects[i].w * data->dirty_rects[i].h;
+        if (best_area < 0 || area < best_area) {
+            best = i;
+            best_area = area;
+        }
+    }
+    SDL_UnionRect(&data->dirty_rects[best], rect, &data->dirty_rects[best]);
+}
+
+/* Marks the area of the window surface a command is going to draw to. This is
+   called before the command runs, so the vertices aren't adjusted for the
+   viewport yet. */
+static void SW_AddCommandDirtyRect(SW_RenderData *data, SDL_Surface *surface, const SW_DrawStateCache *drawstate,
+                                   const SDL_RenderCommand *cmd, void *vertices)
+{
+    SDL_Rect full_rect, clip, bounds;
+    SDL_Point vp = { 0, 0 };
+    int i;
+
+    full_rect.x = 0;
+    full_rect.y = 0;
+    full_rect.w = surface->w;
+    full_rect.h = surface->h;
+
+    if (drawstate->viewport) {
+        GetDrawStateClipRect(drawstate, &clip);
+        if (!SDL_IntersectRect(&clip, &full_rect, &clip)) {
+            return;
+        }
+        vp.x = drawstate->viewport->x;
+        vp.y = drawstate->viewport->y;
+    } else {
+        clip = full_rect;
+    }
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR:
+            data->dirty_all = SDL_TRUE;
+            return;
+
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES: {
+            const int count = (int)cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            int min_x, min_y, max_x, max_y;
+
+            if (count <= 0) {
+                return;
+            }
+            min_x = max_x = verts[0].x;
+            min_y = max_y = verts[0].y;
+            for (i = 1; i < count; i++) {
+                min_x = SDL_min(min_x, verts[i].x);
+                min_y = SDL_min(min_y, verts[i].y);
+                max_x = SDL_max(max_x, verts[i].x);
+                max_y = SDL_max(max_y, verts[i].y);
+            }
+            bounds.x = min_x + vp.x;
+            bounds.y = min_y + vp.y;
+            bounds.w = max_x - min_x + 1;
+            bounds.h = max_y - min_y + 1;
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            /* merged commands can have rects all over the surface, add them separately. */
+            const int count = (int)cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+
+            for (i = 0; i < count; i++) {
+                bounds = verts[i];
+                bounds.x += vp.x;
+                bounds.y += vp.y;
+                if (SDL_IntersectRect(&bounds, &clip, &bounds)) {
+                    SW_AddDirtyRect(data, &bounds);
+                }
+            }
+            return;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+
+            bounds = verts[1];
+            bounds.x += vp.x;
+            bounds.y += vp.y;
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY_EX: {
+            const CopyExData *copydata = (CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            double cangle, sangle;
+
+            /* the same bounds SW_RenderCopyEx() blits the rotated surface to. */
+            SDLgfx_rotozoomSurfaceSizeTrig(copydata->dstrect.w, copydata->dstrect.h, copydata->angle, &copydata->center,
+                                           &bounds, &cangle, &sangle);
+            bounds.x += copydata->dstrect.x + vp.x;
+            bounds.y += copydata->dstrect.y + vp.y;
+
+            /* Blit_to_Screen() scales the rect it blits to, so scale the bounds
+               the same way, with a pixel of slack for the truncation. */
+            if (copydata->scale_x != 1.0f || copydata->scale_y != 1.0f) {
+                bounds.x = (int)((float)bounds.x * copydata->scale_x);
+                bounds.y = (int)((float)bounds.y * copydata->scale_y);
+                bounds.w = (int)((float)bounds.w * copydata->scale_x) + 1;
+                bounds.h = (int)((float)bounds.h * copydata->scale_y) + 1;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY: {
+            const int count = (int)cmd->data.draw.count;
+            void *verts = ((Uint8 *)vertices) + cmd->data.draw.first;
+
+            for (i = 0; i + 2 < count; i += 3) {
+                if (cmd->data.draw.texture) {
+                    const GeometryCopyData *ptr = (GeometryCopyData *)verts + i;
+                    SDL_SW_GetTriangleBounds(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &bounds);
+                } else {
+                    const GeometryFillData *ptr = (GeometryFillData *)verts + i;
+                    SDL_SW_GetTriangleBounds(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &bounds);
+                }
+                /* the bounds are truncated from fixed point, so round them out. */
+                bounds.x += vp.x;
+                bounds.y += vp.y;
+                bounds.w += 2;
+                bounds.h += 2;
+                if (SDL_IntersectRect(&bounds, &clip, &bounds)) {
+                    SW_AddDirtyRect(data, &bounds);
+                }
+            }
+            return;
+        }
+
+        default:
+            return; /* just state, nothing to draw. */
+    }
+
+    if (SDL_IntersectRect(&bounds, &clip, &bounds)) {
+        SW_AddDirtyRect(data, &bounds);
+    }
+}
+
 static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
 
@@ -672,6 +1402,28 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
     drawstate.surface_cliprect_dirty = SDL_TRUE;
 
     while (cmd) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+        case SDL_RENDERCMD_FILL_RECTS:
+        case SDL_RENDERCMD_COPY:
+        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_GEOMETRY:
+            renderer->stats.draw_calls++;
+            break;
+        default:
+            break;
+        }
+
+        if (surface == data->window && !data->dirty_all) {
+            SW_AddCommandDirtyRect(data, surface, &drawstate, cmd, vertices);
+        }
+
+        if (data->tiles && SW_QueueTileCommand(data->tiles, surface, &drawstate, cmd, vertices)) {
+            cmd = cmd->next;
+            continue;
+        }
+
         switch (cmd->command) {
             case SDL_RENDERCMD_SETDRAWCOLOR: {
                 break;  /* Not used in this backend. */
@@ -928,6 +1680,10 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
         cmd = cmd->next;
     }
 
+    if (data->tiles) {
+        SW_FlushTileCommands(data->tiles);
+    }
+
     return 0;
 }
 
@@ -963,12 +1719,27 @@ static int SW_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
 
 static int SW_RenderPresent(SDL_Renderer *renderer)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Window *window = renderer->window;
+    int retval = 0;
 
     if (!window) {
         return -1;
     }
-    return SDL_UpdateWindowSurface(window);
+
+    /* Only push the parts of the window surface that were drawn to. An empty
+       frame still goes through with no rects, so the window is presented and
+       paced like before. */
+    if (data->dirty_all) {
+        retval = SDL_UpdateWindowSurface(window);
+    } else {
+        retval = SDL_UpdateWindowSurfaceRects(window, data->dirty_rects, data->num_dirty_rects);
+    }
+    if (retval == 0) {
+        data->dirty_all = SDL_FALSE;
+        data->num_dirty_rects = 0;
+    }
+    return retval;
 }
 
 static void SW_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
@@ -986,6 +1757,9 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
     if (window) {
         SDL_DestroyWindowSurface(window);
     }
+    if (data) {
+        SW_DestroyTileQueue(data->tiles);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -994,6 +1768,8 @@ SDL_Renderer *SW_CreateRendererForSurface(SDL_Surface *surface)
 {
     SDL_Renderer *renderer;
     SW_RenderData *data;
+    const char *hint;
+    int num_threads;
 
     if (!surface) {
         SDL_InvalidParamError("surface");
@@ -1014,6 +1790,16 @@ SDL_Renderer *SW_CreateRendererForSurface(SDL_Surface *surface)
     }
     data->surface = surface;
     data->window = surface;
+    data->dirty_all = SDL_TRUE;
+
+    hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    num_threads = (hint && *hint) ? SDL_atoi(hint) : 1;
+    if (num_threads <= 0) {
+        num_threads = SDL_GetCPUCount();
+    }
+    if (num_threads > 1) {
+        data->tiles = SW_CreateTileQueue(num_threads); /* if this fails, just draw on this thread. */
+    }
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -148,6 +148,11 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
     r->h = (max_y - min_y) >> FP_BITS;
 }
 
+void SDL_SW_GetTriangleBounds(const SDL_Point *d0, const SDL_Point *d1, const SDL_Point *d2, SDL_Rect *rect)
+{
+    bounding_rect_fixedpoint(d0, d1, d2, rect);
+}
+
 /* bounding rect of three points */
 static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Point *c, SDL_Rect *r)
 {
@@ -161,25 +166,600 @@ static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Poin
     r->h = (max_y - min_y);
 }
 
+/* Restrict [*x_start, *x_end) to the pixels where 'w + bias + x * step >= 0' */
+static void clip_span_to_edge(Sint64 w, int bias, int step, Sint64 *x_start, Sint64 *x_end)
+{
+    Sint64 c = w + bias;
+    if (step > 0) {
+        if (c < 0) {
+            /* x >= ceil(-c / step) */
+            *x_start = SDL_max(*x_start, (-c + step - 1) / step);
+        }
+    } else if (step < 0) {
+        if (c < 0) {
+            *x_end = 0;
+        } else {
+            /* x <= floor(c / -step) */
+            *x_end = SDL_min(*x_end, c / -step + 1);
+        }
+    } else if (c < 0) {
+        *x_end = 0;
+    }
+}
+
+/* Compute the span [*x_start, *x_end) of a row that is inside the triangle */
+static void triangle_span(Sint64 w0, Sint64 w1, Sint64 w2, int bias_w0, int bias_w1, int bias_w2,
+                          int d2d1_y, int d0d2_y, int d1d0_y, int width, int *x_start, int *x_end)
+{
+    Sint64 start = 0;
+    Sint64 end = width;
+    clip_span_to_edge(w0, bias_w0, d2d1_y, &start, &end);
+    clip_span_to_edge(w1, bias_w1, d0d2_y, &start, &end);
+    clip_span_to_edge(w2, bias_w2, d1d0_y, &start, &end);
+    if (start >= end) {
+        *x_start = *x_end = 0;
+    } else {
+        *x_start = (int)start;
+        *x_end = (int)end;
+    }
+}
+
+/* Exact incremental evaluation of 'floor(num / area)' along a span.
+ * Inside the triangle w0, w1 and w2 are never negative, and neither are
+ * the interpolated colors and texture coordinates, so the quotient and
+ * remainder are stepped instead of dividing at each pixel.
+ * 'r + dr' must not overflow, so this is limited to TRIANGLE_INTERP_MAX_AREA.
+ */
+#define TRIANGLE_INTERP_MAX_AREA ((1 << 30) - 1)
+#define TRIANGLE_INTERP_MAX_STEP (1 << 24)
+
+typedef struct
+{
+    int q;  /* floor(num / area) */
+    int r;  /* num % area */
+    int dq; /* floor(step / area) */
+    int dr; /* step - dq * area, in [0, area) */
+} TriangleInterp;
+
+static void interp_init(TriangleInterp *interp, Sint64 num, Sint64 step, int area)
+{
+    Sint64 dq = step / area;
+    Sint64 dr = step % area;
+    if (dr < 0) {
+        dq -= 1;
+        dr += area;
+    }
+    /* The step is only bounded by the range of the values between two pixels
+     * of the same span, so clamp it: stepping past the end of a span must not overflow. */
+    dq = SDL_clamp(dq, -TRIANGLE_INTERP_MAX_STEP, TRIANGLE_INTERP_MAX_STEP);
+    interp->q = (int)(num / area);
+    interp->r = (int)(num % area);
+    interp->dq = (int)dq;
+    interp->dr = (int)dr;
+}
+
+/* Step for 'count' pixels at once */
+static void interp_scale(const TriangleInterp *interp, int count, int area, int *dq, int *dr)
+{
+    Sint64 r = (Sint64)interp->dr * count;
+    *dq = (int)((Sint64)interp->dq * count + r / area);
+    *dr = (int)(r % area);
+}
+
+#define INTERP_STEP(interp, area)       \
+    (interp).r += (interp).dr;          \
+    (interp).q += (interp).dq;          \
+    if ((interp).r >= (area)) {         \
+        (interp).r -= (area);           \
+        (interp).q += 1;                \
+    }
+
+#if defined(__SSE2__)
+#define HAVE_SSE2_INTRINSICS
+#endif
+
+#if defined(__ARM_NEON)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/* 32 bits formats where each of R, G, B (and A) is a whole byte.
+ * On success, 'bytes' holds the byte index of R, G, B and A, where A may
+ * also be a byte that is always written as 0.
+ */
+static int get_8888_channel_bytes(const SDL_PixelFormat *fmt, int bytes[4])
+{
+    int used;
+    int i;
+
+    if (fmt->BytesPerPixel != 4 || fmt->palette ||
+        fmt->Rloss || fmt->Gloss || fmt->Bloss ||
+        (fmt->Rshift % 8) || (fmt->Gshift % 8) || (fmt->Bshift % 8)) {
+        return 0;
+    }
+    bytes[0] = fmt->Rshift / 8;
+    bytes[1] = fmt->Gshift / 8;
+    bytes[2] = fmt->Bshift / 8;
+    used = (1 << bytes[0]) | (1 << bytes[1]) | (1 << bytes[2]);
+    if (fmt->Amask) {
+        if (fmt->Aloss || (fmt->Ashift % 8)) {
+            return 0;
+        }
+        bytes[3] = fmt->Ashift / 8;
+    } else {
+        for (i = 0; (used & (1 << i)); i++) {
+        }
+        bytes[3] = i;
+    }
+    used |= (1 << bytes[3]);
+    return used == 0xF;
+}
+
+/* Fill 'count' pixels, 'interp' holds the channel of each byte of the pixel */
+static void fill_span_8888(Uint32 *dst, int count, TriangleInterp interp[4], int area)
+{
+    while (count--) {
+        *dst++ = (Uint32)interp[0].q | ((Uint32)interp[1].q << 8) |
+                 ((Uint32)interp[2].q << 16) | ((Uint32)interp[3].q << 24);
+        INTERP_STEP(interp[0], area);
+        INTERP_STEP(interp[1], area);
+        INTERP_STEP(interp[2], area);
+        INTERP_STEP(interp[3], area);
+    }
+}
+
+#if defined(HAVE_SSE2_INTRINSICS)
+/* 4 pixels per step, each channel in its own vector */
+static void fill_span_8888_SSE2(Uint32 *dst, int count, TriangleInterp interp[4], int area)
+{
+    if (count >= 4) {
+        const __m128i v_area = _mm_set1_epi32(area);
+        const __m128i v_area_m1 = _mm_set1_epi32(area - 1);
+        __m128i q[4], r[4], dq[4], dr[4];
+        int c;
+
+        for (c = 0; c < 4; c++) {
+            TriangleInterp it = interp[c];
+            int lane_q[4], lane_r[4], i, step_q, step_r;
+            for (i = 0; i < 4; i++) {
+                lane_q[i] = it.q;
+                lane_r[i] = it.r;
+                INTERP_STEP(it, area);
+            }
+            interp_scale(&interp[c], 4, area, &step_q, &step_r);
+            q[c] = _mm_setr_epi32(lane_q[0], lane_q[1], lane_q[2], lane_q[3]);
+            r[c] = _mm_setr_epi32(lane_r[0], lane_r[1], lane_r[2], lane_r[3]);
+            dq[c] = _mm_set1_epi32(step_q);
+            dr[c] = _mm_set1_epi32(step_r);
+        }
+
+        while (count >= 4) {
+            __m128i pixels = _mm_or_si128(_mm_or_si128(q[0], _mm_slli_epi32(q[1], 8)),
+                                          _mm_or_si128(_mm_slli_epi32(q[2], 16), _mm_slli_epi32(q[3], 24)));
+            _mm_storeu_si128((__m128i *)dst, pixels);
+            dst += 4;
+            count -= 4;
+
+            for (c = 0; c < 4; c++) {
+                __m128i carry;
+                r[c] = _mm_add_epi32(r[c], dr[c]);
+                q[c] = _mm_add_epi32(q[c], dq[c]);
+                carry = _mm_cmpgt_epi32(r[c], v_area_m1);
+                r[c] = _mm_sub_epi32(r[c], _mm_and_si128(carry, v_area));
+                q[c] = _mm_sub_epi32(q[c], carry);
+            }
+        }
+
+        /* Lane 0 is the next pixel */
+        for (c = 0; c < 4; c++) {
+            interp[c].q = _mm_cvtsi128_si32(q[c]);
+            interp[c].r = _mm_cvtsi128_si32(r[c]);
+        }
+    }
+    fill_span_8888(dst, count, interp, area);
+}
+#endif
+
+#if defined(HAVE_NEON_INTRINSICS)
+static void fill_span_8888_NEON(Uint32 *dst, int count, TriangleInterp interp[4], int area)
+{
+    if (count >= 4) {
+        const int32x4_t v_area = vdupq_n_s32(area);
+        int32x4_t q[4], r[4], dq[4], dr[4];
+        int c;
+
+        for (c = 0; c < 4; c++) {
+            TriangleInterp it = interp[c];
+            int lane_q[4], lane_r[4], i, step_q, step_r;
+            for (i = 0; i < 4; i++) {
+                lane_q[i] = it.q;
+                lane_r[i] = it.r;
+                INTERP_STEP(it, area);
+            }
+            interp_scale(&interp[c], 4, area, &step_q, &step_r);
+            q[c] = vld1q_s32(lane_q);
+            r[c] = vld1q_s32(lane_r);
+            dq[c] = vdupq_n_s32(step_q);
+            dr[c] = vdupq_n_s32(step_r);
+        }
+
+        while (count >= 4) {
+            uint32x4_t pixels = vorrq_u32(vorrq_u32(vreinterpretq_u32_s32(q[0]), vshlq_n_u32(vreinterpretq_u32_s32(q[1]), 8)),
+                                          vorrq_u32(vshlq_n_u32(vreinterpretq_u32_s32(q[2]), 16), vshlq_n_u32(vreinterpretq_u32_s32(q[3]), 24)));
+            vst1q_u32(dst, pixels);
+            dst += 4;
+            count -= 4;
+
+            for (c = 0; c < 4; c++) {
+                int32x4_t carry;
+                r[c] = vaddq_s32(r[c], dr[c]);
+                q[c] = vaddq_s32(q[c], dq[c]);
+                carry = vreinterpretq_s32_u32(vcgeq_s32(r[c], v_area));
+                r[c] = vsubq_s32(r[c], vandq_s32(carry, v_area));
+                q[c] = vsubq_s32(q[c], carry);
+            }
+        }
+
+        for (c = 0; c < 4; c++) {
+            interp[c].q = vgetq_lane_s32(q[c], 0);
+            interp[c].r = vgetq_lane_s32(r[c], 0);
+        }
+    }
+    fill_span_8888(dst, count, interp, area);
+}
+#endif
+
+typedef void (*FillSpan8888Func)(Uint32 *dst, int count, TriangleInterp interp[4], int area);
+
+static FillSpan8888Func get_fill_span_8888(void)
+{
+#if defined(HAVE_NEON_INTRINSICS)
+    if (SDL_HasNEON()) {
+        return fill_span_8888_NEON;
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (SDL_HasSSE2()) {
+        return fill_span_8888_SSE2;
+    }
+#endif
+    return fill_span_8888;
+}
+
+/* Textured triangles between ARGB8888 and XRGB8888 surfaces.
+ * This is the math of SDL_BlitTriangle_Slow() for these formats,
+ * with the same integer rounding.
+ */
+typedef struct
+{
+    Uint32 src_alpha; /* ORed into the source pixels, sources without alpha are opaque */
+    Uint32 dst_amask; /* alpha bits kept in the destination pixels */
+    int blend;        /* 0, SDL_COPY_BLEND, SDL_COPY_ADD or SDL_COPY_MOD */
+    int modulate;
+} TriangleBlend8888;
+
+static int get_blend_8888(const SDL_Surface *src, const SDL_Surface *dst, int flags, int has_modulation, TriangleBlend8888 *op)
+{
+    const Uint32 src_format = src->format->format;
+    const Uint32 dst_format = dst->format->format;
+
+    if ((src_format != SDL_PIXELFORMAT_ARGB8888 && src_format != SDL_PIXELFORMAT_XRGB8888) ||
+        (dst_format != SDL_PIXELFORMAT_ARGB8888 && dst_format != SDL_PIXELFORMAT_XRGB8888)) {
+        return 0;
+    }
+    if (flags & (SDL_COPY_COLORKEY | SDL_COPY_MUL)) {
+        return 0;
+    }
+    op->src_alpha = (src_format == SDL_PIXELFORMAT_XRGB8888) ? 0xFF000000 : 0;
+    op->dst_amask = (dst_format == SDL_PIXELFORMAT_ARGB8888) ? 0xFF000000 : 0;
+    op->blend = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+    op->modulate = has_modulation;
+    return 1;
+}
+
+static void blend_8888(const Uint32 *src, const Uint32 *mod, Uint32 *dst, int count, const TriangleBlend8888 *op)
+{
+    int i;
+    for (i = 0; i < count; i++) {
+        Uint32 srcpixel = src[i] | op->src_alpha;
+        Uint32 dstpixel = dst[i];
+        Uint32 srcR = (srcpixel >> 16) & 0xFF, srcG = (srcpixel >> 8) & 0xFF, srcB = srcpixel & 0xFF, srcA = srcpixel >> 24;
+        Uint32 dstR = (dstpixel >> 16) & 0xFF, dstG = (dstpixel >> 8) & 0xFF, dstB = dstpixel & 0xFF, dstA = dstpixel >> 24;
+
+        if (op->modulate) {
+            Uint32 modpixel = mod[i];
+            srcR = (srcR * ((modpixel >> 16) & 0xFF)) / 255;
+            srcG = (srcG * ((modpixel >> 8) & 0xFF)) / 255;
+            srcB = (srcB * (modpixel & 0xFF)) / 255;
+            srcA = (srcA * (modpixel >> 24)) / 255;
+        }
+        switch (op->blend) {
+        case 0:
+            dstR = srcR;
+            dstG = srcG;
+            dstB = srcB;
+            dstA = srcA;
+            break;
+        case SDL_COPY_BLEND:
+            srcR = (srcR * srcA) / 255;
+            srcG = (srcG * srcA) / 255;
+            srcB = (srcB * srcA) / 255;
+            dstR = srcR + ((255 - srcA) * dstR) / 255;
+            dstG = srcG + ((255 - srcA) * dstG) / 255;
+            dstB = srcB + ((255 - srcA) * dstB) / 255;
+            dstA = srcA + ((255 - srcA) * dstA) / 255;
+            break;
+        case SDL_COPY_ADD:
+            srcR = (srcR * srcA) / 255;
+            srcG = (srcG * srcA) / 255;
+            srcB = (srcB * srcA) / 255;
+            dstR = SDL_min(srcR + dstR, 255);
+            dstG = SDL_min(srcG + dstG, 255);
+            dstB = SDL_min(srcB + dstB, 255);
+            break;
+        case SDL_COPY_MOD:
+            dstR = (srcR * dstR) / 255;
+            dstG = (srcG * dstG) / 255;
+            dstB = (srcB * dstB) / 255;
+            break;
+        }
+        dst[i] = (dstR << 16) | (dstG << 8) | dstB | ((dstA << 24) & op->dst_amask);
+    }
+}
+
+#if defined(HAVE_SSE2_INTRINSICS)
+/* x / 255, exact for x <= 65534 */
+#define DIV255_SSE2(x) _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16((x), one), _mm_srli_epi16((x), 8)), 8)
+
+/* 4 pixels per step, 2 pixels of 16 bits channels per vector */
+static void blend_8888_SSE2(const Uint32 *src, const Uint32 *mod, Uint32 *dst, int count, const TriangleBlend8888 *op)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i v255 = _mm_set1_epi16(255);
+    const __m128i rgb_mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alpha_255 = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i alpha_mask = _mm_set1_epi32((int)0xFF000000);
+    const __m128i src_alpha = _mm_set1_epi32((int)op->src_alpha);
+    const __m128i dst_amask = _mm_set1_epi32((int)op->dst_amask);
+
+    while (count >= 4) {
+        __m128i s = _mm_or_si128(_mm_loadu_si128((const __m128i *)src), src_alpha);
+        __m128i d = _mm_loadu_si128((const __m128i *)dst);
+        __m128i s_lo = _mm_unpacklo_epi8(s, zero);
+        __m128i s_hi = _mm_unpackhi_epi8(s, zero);
+        __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+        __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+        __m128i a_lo, a_hi, result, keep;
+
+        if (op->modulate) {
+            __m128i m = _mm_loadu_si128((const __m128i *)mod);
+            __m128i m_lo = _mm_mullo_epi16(s_lo, _mm_unpacklo_epi8(m, zero));
+            __m128i m_hi = _mm_mullo_epi16(s_hi, _mm_unpackhi_epi8(m, zero));
+            s_lo = DIV255_SSE2(m_lo);
+            s_hi = DIV255_SSE2(m_hi);
+            mod += 4;
+        }
+
+        switch (op->blend) {
+        case SDL_COPY_BLEND:
+        case SDL_COPY_ADD:
+            /* Premultiply the color channels with the source alpha */
+            a_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_lo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            a_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_hi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            s_lo = _mm_mullo_epi16(s_lo, _mm_or_si128(_mm_and_si128(a_lo, rgb_mask), alpha_255));
+            s_hi = _mm_mullo_epi16(s_hi, _mm_or_si128(_mm_and_si128(a_hi, rgb_mask), alpha_255));
+            s_lo = DIV255_SSE2(s_lo);
+            s_hi = DIV255_SSE2(s_hi);
+            if (op->blend == SDL_COPY_BLEND) {
+                d_lo = _mm_mullo_epi16(d_lo, _mm_sub_epi16(v255, a_lo));
+                d_hi = _mm_mullo_epi16(d_hi, _mm_sub_epi16(v255, a_hi));
+                d_lo = DIV255_SSE2(d_lo);
+                d_hi = DIV255_SSE2(d_hi);
+            }
+            /* The sum saturates when packing */
+            s_lo = _mm_add_epi16(s_lo, d_lo);
+            s_hi = _mm_add_epi16(s_hi, d_hi);
+            break;
+        case SDL_COPY_MOD:
+            s_lo = _mm_mullo_epi16(s_lo, d_lo);
+            s_hi = _mm_mullo_epi16(s_hi, d_hi);
+            s_lo = DIV255_SSE2(s_lo);
+            s_hi = DIV255_SSE2(s_hi);
+            break;
+        default:
+            break;
+        }
+        result = _mm_packus_epi16(s_lo, s_hi);
+
+        /* Add and mod keep the destination alpha */
+        keep = (op->blend == SDL_COPY_ADD || op->blend == SDL_COPY_MOD) ? d : result;
+        result = _mm_or_si128(_mm_andnot_si128(alpha_mask, result), _mm_and_si128(keep, dst_amask));
+        _mm_storeu_si128((__m128i *)dst, result);
+
+        src += 4;
+        dst += 4;
+        count -= 4;
+    }
+    blend_8888(src, mod, dst, count, op);
+}
+#endif
+
+#if defined(HAVE_NEON_INTRINSICS)
+/* x / 255, exact for x <= 65534 */
+#define DIV255_NEON(x) vshrq_n_u16(vaddq_u16(vaddq_u16((x), one), vshrq_n_u16((x), 8)), 8)
+
+/* Broadcast the alpha channel of each pixel to its 4 channels */
+static SDL_INLINE uint16x8_t alpha_16_NEON(uint16x8_t x)
+{
+    uint64x2_t a = vshrq_n_u64(vreinterpretq_u64_u16(x), 48);
+    a = vorrq_u64(a, vshlq_n_u64(a, 16));
+    a = vorrq_u64(a, vshlq_n_u64(a, 32));
+    return vreinterpretq_u16_u64(a);
+}
+
+static void blend_8888_NEON(const Uint32 *src, const Uint32 *mod, Uint32 *dst, int count, const TriangleBlend8888 *op)
+{
+    static const Uint16 rgb_mask_values[8] = { 0xFFFF, 0xFFFF, 0xFFFF, 0, 0xFFFF, 0xFFFF, 0xFFFF, 0 };
+    static const Uint16 alpha_255_values[8] = { 0, 0, 0, 255, 0, 0, 0, 255 };
+    const uint16x8_t one = vdupq_n_u16(1);
+    const uint16x8_t v255 = vdupq_n_u16(255);
+    const uint16x8_t rgb_mask = vld1q_u16(rgb_mask_values);
+    const uint16x8_t alpha_255 = vld1q_u16(alpha_255_values);
+    const uint32x4_t alpha_mask = vdupq_n_u32(0xFF000000);
+    const uint32x4_t src_alpha = vdupq_n_u32(op->src_alpha);
+    const uint32x4_t dst_amask = vdupq_n_u32(op->dst_amask);
+
+    while (count >= 4) {
+        uint32x4_t s = vorrq_u32(vld1q_u32(src), src_alpha);
+        uint32x4_t d = vld1q_u32(dst);
+        uint16x8_t s_lo = vmovl_u8(vget_low_u8(vreinterpretq_u8_u32(s)));
+        uint16x8_t s_hi = vmovl_u8(vget_high_u8(vreinterpretq_u8_u32(s)));
+        uint16x8_t d_lo = vmovl_u8(vget_low_u8(vreinterpretq_u8_u32(d)));
+        uint16x8_t d_hi = vmovl_u8(vget_high_u8(vreinterpretq_u8_u32(d)));
+        uint16x8_t a_lo, a_hi;
+        uint32x4_t result, keep;
+
+        if (op->modulate) {
+            uint8x16_t m = vreinterpretq_u8_u32(vld1q_u32(mod));
+            uint16x8_t m_lo = vmulq_u16(s_lo, vmovl_u8(vget_low_u8(m)));
+            uint16x8_t m_hi = vmulq_u16(s_hi, vmovl_u8(vget_high_u8(m)));
+            s_lo = DIV255_NEON(m_lo);
+            s_hi = DIV255_NEON(m_hi);
+            mod += 4;
+        }
+
+        switch (op->blend) {
+        case SDL_COPY_BLEND:
+        case SDL_COPY_ADD:
+            a_lo = alpha_16_NEON(s_lo);
+            a_hi = alpha_16_NEON(s_hi);
+            s_lo = vmulq_u16(s_lo, vorrq_u16(vandq_u16(a_lo, rgb_mask), alpha_255));
+            s_hi = vmulq_u16(s_hi, vorrq_u16(vandq_u16(a_hi, rgb_mask), alpha_255));
+            s_lo = DIV255_NEON(s_lo);
+            s_hi = DIV255_NEON(s_hi);
+            if (op->blend == SDL_COPY_BLEND) {
+                d_lo = vmulq_u16(d_lo, vsubq_u16(v255, a_lo));
+                d_hi = vmulq_u16(d_hi, vsubq_u16(v255, a_hi));
+                d_lo = DIV255_NEON(d_lo);
+                d_hi = DIV255_NEON(d_hi);
+            }
+            s_lo = vaddq_u16(s_lo, d_lo);
+            s_hi = vaddq_u16(s_hi, d_hi);
+            break;
+        case SDL_COPY_MOD:
+            s_lo = vmulq_u16(s_lo, d_lo);
+            s_hi = vmulq_u16(s_hi, d_hi);
+            s_lo = DIV255_NEON(s_lo);
+            s_hi = DIV255_NEON(s_hi);
+            break;
+        default:
+            break;
+        }
+        result = vreinterpretq_u32_u8(vcombine_u8(vqmovn_u16(s_lo), vqmovn_u16(s_hi)));
+
+        keep = (op->blend == SDL_COPY_ADD || op->blend == SDL_COPY_MOD) ? d : result;
+        result = vorrq_u32(vbicq_u32(result, alpha_mask), vandq_u32(keep, dst_amask));
+        vst1q_u32(dst, result);
+
+        src += 4;
+        dst += 4;
+        count -= 4;
+    }
+    blend_8888(src, mod, dst, count, op);
+}
+#endif
+
+typedef void (*Blend8888Func)(const Uint32 *src, const Uint32 *mod, Uint32 *dst, int count, const TriangleBlend8888 *op);
+
+static Blend8888Func get_blend_8888_func(void)
+{
+#if defined(HAVE_NEON_INTRINSICS)
+    if (SDL_HasNEON()) {
+        return blend_8888_NEON;
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (SDL_HasSSE2()) {
+        return blend_8888_SSE2;
+    }
+#endif
+    return blend_8888;
+}
+
+#define TRIANGLE_BLEND_BATCH 64
+
+/* Sample the texels and modulation colors of a span, then blend them in batches */
+static void blit_span_8888(Uint32 *dst, int count, const Uint8 *src, int src_pitch,
+                           TriangleInterp tex[2], TriangleInterp *color, Uint32 *mod, int area,
+                           Blend8888Func blend_func, const TriangleBlend8888 *op)
+{
+    Uint32 texels[TRIANGLE_BLEND_BATCH];
+    while (count > 0) {
+        int n = SDL_min(count, TRIANGLE_BLEND_BATCH);
+        int i;
+        for (i = 0; i < n; i++) {
+            texels[i] = ((const Uint32 *)(src + tex[1].q * src_pitch))[tex[0].q];
+            INTERP_STEP(tex[0], area);
+            INTERP_STEP(tex[1], area);
+        }
+        if (color) {
+            /* Interpolated modulation, packed as ARGB8888 */
+            for (i = 0; i < n; i++) {
+                mod[i] = ((Uint32)color[3].q << 24) | ((Uint32)color[0].q << 16) | ((Uint32)color[1].q << 8) | (Uint32)color[2].q;
+                INTERP_STEP(color[0], area);
+                INTERP_STEP(color[1], area);
+                INTERP_STEP(color[2], area);
+                INTERP_STEP(color[3], area);
+            }
+        }
+        blend_func(texels, mod, dst, n, op);
+        dst += n;
+        count -= n;
+    }
+}
+
 /* Triangle rendering, using Barycentric coordinates (w0, w1, w2)
  *
  * The cross product isn't computed from scratch at each iteration,
- * but optimized using constant step increments
+ * but optimized using constant step increments.
  *
+ * Each row only walks the span of pixels inside the three edges,
+ * (w0 + bias_w0 >= 0 && w1 + bias_w1 >= 0 && w2 + bias_w2 >= 0),
+ * which is solved once per row instead of testing every pixel of the bounding rect.
  */
 
-#define TRIANGLE_BEGIN_LOOP                                                        \
-    {                                                                              \
-        int x, y;                                                                  \
-        for (y = 0; y < dstrect.h; y++) {                                          \
-            /* y start */                                                          \
-            Sint64 w0 = w0_row;                                                    \
-            Sint64 w1 = w1_row;                                                    \
-            Sint64 w2 = w2_row;                                                    \
-            for (x = 0; x < dstrect.w; x++) {                                      \
-                /* In triangle */                                                  \
-                if (w0 + bias_w0 >= 0 && w1 + bias_w1 >= 0 && w2 + bias_w2 >= 0) { \
-                    Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
+#define TRIANGLE_BEGIN_SPAN                                                  \
+    {                                                                        \
+        int y;                                                               \
+        for (y = 0; y < dstrect.h; y++) {                                    \
+            int x_start, x_end;                                              \
+            triangle_span(w0_row, w1_row, w2_row, bias_w0, bias_w1, bias_w2, \
+                          d2d1_y, d0d2_y, d1d0_y, dstrect.w, &x_start, &x_end); \
+            if (x_start < x_end) {
+
+/* Barycentric coordinates at the start of the span */
+#define TRIANGLE_SPAN_WEIGHTS                           \
+    Sint64 w0 = w0_row + (Sint64)x_start * d2d1_y;      \
+    Sint64 w1 = w1_row + (Sint64)x_start * d0d2_y;      \
+    Sint64 w2 = w2_row + (Sint64)x_start * d1d0_y;
+
+#define TRIANGLE_END_SPAN \
+    }                     \
+    /* y += 1 */          \
+    w0_row += d1d2_x;     \
+    w1_row += d2d0_x;     \
+    w2_row += d0d1_x;     \
+    dst_ptr += dst_pitch; \
+    }                     \
+    }
+
+#define TRIANGLE_BEGIN_LOOP                                                                    \
+    TRIANGLE_BEGIN_SPAN                                                                        \
+    {                                                                                          \
+        TRIANGLE_SPAN_WEIGHTS                                                                  \
+        int x;                                                                                 \
+        for (x = x_start; x < x_end; x++, w0 += d2d1_y, w1 += d0d2_y, w2 += d1d0_y) {          \
+            Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
 
 /* Use 64 bits precision to prevent overflow when interpolating color / texture with wide triangles */
 #define TRIANGLE_GET_TEXTCOORD                                                          \
@@ -201,18 +781,8 @@ static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Poin
 
 #define TRIANGLE_END_LOOP \
     }                     \
-    /* x += 1 */          \
-    w0 += d2d1_y;         \
-    w1 += d0d2_y;         \
-    w2 += d1d0_y;         \
-    }                     \
-    /* y += 1 */          \
-    w0_row += d1d2_x;     \
-    w1_row += d2d0_x;     \
-    w2_row += d0d1_x;     \
-    dst_ptr += dst_pitch; \
     }                     \
-    }
+    TRIANGLE_END_SPAN
 
 int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Point *d2, SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2)
 {
@@ -366,11 +936,11 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
         }
 
         if (dstbpp == 4) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_SPAN
             {
-                *(Uint32 *)dptr = color;
+                SDL_memset4(dst_ptr + x_start * 4, color, x_end - x_start);
             }
-            TRIANGLE_END_LOOP
+            TRIANGLE_END_SPAN
         } else if (dstbpp == 3) {
             TRIANGLE_BEGIN_LOOP
             {
@@ -395,10 +965,49 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
         }
     } else {
         SDL_PixelFormat *format = dst->format;
+        int bytes[4];
         if (tmp) {
             format = tmp->format;
         }
-        if (dstbpp == 4) {
+        if (area <= TRIANGLE_INTERP_MAX_AREA && get_8888_channel_bytes(format, bytes)) {
+            const FillSpan8888Func fill_span = get_fill_span_8888();
+            const int has_alpha = (format->Amask != 0);
+            int values[3][4];
+            int i;
+
+            /* Color channels, in the order of the bytes of the pixel */
+            for (i = 0; i < 4; i++) {
+                values[0][i] = values[1][i] = values[2][i] = 0;
+            }
+            values[0][bytes[0]] = c0.r;
+            values[1][bytes[0]] = c1.r;
+            values[2][bytes[0]] = c2.r;
+            values[0][bytes[1]] = c0.g;
+            values[1][bytes[1]] = c1.g;
+            values[2][bytes[1]] = c2.g;
+            values[0][bytes[2]] = c0.b;
+            values[1][bytes[2]] = c1.b;
+            values[2][bytes[2]] = c2.b;
+            if (has_alpha) {
+                values[0][bytes[3]] = c0.a;
+                values[1][bytes[3]] = c1.a;
+                values[2][bytes[3]] = c2.a;
+            }
+
+            TRIANGLE_BEGIN_SPAN
+            {
+                TRIANGLE_SPAN_WEIGHTS
+                TriangleInterp interp[4];
+                for (i = 0; i < 4; i++) {
+                    interp_init(&interp[i],
+                                w0 * values[0][i] + w1 * values[1][i] + w2 * values[2][i],
+                                (Sint64)d2d1_y * values[0][i] + (Sint64)d0d2_y * values[1][i] + (Sint64)d1d0_y * values[2][i],
+                                (int)area);
+                }
+                fill_span((Uint32 *)(dst_ptr + x_start * 4), x_end - x_start, interp, (int)area);
+            }
+            TRIANGLE_END_SPAN
+        } else if (dstbpp == 4) {
             TRIANGLE_BEGIN_LOOP
             {
                 TRIANGLE_GET_MAPPED_COLOR
@@ -655,10 +1264,53 @@ int SDL_SW_BlitTriangle(
     }
 
     if (blend != SDL_BLENDMODE_NONE || src->format->format != dst->format->format || has_modulation || !is_uniform) {
-        /* Use SDL_BlitTriangle_Slow */
-
         SDL_BlitInfo *info = &src->map->info;
         SDL_BlitInfo tmp_info;
+        TriangleBlend8888 op;
+
+        if (area <= TRIANGLE_INTERP_MAX_AREA && get_blend_8888(src, dst, info->flags, has_modulation, &op)) {
+            const Blend8888Func blend_func = get_blend_8888_func();
+            const int values[4][3] = {
+                { c0.r, c1.r, c2.r },
+                { c0.g, c1.g, c2.g },
+                { c0.b, c1.b, c2.b },
+                { c0.a, c1.a, c2.a }
+            };
+            Uint32 mod[TRIANGLE_BLEND_BATCH];
+            int i;
+
+            if (is_uniform) {
+                for (i = 0; i < TRIANGLE_BLEND_BATCH; i++) {
+                    mod[i] = ((Uint32)c0.a << 24) | ((Uint32)c0.r << 16) | ((Uint32)c0.g << 8) | (Uint32)c0.b;
+                }
+            }
+
+            TRIANGLE_BEGIN_SPAN
+            {
+                TRIANGLE_SPAN_WEIGHTS
+                TriangleInterp tex[2];
+                TriangleInterp color[4];
+                interp_init(&tex[0], w0 * s2s0_x + w1 * s2s1_x + s2_x_area.x,
+                            (Sint64)d2d1_y * s2s0_x + (Sint64)d0d2_y * s2s1_x, (int)area);
+                interp_init(&tex[1], w0 * s2s0_y + w1 * s2s1_y + s2_x_area.y,
+                            (Sint64)d2d1_y * s2s0_y + (Sint64)d0d2_y * s2s1_y, (int)area);
+                if (!is_uniform) {
+                    for (i = 0; i < 4; i++) {
+                        interp_init(&color[i],
+                                    w0 * values[i][0] + w1 * values[i][1] + w2 * values[i][2],
+                                    (Sint64)d2d1_y * values[i][0] + (Sint64)d0d2_y * values[i][1] + (Sint64)d1d0_y * values[i][2],
+                                    (int)area);
+                    }
+                }
+                blit_span_8888((Uint32 *)(dst_ptr + x_start * 4), x_end - x_start, (const Uint8 *)src_ptr, src_pitch,
+                               tex, is_uniform ? NULL : color, mod, (int)area, blend_func, &op);
+            }
+            TRIANGLE_END_SPAN
+
+            goto end;
+        }
+
+        /* Use SDL_BlitTriangle_Slow */
 
         SDL_zero(tmp_info);
 
@@ -715,7 +1367,26 @@ int SDL_SW_BlitTriangle(
         goto end;
     }
 
-    if (dstbpp == 4) {
+    if (dstbpp == 4 && area <= TRIANGLE_INTERP_MAX_AREA) {
+        TRIANGLE_BEGIN_SPAN
+        {
+            const Sint64 w0 = w0_row + (Sint64)x_start * d2d1_y;
+            const Sint64 w1 = w1_row + (Sint64)x_start * d0d2_y;
+            Uint32 *dptr = (Uint32 *)(dst_ptr + x_start * 4);
+            int count = x_end - x_start;
+            TriangleInterp tex_x, tex_y;
+            interp_init(&tex_x, w0 * s2s0_x + w1 * s2s1_x + s2_x_area.x,
+                        (Sint64)d2d1_y * s2s0_x + (Sint64)d0d2_y * s2s1_x, (int)area);
+            interp_init(&tex_y, w0 * s2s0_y + w1 * s2s1_y + s2_x_area.y,
+                        (Sint64)d2d1_y * s2s0_y + (Sint64)d0d2_y * s2s1_y, (int)area);
+            while (count--) {
+                *dptr++ = ((Uint32 *)((Uint8 *)src_ptr + tex_y.q * src_pitch))[tex_x.q];
+                INTERP_STEP(tex_x, (int)area);
+                INTERP_STEP(tex_y, (int)area);
+            }
+        }
+        TRIANGLE_END_SPAN
+    } else if (dstbpp == 4) {
         TRIANGLE_BEGIN_LOOP
         {
             TRIANGLE_GET_TEXTCOORD
@@ -37,6 +37,9 @@ extern int SDL_SW_BlitTriangle(
 
 extern void trianglepoint_2_fixedpoint(SDL_Point *a);
 
+/* The pixels a triangle can touch before clipping, for points in fixed point. */
+extern void SDL_SW_GetTriangleBounds(const SDL_Point *d0, const SDL_Point *d1, const SDL_Point *d2, SDL_Rect *rect);
+
 #endif /* SDL_triangle_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
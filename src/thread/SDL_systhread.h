@@ -76,6 +76,21 @@ extern SDL_Thread *
 SDL_CreateThreadInternal(int(SDLCALL *fn)(void *), const char *name,
                          const size_t stacksize, void *data);
 
+/* A pool of threads that run one batch of jobs at a time, for splitting up
+   work internally. SDL_RunWorkerPool() calls func once for each index in
+   [0, count), on the pool's threads and the calling thread, and returns when
+   they've all finished. thread_index is in [0, SDL_GetWorkerPoolThreads()],
+   with the calling thread being 0, so it can pick per-thread scratch data.
+   Only one thread may run a batch on a pool at a time. If num_threads is 0
+   or threads can't be created, everything runs on the calling thread. */
+typedef struct SDL_WorkerPool SDL_WorkerPool;
+typedef void (*SDL_WorkerPoolFunc)(void *userdata, int index, int thread_index);
+
+extern SDL_WorkerPool *SDL_CreateWorkerPool(const char *name, int num_threads);
+extern int SDL_GetWorkerPoolThreads(SDL_WorkerPool *pool);
+extern void SDL_RunWorkerPool(SDL_WorkerPool *pool, SDL_WorkerPoolFunc func, void *userdata, int count);
+extern void SDL_DestroyWorkerPool(SDL_WorkerPool *pool);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
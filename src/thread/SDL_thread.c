@@ -515,4 +515,171 @@ void SDL_DetachThread(SDL_Thread *thread)
     }
 }
 
+struct SDL_WorkerPool
+{
+    SDL_mutex *lock;
+    SDL_cond *start_cond;     /* workers wait here for the next batch. */
+    SDL_cond *done_cond;      /* SDL_RunWorkerPool() waits here for the workers. */
+    SDL_Thread **threads;
+    int num_threads;
+    SDL_bool quit;
+    Uint32 batch;             /* bumped for every batch, so workers know there's a new one. */
+    int busy;                 /* workers still running the current batch. */
+    SDL_WorkerPoolFunc func;
+    void *userdata;
+    int count;
+    SDL_atomic_t next;        /* next index to hand out. */
+};
+
+typedef struct SDL_WorkerPoolThread
+{
+    SDL_WorkerPool *pool;
+    int thread_index;
+} SDL_WorkerPoolThread;
+
+static void SDL_RunWorkerPoolJobs(SDL_WorkerPool *pool, SDL_WorkerPoolFunc func, void *userdata, int count, int thread_index)
+{
+    int index;
+    while ((index = SDL_AtomicAdd(&pool->next, 1)) < count) {
+        func(userdata, index, thread_index);
+    }
+}
+
+static int SDLCALL SDL_WorkerPoolThreadFunc(void *data)
+{
+    SDL_WorkerPoolThread *thread = (SDL_WorkerPoolThread *)data;
+    SDL_WorkerPool *pool = thread->pool;
+    const int thread_index = thread->thread_index;
+    Uint32 batch = 0;
+
+    SDL_free(thread);
+
+    SDL_LockMutex(pool->lock);
+    while (!pool->quit) {
+        if (batch != pool->batch) {
+            SDL_WorkerPoolFunc func = pool->func;
+            void *userdata = pool->userdata;
+            const int count = pool->count;
+
+            batch = pool->batch;
+            SDL_UnlockMutex(pool->lock);
+            SDL_RunWorkerPoolJobs(pool, func, userdata, count, thread_index);
+            SDL_LockMutex(pool->lock);
+            if (--pool->busy == 0) {
+                SDL_CondSignal(pool->done_cond);
+            }
+        } else {
+            SDL_CondWait(pool->start_cond, pool->lock);
+        }
+    }
+    SDL_UnlockMutex(pool->lock);
+
+    return 0;
+}
+
+SDL_WorkerPool *SDL_CreateWorkerPool(const char *name, int num_threads)
+{
+    SDL_WorkerPool *pool = (SDL_WorkerPool *)SDL_calloc(1, sizeof(*pool));
+    int i;
+
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    if (num_threads <= 0) {
+        return pool; /* just runs everything on the calling thread. */
+    }
+
+    pool->lock = SDL_CreateMutex();
+    pool->start_cond = SDL_CreateCond();
+    pool->done_cond = SDL_CreateCond();
+    pool->threads = (SDL_Thread **)SDL_calloc(num_threads, sizeof(SDL_Thread *));
+    if (!pool->lock || !pool->start_cond || !pool->done_cond || !pool->threads) {
+        SDL_DestroyWorkerPool(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WorkerPoolThread *thread = (SDL_WorkerPoolThread *)SDL_malloc(sizeof(*thread));
+        if (!thread) {
+            break;
+        }
+        thread->pool = pool;
+        thread->thread_index = i + 1;
+        pool->threads[i] = SDL_CreateThreadInternal(SDL_WorkerPoolThreadFunc, name, 0, thread);
+        if (!pool->threads[i]) {
+            SDL_free(thread);
+            break;
+        }
+        pool->num_threads++;
+    }
+    /* if we couldn't get all the threads we asked for, make do with what we have. */
+    return pool;
+}
+
+int SDL_GetWorkerPoolThreads(SDL_WorkerPool *pool)
+{
+    return pool ? pool->num_threads : 0;
+}
+
+void SDL_RunWorkerPool(SDL_WorkerPool *pool, SDL_WorkerPoolFunc func, void *userdata, int count)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    if (!pool || pool->num_threads == 0 || count == 1) {
+        int i;
+        for (i = 0; i < count; ++i) {
+            func(userdata, i, 0);
+        }
+        return;
+    }
+
+    SDL_LockMutex(pool->lock);
+    pool->func = func;
+    pool->userdata = userdata;
+    pool->count = count;
+    SDL_AtomicSet(&pool->next, 0);
+    pool->busy = pool->num_threads;
+    pool->batch++;
+    SDL_CondBroadcast(pool->start_cond);
+    SDL_UnlockMutex(pool->lock);
+
+    SDL_RunWorkerPoolJobs(pool, func, userdata, count, 0);
+
+    SDL_LockMutex(pool->lock);
+    while (pool->busy > 0) {
+        SDL_CondWait(pool->done_cond, pool->lock);
+    }
+    SDL_UnlockMutex(pool->lock);
+}
+
+void SDL_DestroyWorkerPool(SDL_WorkerPool *pool)
+{
+    int i;
+
+    if (!pool) {
+        return;
+    }
+
+    if (pool->num_threads > 0) {
+        SDL_LockMutex(pool->lock);
+        pool->quit = SDL_TRUE;
+        SDL_CondBroadcast(pool->start_cond);
+        SDL_UnlockMutex(pool->lock);
+
+        for (i = 0; i < pool->num_threads; ++i) {
+            SDL_WaitThread(pool->threads[i], NULL);
+        }
+    }
+
+    SDL_free(pool->threads);
+    SDL_DestroyCond(pool->done_cond);
+    SDL_DestroyCond(pool->start_cond);
+    SDL_DestroyMutex(pool->lock);
+    SDL_free(pool);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
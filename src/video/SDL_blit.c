@@ -20,6 +20,7 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_hints.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -28,6 +29,131 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../thread/SDL_systhread.h"
+
+/* Smaller blits always run on the calling thread, splitting them up costs
+   more than it saves. */
+#define SDL_BLIT_MIN_PARALLEL_PIXELS (512 * 512)
+
+/* Threads for SDL_HINT_BLIT_THREADS. The lock is held while the pool runs a
+   blit, so only one blit at a time runs on it. */
+static SDL_SpinLock SDL_blit_workers_lock;
+static SDL_WorkerPool *SDL_blit_workers;
+static int SDL_blit_num_threads;
+
+typedef struct
+{
+    SDL_BlitBandFunc func;
+    void *userdata;
+    int height;
+    int band_height;
+} SDL_BlitBands;
+
+static void SDL_RunBlitBand(void *userdata, int index, int thread_index)
+{
+    SDL_BlitBands *bands = (SDL_BlitBands *)userdata;
+    const int first_row = index * bands->band_height;
+
+    bands->func(bands->userdata, first_row, SDL_min(bands->band_height, bands->height - first_row));
+}
+
+/* Returns the pool for SDL_HINT_BLIT_THREADS, or NULL if the hint asks for a
+   single thread. Must be called with SDL_blit_workers_lock held. */
+static SDL_WorkerPool *SDL_GetBlitWorkers(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_BLIT_THREADS);
+    int num_threads = (hint && *hint) ? SDL_atoi(hint) : 1;
+
+    if (num_threads <= 0) {
+        num_threads = SDL_GetCPUCount();
+    }
+    if (num_threads <= 1) {
+        return NULL;
+    }
+
+    if (!SDL_blit_workers || num_threads != SDL_blit_num_threads) {
+        SDL_DestroyWorkerPool(SDL_blit_workers);
+        SDL_blit_workers = SDL_CreateWorkerPool("SDLBlit", num_threads - 1);
+        SDL_blit_num_threads = num_threads;
+    }
+    return SDL_blit_workers;
+}
+
+static SDL_bool SDL_SurfacePixelsOverlap(SDL_Surface *src, SDL_Surface *dst)
+{
+    const Uint8 *src_pixels = (const Uint8 *)src->pixels;
+    const Uint8 *dst_pixels = (const Uint8 *)dst->pixels;
+
+    return (src_pixels < dst_pixels + (size_t)dst->h * dst->pitch &&
+            dst_pixels < src_pixels + (size_t)src->h * src->pitch);
+}
+
+SDL_bool SDL_RunBlitBands(SDL_Surface *src, SDL_Surface *dst, int width, int height,
+                          SDL_BlitBandFunc func, void *userdata)
+{
+    SDL_WorkerPool *workers;
+    SDL_BlitBands bands;
+    int num_bands;
+
+    if ((Sint64)width * height < SDL_BLIT_MIN_PARALLEL_PIXELS) {
+        return SDL_FALSE;
+    }
+
+    /* rows that are read by one band could be written by another one */
+    if (SDL_SurfacePixelsOverlap(src, dst)) {
+        return SDL_FALSE;
+    }
+
+    /* if another thread is using the pool, just blit on this one. */
+    if (!SDL_AtomicTryLock(&SDL_blit_workers_lock)) {
+        return SDL_FALSE;
+    }
+
+    workers = SDL_GetBlitWorkers();
+    if (!workers) {
+        SDL_AtomicUnlock(&SDL_blit_workers_lock);
+        return SDL_FALSE;
+    }
+
+    bands.func = func;
+    bands.userdata = userdata;
+    bands.height = height;
+    bands.band_height = (height + SDL_blit_num_threads - 1) / SDL_blit_num_threads;
+    num_bands = (height + bands.band_height - 1) / bands.band_height;
+
+    SDL_RunWorkerPool(workers, SDL_RunBlitBand, &bands, num_bands);
+
+    SDL_AtomicUnlock(&SDL_blit_workers_lock);
+
+    return SDL_TRUE;
+}
+
+void SDL_QuitBlit(void)
+{
+    SDL_AtomicLock(&SDL_blit_workers_lock);
+    SDL_DestroyWorkerPool(SDL_blit_workers);
+    SDL_blit_workers = NULL;
+    SDL_blit_num_threads = 0;
+    SDL_AtomicUnlock(&SDL_blit_workers_lock);
+}
+
+typedef struct
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+} SDL_SoftBlitBands;
+
+static void SDL_SoftBlitBand(void *userdata, int first_row, int num_rows)
+{
+    const SDL_SoftBlitBands *bands = (const SDL_SoftBlitBands *)userdata;
+    SDL_BlitInfo info = *bands->info;
+
+    info.src += first_row * info.src_pitch;
+    info.src_h = num_rows;
+    info.dst += first_row * info.dst_pitch;
+    info.dst_h = num_rows;
+    bands->blit(&info);
+}
 
 /* The general purpose software blit routine */
 static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
@@ -63,6 +189,7 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
     if (okay && !SDL_RectEmpty(srcrect)) {
         SDL_BlitFunc RunBlit;
         SDL_BlitInfo *info = &src->map->info;
+        SDL_SoftBlitBands bands;
 
         /* Set up the blit information */
         info->src = (Uint8 *)src->pixels +
@@ -83,8 +210,15 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
             info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
         RunBlit = (SDL_BlitFunc)src->map->data;
 
-        /* Run the actual software blit */
-        RunBlit(info);
+        /* Run the actual software blit, in bands if it's big enough.
+           Scaled blits step through the source from the top, so they
+           always run in one piece. */
+        bands.blit = RunBlit;
+        bands.info = info;
+        if (info->src_w != info->dst_w || info->src_h != info->dst_h ||
+            !SDL_RunBlitBands(src, dst, info->dst_w, info->dst_h, SDL_SoftBlitBand, &bands)) {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -158,6 +292,9 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int
                     features |= SDL_CPU_ALTIVEC_NOPREFETCH;
                 }
             }
+            if (SDL_HasNEON()) {
+                features |= SDL_CPU_NEON;
+            }
         }
     }
 
@@ -241,7 +378,7 @@ int SDL_CalculateBlit(SDL_Surface *surface)
     }
 #endif
 #if SDL_HAVE_BLIT_A
-    else if (map->info.flags & SDL_COPY_BLEND) {
+    else if (map->info.flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED)) {
         blit = SDL_CalculateBlitA(surface);
     }
 #endif
@@ -251,7 +388,8 @@ int SDL_CalculateBlit(SDL_Surface *surface)
     }
 #endif
 #if SDL_HAVE_BLIT_AUTO
-    if (!blit) {
+    /* The generated blitters only know about straight alpha */
+    if (!blit && !(map->info.flags & SDL_COPY_BLEND_PREMULTIPLIED)) {
         Uint32 src_format = surface->format->format;
         Uint32 dst_format = dst->format->format;
 
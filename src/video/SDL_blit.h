@@ -45,11 +45,22 @@ extern Uint8 *SDL_expand_byte[9];
 #define SDL_COPY_MUL            0x00000080
 #define SDL_COPY_COLORKEY       0x00000100
 #define SDL_COPY_NEAREST        0x00000200
+#define SDL_COPY_BLEND_PREMULTIPLIED 0x00000400
 #define SDL_COPY_RLE_DESIRED    0x00001000
 #define SDL_COPY_RLE_COLORKEY   0x00002000
 #define SDL_COPY_RLE_ALPHAKEY   0x00004000
 #define SDL_COPY_RLE_MASK       (SDL_COPY_RLE_DESIRED | SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY)
 
+/* The custom blend mode that selects SDL_COPY_BLEND_PREMULTIPLIED, as built by
+   SDL_ComposeCustomBlendMode(ONE, ONE_MINUS_SRC_ALPHA, ADD, ONE, ONE_MINUS_SRC_ALPHA, ADD) */
+#define SDL_BLENDMODE_BLEND_PREMULTIPLIED                                       \
+    (SDL_BlendMode)(((Uint32)SDL_BLENDOPERATION_ADD << 0) |                     \
+                    ((Uint32)SDL_BLENDFACTOR_ONE << 4) |                        \
+                    ((Uint32)SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA << 8) |        \
+                    ((Uint32)SDL_BLENDOPERATION_ADD << 16) |                    \
+                    ((Uint32)SDL_BLENDFACTOR_ONE << 20) |                       \
+                    ((Uint32)SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA << 24))
+
 /* SDL blit CPU flags */
 #define SDL_CPU_ANY                0x00000000
 #define SDL_CPU_MMX                0x00000001
@@ -58,6 +69,7 @@ extern Uint8 *SDL_expand_byte[9];
 #define SDL_CPU_SSE2               0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000020
+#define SDL_CPU_NEON               0x00000040
 
 typedef struct
 {
@@ -88,6 +100,25 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* The number of earlier mappings each surface remembers, so switching
+   between a few destinations doesn't recalculate the blit every time */
+#define SDL_BLITMAP_CACHE_SIZE 4
+
+/* A mapping to a destination other than the current one */
+typedef struct
+{
+    SDL_Surface *dst;
+    SDL_PixelFormat *dst_fmt;
+    int flags;
+    Uint8 r, g, b, a;
+    int identity;
+    SDL_blit blit;
+    void *data;
+    Uint8 *table;
+    Uint32 dst_palette_version;
+    Uint32 src_palette_version;
+} SDL_BlitMapCacheEntry;
+
 /* Blit mapping definition */
 /* typedef'ed in SDL_surface.h */
 struct SDL_BlitMap
@@ -102,11 +133,25 @@ struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    /* earlier mappings, keyed by destination format and blit flags,
+       oldest first */
+    SDL_BlitMapCacheEntry cache[SDL_BLITMAP_CACHE_SIZE];
+    int num_cached;
 };
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface *surface);
 
+/* Splits a blit of width x height destination pixels into bands of rows and
+   runs func on each of them in parallel, as SDL_HINT_BLIT_THREADS asks.
+   Returns SDL_FALSE without calling func if the blit should run on the
+   calling thread instead. */
+typedef void (*SDL_BlitBandFunc)(void *userdata, int first_row, int num_rows);
+extern SDL_bool SDL_RunBlitBands(SDL_Surface *src, SDL_Surface *dst, int width, int height,
+                                 SDL_BlitBandFunc func, void *userdata);
+extern void SDL_QuitBlit(void);
+
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
 extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface *surface);
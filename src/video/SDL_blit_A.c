@@ -643,6 +643,152 @@ static void BlitRGBtoBGRPixelAlpha(SDL_BlitInfo *info)
     }
 }
 
+/* fast (A)RGB888->(A)RGB888 blending of premultiplied pixels:
+   dst = src + dst * (255 - srcA) / 255, rounded and saturated.
+   The color masks are byte aligned, so all four bytes blend the same way */
+static void BlitRGBtoRGBPremultipliedPixelAlpha(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    int ashift = info->src_fmt->Ashift;
+
+    while (height--) {
+        /* *INDENT-OFF* */ /* clang-format off */
+        DUFFS_LOOP4({
+        Uint32 s = *srcp;
+        Uint32 alpha = (s >> ashift) & 0xFF;
+        if (alpha == SDL_ALPHA_OPAQUE) {
+            *dstp = s;
+        } else {
+            Uint32 d = *dstp;
+            Uint32 inv = alpha ^ 0xFF;
+            Uint32 d1 = (d & 0xff00ff) * inv + 0x800080;
+            Uint32 d2 = ((d >> 8) & 0xff00ff) * inv + 0x800080;
+            Uint32 m;
+            /* (t + (t >> 8)) >> 8 rounds t = x * a + 128 to x * a / 255 */
+            d1 = ((d1 + ((d1 >> 8) & 0xff00ff)) >> 8) & 0xff00ff;
+            d2 = ((d2 + ((d2 >> 8) & 0xff00ff)) >> 8) & 0xff00ff;
+            d1 += s & 0xff00ff;
+            d2 += (s >> 8) & 0xff00ff;
+            /* saturate the components that overflowed into bit 8 */
+            m = d1 & 0x1000100;
+            d1 = (d1 | (m - (m >> 8))) & 0xff00ff;
+            m = d2 & 0x1000100;
+            d2 = (d2 | (m - (m >> 8))) & 0xff00ff;
+            *dstp = d1 | (d2 << 8);
+        }
+        ++srcp;
+        ++dstp;
+        }, width);
+        /* *INDENT-ON* */ /* clang-format on */
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+#ifdef __SSE2__
+/* SSE2 version of BlitRGBtoRGBPremultipliedPixelAlpha(), 4 pixels at a time */
+static void BlitRGBtoRGBPremultipliedPixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i ashift = _mm_cvtsi32_si128(info->src_fmt->Ashift);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ff = _mm_set1_epi16(0xFF);
+    const __m128i round = _mm_set1_epi16(0x80);
+    const __m128i alpha_byte = _mm_set1_epi32(0xFF);
+
+    while (height--) {
+        int n;
+
+        for (n = width; n >= 4; n -= 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *)srcp);
+            const __m128i d = _mm_loadu_si128((const __m128i *)dstp);
+            __m128i alpha, inv_lo, inv_hi, lo, hi;
+
+            /* spread 255 - alpha over the four 16-bit lanes of each pixel */
+            alpha = _mm_and_si128(_mm_srl_epi32(s, ashift), alpha_byte);
+            alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+            inv_lo = _mm_sub_epi16(ff, _mm_unpacklo_epi32(alpha, alpha));
+            inv_hi = _mm_sub_epi16(ff, _mm_unpackhi_epi32(alpha, alpha));
+
+            lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv_lo), round);
+            hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv_hi), round);
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+            _mm_storeu_si128((__m128i *)dstp, _mm_adds_epu8(s, _mm_packus_epi16(lo, hi)));
+            srcp += 4;
+            dstp += 4;
+        }
+        if (n) {
+            SDL_BlitInfo tail = *info;
+            tail.src = (Uint8 *)srcp;
+            tail.dst = (Uint8 *)dstp;
+            tail.dst_w = n;
+            tail.dst_h = 1;
+            BlitRGBtoRGBPremultipliedPixelAlpha(&tail);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif /* __SSE2__ */
+
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+/* NEON version of BlitRGBtoRGBPremultipliedPixelAlpha(), 8 pixels at a time */
+static void BlitRGBtoRGBPremultipliedPixelAlphaNEON(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const int alpha_index = info->src_fmt->Ashift / 8;
+
+    while (height--) {
+        int n, i;
+
+        for (n = width; n >= 8; n -= 8) {
+            const uint8x8x4_t s = vld4_u8((const uint8_t *)srcp);
+            uint8x8x4_t d = vld4_u8((const uint8_t *)dstp);
+            const uint8x8_t inv = vmvn_u8(s.val[alpha_index]);
+
+            for (i = 0; i < 4; ++i) {
+                const uint16x8_t product = vmull_u8(d.val[i], inv);
+                d.val[i] = vqadd_u8(s.val[i], vraddhn_u16(product, vrshrq_n_u16(product, 8)));
+            }
+            vst4_u8((uint8_t *)dstp, d);
+            srcp += 8;
+            dstp += 8;
+        }
+        if (n) {
+            SDL_BlitInfo tail = *info;
+            tail.src = (Uint8 *)srcp;
+            tail.dst = (Uint8 *)dstp;
+            tail.dst_w = n;
+            tail.dst_h = 1;
+            BlitRGBtoRGBPremultipliedPixelAlpha(&tail);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif
+
 #ifdef __3dNOW__
 /* fast (as in MMX with prefetch) ARGB888->(A)RGB888 blending with pixel alpha */
 static void BlitRGBtoRGBPixelAlphaMMX3DNOW(SDL_BlitInfo *info)
@@ -1496,6 +1642,25 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
         }
         return BlitNtoNPixelAlpha;
 
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        /* Premultiplied pixels, everything else goes through SDL_Blit_Slow() */
+        if (sf->BytesPerPixel == 4 && df->BytesPerPixel == 4 &&
+            sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->Amask == df->Amask &&
+            sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 && sf->Amask && sf->Aloss == 0) {
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+            if (SDL_HasNEON()) {
+                return BlitRGBtoRGBPremultipliedPixelAlphaNEON;
+            }
+#endif
+#ifdef __SSE2__
+            if (SDL_HasSSE2()) {
+                return BlitRGBtoRGBPremultipliedPixelAlphaSSE2;
+            }
+#endif
+            return BlitRGBtoRGBPremultipliedPixelAlpha;
+        }
+        break;
+
     case SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND:
         if (sf->Amask == 0) {
             /* Per-surface alpha blits */
@@ -6860,132 +6860,13336 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef __SSE2__
+
+/* The SSE2 blitters work on two pixels at a time, each channel widened to
+   16 bits and sorted in destination order, with alpha in lanes 3 and 7 */
+
+/* Computes x / 255 exactly for x in [0, 255 * 255] */
+static SDL_INLINE __m128i SDL_Blit_Div255_SSE2(__m128i x)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+
+static SDL_INLINE __m128i SDL_Blit_Blend_SSE2(__m128i src, __m128i dst, int flags)
+{
+    const __m128i alpha_mask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i v255 = _mm_set1_epi16(0xFF);
+    const __m128i srcA = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, 0xFF), 0xFF);
+    const __m128i inv_srcA = _mm_sub_epi16(v255, srcA);
+    __m128i result;
+
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        const __m128i factor = _mm_or_si128(_mm_andnot_si128(alpha_mask, srcA), _mm_and_si128(alpha_mask, v255));
+        src = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src, factor));
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+    case SDL_COPY_BLEND:
+        return _mm_add_epi16(src, SDL_Blit_Div255_SSE2(_mm_mullo_epi16(inv_srcA, dst)));
+    case SDL_COPY_ADD:
+        result = _mm_min_epi16(_mm_add_epi16(src, dst), v255);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    case SDL_COPY_MUL:
+    {
+        /* The sum doesn't fit in 16 bits, so divide the terms separately */
+        const __m128i p = _mm_mullo_epi16(src, dst);
+        const __m128i q = _mm_mullo_epi16(dst, inv_srcA);
+        const __m128i quotient = _mm_add_epi16(SDL_Blit_Div255_SSE2(p), SDL_Blit_Div255_SSE2(q));
+        const __m128i remainder = _mm_sub_epi16(_mm_add_epi16(p, q), _mm_mullo_epi16(quotient, v255));
+        result = _mm_min_epi16(_mm_add_epi16(quotient, SDL_Blit_Div255_SSE2(remainder)), v255);
+        break;
+    }
+    default:
+        return dst;
+    }
+    /* The destination alpha is left alone */
+    return _mm_or_si128(_mm_andnot_si128(alpha_mask, result), _mm_and_si128(alpha_mask, dst));
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0xC6), 0xC6);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0xC6), 0xC6);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateB, modulateG, modulateR, modulateA, modulateB, modulateG, modulateR);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x39), 0x39);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x39), 0x39);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            pixels = _mm_and_si128(pixels, dstmask);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 4;
+            dst_row += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const Sint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Sint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Sint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Sint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const __m128i modulate = _mm_set_epi16(modulateA, modulateR, modulateG, modulateB, modulateA, modulateR, modulateG, modulateB);
+    Uint32 srcbuf[4], dstbuf[4];
+    __m128i pixels, src_lo, src_hi;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 4) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 4); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 4) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, 0x1B), 0x1B);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, 0x1B), 0x1B);
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+            _mm_storeu_si128((__m128i *)d, pixels);
+
+            if (n < 4) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 4;
+            n -= 4;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif
+
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+
+/* The NEON blitters work on eight pixels at a time, with the channels
+   deinterleaved in destination order and alpha in val[3] */
+
+/* Computes x / 255 exactly for x in [0, 255 * 255] */
+static SDL_INLINE uint16x8_t SDL_Blit_Div255_NEON(uint16x8_t x)
+{
+    return vshrq_n_u16(vaddq_u16(vsraq_n_u16(x, x, 8), vdupq_n_u16(1)), 8);
+}
+
+static SDL_INLINE uint8x8_t SDL_Blit_Div255_Narrow_NEON(uint16x8_t x)
+{
+    return vaddhn_u16(vsraq_n_u16(x, x, 8), vdupq_n_u16(1));
+}
+
+static SDL_INLINE uint8x8x4_t SDL_Blit_Blend_NEON(uint8x8x4_t src, uint8x8x4_t dst, int flags)
+{
+    const uint8x8_t srcA = src.val[3];
+    const uint8x8_t inv_srcA = vmvn_u8(srcA);
+    int i;
+
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        for (i = 0; i < 3; ++i) {
+            src.val[i] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[i], srcA));
+        }
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+    case SDL_COPY_BLEND:
+        for (i = 0; i < 4; ++i) {
+            dst.val[i] = vadd_u8(src.val[i], SDL_Blit_Div255_Narrow_NEON(vmull_u8(inv_srcA, dst.val[i])));
+        }
+        break;
+    case SDL_COPY_ADD:
+        for (i = 0; i < 3; ++i) {
+            dst.val[i] = vqadd_u8(src.val[i], dst.val[i]);
+        }
+        break;
+    case SDL_COPY_MOD:
+        for (i = 0; i < 3; ++i) {
+            dst.val[i] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[i], dst.val[i]));
+        }
+        break;
+    case SDL_COPY_MUL:
+        for (i = 0; i < 3; ++i) {
+            /* The sum doesn't fit in 16 bits, so divide the terms separately */
+            const uint16x8_t p = vmull_u8(src.val[i], dst.val[i]);
+            const uint16x8_t q = vmull_u8(dst.val[i], inv_srcA);
+            const uint16x8_t quotient = vaddq_u16(SDL_Blit_Div255_NEON(p), SDL_Blit_Div255_NEON(q));
+            const uint16x8_t remainder = vmlsq_n_u16(vaddq_u16(p, q), quotient, 0xFF);
+            dst.val[i] = vqmovn_u16(vaddq_u16(quotient, SDL_Blit_Div255_NEON(remainder)));
+        }
+        break;
+    }
+    return dst;
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = vdup_n_u8(0xFF);
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[0];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[2];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[2];
+            src.val[1] = pixels.val[1];
+            src.val[2] = pixels.val[0];
+            src.val[3] = pixels.val[3];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[1];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[3];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateR));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateB));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            src.val[3] = vdup_n_u8(0);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Pad the last group of pixels out to a full vector */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src_row += 8;
+            dst_row += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const uint8x8_t modulateR = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF);
+    const uint8x8_t modulateG = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF);
+    const uint8x8_t modulateB = vdup_n_u8((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF);
+    const uint8x8_t modulateA = vdup_n_u8((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    Uint32 srcbuf[8], dstbuf[8];
+    uint8x8x4_t pixels, src;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < 8) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, 8); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < 8) {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+                d = dstbuf;
+            }
+
+            pixels = vld4_u8((const Uint8 *)s);
+            src.val[0] = pixels.val[3];
+            src.val[1] = pixels.val[2];
+            src.val[2] = pixels.val[1];
+            src.val[3] = pixels.val[0];
+            src.val[0] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[0], modulateB));
+            src.val[1] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[1], modulateG));
+            src.val[2] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[2], modulateR));
+            src.val[3] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[3], modulateA));
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+            vst4_u8((Uint8 *)d, src);
+
+            if (n < 8) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            dst_row += 8;
+            n -= 8;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
 };
@@ -129,6 +129,8 @@ const char *SDL_GetPixelFormatName(Uint32 format)
         CASE(SDL_PIXELFORMAT_YVYU)
         CASE(SDL_PIXELFORMAT_NV12)
         CASE(SDL_PIXELFORMAT_NV21)
+        CASE(SDL_PIXELFORMAT_P010)
+        CASE(SDL_PIXELFORMAT_P016)
         CASE(SDL_PIXELFORMAT_EXTERNAL_OES)
 
     default:
@@ -737,6 +739,9 @@ int SDL_SetPaletteColors(SDL_Palette *palette, const SDL_Color *colors,
     return status;
 }
 
+/* Drops the lookup table of a palette that is being freed, see SDL_FindColor() */
+static void SDL_FreePaletteLookup(SDL_Palette *palette);
+
 void SDL_FreePalette(SDL_Palette *palette)
 {
     if (!palette) {
@@ -746,6 +751,7 @@ void SDL_FreePalette(SDL_Palette *palette)
     if (--palette->refcount > 0) {
         return;
     }
+    SDL_FreePaletteLookup(palette);
     SDL_free(palette->colors);
     SDL_free(palette);
 }
@@ -778,6 +784,188 @@ void SDL_DitherColors(SDL_Color *colors, int bpp)
     }
 }
 
+/*
+ * Inverse color map for SDL_FindColor()
+ *
+ * Palettes that are searched over and over, by SDL_MapRGB() on indexed
+ * surfaces or when building blit maps to them, get a lookup table. The RGB
+ * space is split into cells by the top SDL_PALETTE_LOOKUP_BITS of each
+ * component, and each cell lists the palette entries that can be the closest
+ * one to some color inside of it. Cells are built the first time they are
+ * used, and searching only their entries gives exactly the same result as
+ * searching the whole palette.
+ *
+ * Apps may change palette->colors directly without bumping the version, and
+ * SDL_MapRGB() used to pick those changes up, so each table also keeps a copy
+ * of the entries it was built from and is reset when they differ.
+ */
+#define SDL_PALETTE_LOOKUP_BITS      5
+#define SDL_PALETTE_LOOKUP_CELLS     (1 << (3 * SDL_PALETTE_LOOKUP_BITS))
+#define SDL_PALETTE_LOOKUP_SLOTS     4
+/* Full searches of a palette version before it gets a table */
+#define SDL_PALETTE_LOOKUP_THRESHOLD 256
+
+typedef struct SDL_PaletteLookup
+{
+    SDL_Palette *palette;
+    Uint32 version;
+    int ncolors;
+    SDL_Color colors[256];
+    int searches;
+    Uint32 *cells; /* (offset + 1) << 8 | (count - 1) into candidates, 0 if not built yet */
+    Uint8 *candidates;
+    size_t num_candidates;
+    size_t max_candidates;
+} SDL_PaletteLookup;
+
+static SDL_PaletteLookup SDL_palette_lookups[SDL_PALETTE_LOOKUP_SLOTS];
+static int SDL_palette_lookup_next;
+static SDL_SpinLock SDL_palette_lookup_lock;
+
+static void SDL_ResetPaletteLookup(SDL_PaletteLookup *lookup, SDL_Palette *pal, SDL_bool keep_tables)
+{
+    if (keep_tables) {
+        if (lookup->cells) {
+            SDL_memset(lookup->cells, 0, SDL_PALETTE_LOOKUP_CELLS * sizeof(*lookup->cells));
+        }
+    } else {
+        SDL_free(lookup->cells);
+        SDL_free(lookup->candidates);
+        lookup->cells = NULL;
+        lookup->candidates = NULL;
+        lookup->max_candidates = 0;
+    }
+    lookup->num_candidates = 0;
+    lookup->palette = pal;
+    lookup->version = pal ? pal->version : 0;
+    lookup->ncolors = pal ? pal->ncolors : 0;
+    if (pal) {
+        SDL_memcpy(lookup->colors, pal->colors, pal->ncolors * sizeof(*pal->colors));
+    }
+    lookup->searches = 0;
+}
+
+/* Call with SDL_palette_lookup_lock held */
+static SDL_PaletteLookup *SDL_GetPaletteLookup(SDL_Palette *pal)
+{
+    SDL_PaletteLookup *lookup;
+    int i;
+
+    for (i = 0; i < SDL_PALETTE_LOOKUP_SLOTS; ++i) {
+        lookup = &SDL_palette_lookups[i];
+        if (lookup->palette == pal) {
+            if (lookup->version != pal->version || lookup->ncolors != pal->ncolors ||
+                SDL_memcmp(lookup->colors, pal->colors, pal->ncolors * sizeof(*pal->colors)) != 0) {
+                SDL_ResetPaletteLookup(lookup, pal, SDL_TRUE);
+            }
+            return lookup;
+        }
+    }
+
+    lookup = &SDL_palette_lookups[SDL_palette_lookup_next];
+    SDL_palette_lookup_next = (SDL_palette_lookup_next + 1) % SDL_PALETTE_LOOKUP_SLOTS;
+    SDL_ResetPaletteLookup(lookup, pal, SDL_FALSE);
+    return lookup;
+}
+
+static void SDL_FreePaletteLookup(SDL_Palette *palette)
+{
+    int i;
+
+    SDL_AtomicLock(&SDL_palette_lookup_lock);
+    for (i = 0; i < SDL_PALETTE_LOOKUP_SLOTS; ++i) {
+        if (SDL_palette_lookups[i].palette == palette) {
+            SDL_ResetPaletteLookup(&SDL_palette_lookups[i], NULL, SDL_FALSE);
+        }
+    }
+    SDL_AtomicUnlock(&SDL_palette_lookup_lock);
+}
+
+static SDL_bool SDL_BuildPaletteLookupCell(SDL_PaletteLookup *lookup, int cell)
+{
+    const SDL_Palette *pal = lookup->palette;
+    const int mask = (1 << SDL_PALETTE_LOOKUP_BITS) - 1;
+    const int size = 1 << (8 - SDL_PALETTE_LOOKUP_BITS);
+    int lo[3], hi[3], c[3];
+    unsigned int mindist[256];
+    unsigned int limit = ~0U;
+    size_t offset;
+    int i, j;
+
+    lo[0] = ((cell >> (2 * SDL_PALETTE_LOOKUP_BITS)) & mask) * size;
+    lo[1] = ((cell >> SDL_PALETTE_LOOKUP_BITS) & mask) * size;
+    lo[2] = (cell & mask) * size;
+    for (j = 0; j < 3; ++j) {
+        hi[j] = lo[j] + size - 1;
+    }
+
+    /* Any entry that is always farther than some other entry can't be the closest */
+    for (i = 0; i < pal->ncolors; ++i) {
+        const int ad = pal->colors[i].a - SDL_ALPHA_OPAQUE;
+        unsigned int nearest = ad * ad;
+        unsigned int farthest = ad * ad;
+
+        c[0] = pal->colors[i].r;
+        c[1] = pal->colors[i].g;
+        c[2] = pal->colors[i].b;
+        for (j = 0; j < 3; ++j) {
+            const int near_d = (c[j] < lo[j]) ? (lo[j] - c[j]) : (c[j] > hi[j]) ? (c[j] - hi[j]) : 0;
+            const int far_d = SDL_max(c[j] - lo[j], hi[j] - c[j]);
+            nearest += near_d * near_d;
+            farthest += far_d * far_d;
+        }
+        mindist[i] = nearest;
+        limit = SDL_min(limit, farthest);
+    }
+
+    if (lookup->num_candidates + pal->ncolors > lookup->max_candidates) {
+        size_t max_candidates = SDL_max(lookup->max_candidates * 2, lookup->num_candidates + pal->ncolors);
+        Uint8 *candidates = (Uint8 *)SDL_realloc(lookup->candidates, max_candidates);
+        if (!candidates) {
+            return SDL_FALSE;
+        }
+        lookup->candidates = candidates;
+        lookup->max_candidates = max_candidates;
+    }
+
+    offset = lookup->num_candidates;
+    for (i = 0; i < pal->ncolors; ++i) {
+        if (mindist[i] <= limit) {
+            lookup->candidates[lookup->num_candidates++] = (Uint8)i;
+        }
+    }
+    lookup->cells[cell] = (Uint32)((offset + 1) << 8) | (Uint32)(lookup->num_candidates - offset - 1);
+    return SDL_TRUE;
+}
+
+/* Returns the palette entries to search for an opaque color, or NULL to search them all */
+static const Uint8 *SDL_GetPaletteLookupCandidates(SDL_PaletteLookup *lookup, Uint8 r, Uint8 g, Uint8 b, int *count)
+{
+    int cell;
+    Uint32 entry;
+
+    if (lookup->searches < SDL_PALETTE_LOOKUP_THRESHOLD) {
+        ++lookup->searches;
+        return NULL;
+    }
+    if (!lookup->cells) {
+        lookup->cells = (Uint32 *)SDL_calloc(SDL_PALETTE_LOOKUP_CELLS, sizeof(*lookup->cells));
+        if (!lookup->cells) {
+            return NULL;
+        }
+    }
+
+    cell = ((r >> (8 - SDL_PALETTE_LOOKUP_BITS)) << (2 * SDL_PALETTE_LOOKUP_BITS)) |
+           ((g >> (8 - SDL_PALETTE_LOOKUP_BITS)) << SDL_PALETTE_LOOKUP_BITS) |
+           (b >> (8 - SDL_PALETTE_LOOKUP_BITS));
+    if (!lookup->cells[cell] && !SDL_BuildPaletteLookupCell(lookup, cell)) {
+        return NULL;
+    }
+    entry = lookup->cells[cell];
+    *count = (int)(entry & 0xFF) + 1;
+    return lookup->candidates + (entry >> 8) - 1;
+}
+
 /*
  * Match an RGB value to a particular palette index
  */
@@ -790,6 +978,38 @@ Uint8 SDL_FindColor(SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     int i;
     Uint8 pixel = 0;
 
+    /* The lookup tables are for opaque colors, which is what SDL_MapRGB() and
+       the blit maps mostly look for. If another thread is using them, just
+       do the full search. */
+    if (a == SDL_ALPHA_OPAQUE && pal->ncolors > 1 && pal->ncolors <= 256 &&
+        SDL_AtomicTryLock(&SDL_palette_lookup_lock)) {
+        int count = 0;
+        const Uint8 *candidates = SDL_GetPaletteLookupCandidates(SDL_GetPaletteLookup(pal), r, g, b, &count);
+
+        if (candidates) {
+            /* Same as below, entries are in order so ties pick the same one */
+            smallest = ~0U;
+            for (i = 0; i < count; ++i) {
+                const SDL_Color *color = &pal->colors[candidates[i]];
+                rd = color->r - r;
+                gd = color->g - g;
+                bd = color->b - b;
+                ad = color->a - a;
+                distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+                if (distance < smallest) {
+                    pixel = candidates[i];
+                    if (distance == 0) { /* Perfect match! */
+                        break;
+                    }
+                    smallest = distance;
+                }
+            }
+            SDL_AtomicUnlock(&SDL_palette_lookup_lock);
+            return pixel;
+        }
+        SDL_AtomicUnlock(&SDL_palette_lookup_lock);
+    }
+
     smallest = ~0;
     for (i = 0; i < pal->ncolors; ++i) {
         rd = pal->colors[i].r - r;
@@ -1028,12 +1248,18 @@ void SDL_InvalidateAllBlitMap(SDL_Surface *surface)
 
     while (l) {
         SDL_ListNode *tmp = l;
-        SDL_InvalidateMap((SDL_BlitMap *)l->entry);
+        SDL_BlitMap *map = (SDL_BlitMap *)l->entry;
+        if (map->dst == surface) {
+            SDL_InvalidateMap(map);
+        }
+        SDL_InvalidateBlitMapCache(map, surface);
         l = l->next;
         SDL_free(tmp);
     }
 }
 
+/* The cached mappings are keyed by everything that goes into them, so
+   they stay around when the current mapping becomes invalid */
 void SDL_InvalidateMap(SDL_BlitMap *map)
 {
     if (!map) {
@@ -1050,14 +1276,128 @@ void SDL_InvalidateMap(SDL_BlitMap *map)
     map->info.table = NULL;
 }
 
+static void SDL_FreeCachedMap(SDL_BlitMap *map, int index)
+{
+    SDL_BlitMapCacheEntry *entry = &map->cache[index];
+
+    SDL_ListRemove((SDL_ListNode **)&(entry->dst->list_blitmap), map);
+    SDL_free(entry->table);
+
+    --map->num_cached;
+    SDL_memmove(entry, entry + 1, (map->num_cached - index) * sizeof(*entry));
+}
+
+void SDL_InvalidateBlitMapCache(SDL_BlitMap *map, SDL_Surface *dst)
+{
+    int i;
+
+    if (!map) {
+        return;
+    }
+    for (i = map->num_cached - 1; i >= 0; --i) {
+        if (!dst || map->cache[i].dst == dst) {
+            SDL_FreeCachedMap(map, i);
+        }
+    }
+}
+
+/* Moves the current mapping into the cache, if it's still usable */
+static void SDL_CacheMap(SDL_Surface *src)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_BlitMapCacheEntry *entry;
+
+    if (!map->dst || !map->blit) {
+        return;
+    }
+    /* RLE encoding is tied to the surface, so it can't be swapped out */
+    if ((map->info.flags & SDL_COPY_RLE_DESIRED) || (src->flags & SDL_RLEACCEL)) {
+        return;
+    }
+    if ((map->dst->format->palette &&
+         map->dst_palette_version != map->dst->format->palette->version) ||
+        (src->format->palette &&
+         map->src_palette_version != src->format->palette->version)) {
+        return;
+    }
+
+    if (map->num_cached == SDL_BLITMAP_CACHE_SIZE) {
+        SDL_FreeCachedMap(map, 0);
+    }
+    entry = &map->cache[map->num_cached++];
+    entry->dst = map->dst;
+    entry->dst_fmt = map->dst->format;
+    entry->flags = map->info.flags;
+    entry->r = map->info.r;
+    entry->g = map->info.g;
+    entry->b = map->info.b;
+    entry->a = map->info.a;
+    entry->identity = map->identity;
+    entry->blit = map->blit;
+    entry->data = map->data;
+    entry->table = map->info.table;
+    entry->dst_palette_version = map->dst_palette_version;
+    entry->src_palette_version = map->src_palette_version;
+
+    /* The entry takes over the table and the destination registration */
+    map->dst = NULL;
+    map->info.table = NULL;
+}
+
+/* Restores an earlier mapping to a destination with the same format */
+static SDL_bool SDL_RestoreCachedMap(SDL_Surface *src, SDL_Surface *dst)
+{
+    SDL_BlitMap *map = src->map;
+    const Uint32 dst_palette_version = dst->format->palette ? dst->format->palette->version : 0;
+    const Uint32 src_palette_version = src->format->palette ? src->format->palette->version : 0;
+    int i;
+
+    for (i = map->num_cached - 1; i >= 0; --i) {
+        SDL_BlitMapCacheEntry *entry = &map->cache[i];
+
+        if (entry->dst_fmt != dst->format ||
+            entry->flags != map->info.flags ||
+            entry->r != map->info.r || entry->g != map->info.g ||
+            entry->b != map->info.b || entry->a != map->info.a ||
+            entry->dst_palette_version != dst_palette_version ||
+            entry->src_palette_version != src_palette_version) {
+            continue;
+        }
+
+        if (entry->dst != dst) {
+            if (SDL_ListAdd((SDL_ListNode **)&(dst->list_blitmap), map) < 0) {
+                return SDL_FALSE;
+            }
+            SDL_ListRemove((SDL_ListNode **)&(entry->dst->list_blitmap), map);
+        }
+        map->dst = dst;
+        map->identity = entry->identity;
+        map->blit = entry->blit;
+        map->data = entry->data;
+        map->info.table = entry->table;
+        map->info.src_fmt = src->format;
+        map->info.src_pitch = src->pitch;
+        map->info.dst_fmt = dst->format;
+        map->info.dst_pitch = dst->pitch;
+        map->dst_palette_version = dst_palette_version;
+        map->src_palette_version = src_palette_version;
+
+        --map->num_cached;
+        SDL_memmove(entry, entry + 1, (map->num_cached - i) * sizeof(*entry));
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
 int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
 {
     SDL_PixelFormat *srcfmt;
     SDL_PixelFormat *dstfmt;
     SDL_BlitMap *map;
 
-    /* Clear out any previous mapping */
+    /* Clear out any previous mapping, keeping it if we might come back */
     map = src->map;
+    SDL_CacheMap(src);
 #if SDL_HAVE_RLE
     if ((src->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
         SDL_UnRLESurface(src, 1);
@@ -1065,6 +1405,10 @@ int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
 #endif
     SDL_InvalidateMap(map);
 
+    if (SDL_RestoreCachedMap(src, dst)) {
+        return 0;
+    }
+
     /* Figure out what kind of mapping we're doing */
     map->identity = 0;
     srcfmt = src->format;
@@ -1136,6 +1480,7 @@ void SDL_FreeBlitMap(SDL_BlitMap *map)
 {
     if (map) {
         SDL_InvalidateMap(map);
+        SDL_InvalidateBlitMapCache(map, NULL);
         SDL_free(map);
     }
 }
@@ -161,7 +161,9 @@ static int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
     left_pad_w_init = left_pad_w;                                                     \
     right_pad_w_init = right_pad_w;                                                   \
     dst_gap = dst_pitch - 4 * dst_w;                                                  \
-    middle_init = dst_w - left_pad_w - right_pad_w;
+    middle_init = dst_w - left_pad_w - right_pad_w;                                   \
+    fp_sum_h += (Sint64)first_row * fp_step_h;                                        \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)first_row * dst_pitch);
 
 #define BILINEAR___HEIGHT                                              \
     int index_h, frac_h0, frac_h1, middle;                             \
@@ -289,11 +291,12 @@ static SDL_INLINE void INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int
 }
 
 static int scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch,
-                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                     int first_row, int num_rows)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
 
         BILINEAR___HEIGHT
 
@@ -414,11 +417,11 @@ static SDL_INLINE void INTERPOL_BILINEAR_SSE(const Uint32 *s0, const Uint32 *s1,
     *dst = _mm_cvtsi128_si32(e0);
 }
 
-static int scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static int scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
         int nb_block2;
         __m128i v_frac_h0;
         __m128i v_frac_h1;
@@ -578,11 +581,11 @@ static SDL_INLINE void INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1
     *dst = vget_lane_u32(CAST_uint32x2_t e0, 0);
 }
 
-static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
         int nb_block4;
         uint8x8_t v_frac_h0, v_frac_h1;
 
@@ -796,10 +799,58 @@ static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch
 }
 #endif
 
+typedef int (*SDL_ScaleMatFunc)(const Uint32 *src, int src_w, int src_h, int src_pitch,
+                                Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                                int first_row, int num_rows);
+
+typedef struct
+{
+    SDL_ScaleMatFunc scale;
+    const Uint32 *src;
+    int src_w;
+    int src_h;
+    int src_pitch;
+    Uint32 *dst;
+    int dst_w;
+    int dst_h;
+    int dst_pitch;
+} SDL_ScaleMatBands;
+
+static void scale_mat_band(void *userdata, int first_row, int num_rows)
+{
+    const SDL_ScaleMatBands *bands = (const SDL_ScaleMatBands *)userdata;
+
+    bands->scale(bands->src, bands->src_w, bands->src_h, bands->src_pitch,
+                 bands->dst, bands->dst_w, bands->dst_h, bands->dst_pitch,
+                 first_row, num_rows);
+}
+
+/* Every row is computed from the destination row index alone, so large
+   stretches can be split into bands of rows. */
+static int scale_mat_parallel(SDL_ScaleMatFunc scale, SDL_Surface *s, const Uint32 *src, int src_w, int src_h, int src_pitch,
+                              SDL_Surface *d, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+{
+    SDL_ScaleMatBands bands;
+
+    bands.scale = scale;
+    bands.src = src;
+    bands.src_w = src_w;
+    bands.src_h = src_h;
+    bands.src_pitch = src_pitch;
+    bands.dst = dst;
+    bands.dst_w = dst_w;
+    bands.dst_h = dst_h;
+    bands.dst_pitch = dst_pitch;
+    if (SDL_RunBlitBands(s, d, dst_w, dst_h, scale_mat_band, &bands)) {
+        return 0;
+    }
+    return scale(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, 0, dst_h);
+}
+
 int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
                                SDL_Surface *d, const SDL_Rect *dstrect)
 {
-    int ret = -1;
+    SDL_ScaleMatFunc scale = NULL;
     int src_w = srcrect->w;
     int src_h = srcrect->h;
     int dst_w = dstrect->w;
@@ -810,22 +861,22 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
 
 #if defined(HAVE_NEON_INTRINSICS)
-    if (ret == -1 && hasNEON()) {
-        ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    if (!scale && hasNEON()) {
+        scale = scale_mat_NEON;
     }
 #endif
 
 #if defined(HAVE_SSE2_INTRINSICS)
-    if (ret == -1 && hasSSE2()) {
-        ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    if (!scale && hasSSE2()) {
+        scale = scale_mat_SSE;
     }
 #endif
 
-    if (ret == -1) {
-        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    if (!scale) {
+        scale = scale_mat;
     }
 
-    return ret;
+    return scale_mat_parallel(scale, s, src, src_w, src_h, src_pitch, d, dst, dst_w, dst_h, dst_pitch);
 }
 
 #define SDL_SCALE_NEAREST__START          \
@@ -838,7 +889,8 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     incy = ((Uint64)src_h << 16) / dst_h; \
     incx = ((Uint64)src_w << 16) / dst_w; \
     dst_gap = dst_pitch - bpp * dst_w;    \
-    posy = incy / 2;
+    posy = incy / 2 + first_row * incy;   \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)first_row * dst_pitch);
 
 #define SDL_SCALE_NEAREST__HEIGHT                                         \
     srcy = (posy >> 16);                                                  \
@@ -848,11 +900,12 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     n = dst_w;
 
 static int scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                               int first_row, int num_rows)
 {
     Uint32 bpp = 1;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -868,11 +921,12 @@ static int scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                               int first_row, int num_rows)
 {
     Uint32 bpp = 2;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint16 *src;
@@ -888,11 +942,12 @@ static int scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                               int first_row, int num_rows)
 {
     Uint32 bpp = 3;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -910,11 +965,12 @@ static int scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch,
+                               int first_row, int num_rows)
 {
     Uint32 bpp = 4;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint32 *src;
@@ -940,19 +996,22 @@ int SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
     int dst_pitch = d->pitch;
 
     const int bpp = d->format->BytesPerPixel;
+    SDL_ScaleMatFunc scale;
 
     Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * src_pitch);
     Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
 
     if (bpp == 4) {
-        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        scale = scale_mat_nearest_4;
     } else if (bpp == 3) {
-        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        scale = scale_mat_nearest_3;
     } else if (bpp == 2) {
-        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        scale = scale_mat_nearest_2;
     } else {
-        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        scale = scale_mat_nearest_1;
     }
+
+    return scale_mat_parallel(scale, s, src, src_w, src_h, src_pitch, d, dst, dst_w, dst_h, dst_pitch);
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -303,7 +303,11 @@ int SDL_SetSurfacePalette(SDL_Surface *surface, SDL_Palette *palette)
     if (SDL_SetPixelFormatPalette(surface->format, palette) < 0) {
         return -1;
     }
+    /* The new palette may have the same version as the old one, so drop
+       every mapping that used it */
     SDL_InvalidateMap(surface->map);
+    SDL_InvalidateBlitMapCache(surface->map, NULL);
+    SDL_InvalidateAllBlitMap(surface);
 
     return 0;
 }
@@ -578,8 +582,8 @@ int SDL_SetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode blendMode)
     status = 0;
     flags = surface->map->info.flags;
     surface->map->info.flags &=
-        ~(SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
-    switch (blendMode) {
+        ~(SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    switch ((int)blendMode) {
     case SDL_BLENDMODE_NONE:
         break;
     case SDL_BLENDMODE_BLEND:
@@ -594,6 +598,9 @@ int SDL_SetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode blendMode)
     case SDL_BLENDMODE_MUL:
         surface->map->info.flags |= SDL_COPY_MUL;
         break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        surface->map->info.flags |= SDL_COPY_BLEND_PREMULTIPLIED;
+        break;
     default:
         status = SDL_Unsupported();
         break;
@@ -616,10 +623,13 @@ int SDL_GetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode *blendMode)
         return 0;
     }
 
-    switch (surface->map->info.flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+    switch (surface->map->info.flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
     case SDL_COPY_BLEND:
         *blendMode = SDL_BLENDMODE_BLEND;
         break;
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        *blendMode = SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+        break;
     case SDL_COPY_ADD:
         *blendMode = SDL_BLENDMODE_ADD;
         break;
@@ -960,7 +970,8 @@ int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect,
                                SDL_Surface *dst, SDL_Rect *dstrect, SDL_ScaleMode scaleMode)
 {
     static const Uint32 complex_copy_flags = (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
-                                              SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL |
+                                              SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED |
+                                              SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL |
                                               SDL_COPY_COLORKEY);
 
     if (srcrect->w > SDL_MAX_UINT16 || srcrect->h > SDL_MAX_UINT16 ||
@@ -1474,29 +1485,179 @@ int SDL_ConvertPixels(int width, int height,
     return ret;
 }
 
-/*
- * Premultiply the alpha on a block of pixels
- *
- * This is currently only implemented for SDL_PIXELFORMAT_ARGB8888
- *
- * Here are some ideas for optimization:
- * https://github.com/Wizermil/premultiply_alpha/tree/master/premultiply_alpha
- * https://developer.arm.com/documentation/101964/0201/Pre-multiplied-alpha-channel-data
- */
-int SDL_PremultiplyAlpha(int width, int height,
-                         Uint32 src_format, const void *src, int src_pitch,
-                         Uint32 dst_format, void *dst, int dst_pitch)
+/* The 32-bit formats with alpha that SDL_PremultiplyAlpha() handles keep
+   alpha either in the top or in the bottom byte and the colors in the others.
+   Returns the shift of the alpha byte, or -1 for other formats. */
+static int SDL_GetAlphaShift8888(Uint32 format)
 {
-    int c;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    switch (format) {
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        return 24;
+    case SDL_PIXELFORMAT_RGBA8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+        return 0;
+    default:
+        return -1;
+    }
+}
 
-    if (!src) {
+/* Premultiplies one pixel, rounding c * a / 255 to the nearest integer.
+   With t = c * a + 128, (t + (t >> 8)) >> 8 gives exactly that for all
+   8-bit c and a, and two of the colors fit in one 32-bit multiply. */
+static SDL_INLINE Uint32 SDL_PremultiplyPixel(Uint32 pixel, int alpha_shift)
+{
+    const Uint32 alpha = (pixel >> alpha_shift) & 0xFF;
+    const int color_shift = alpha_shift ? 0 : 8;
+    Uint32 rb, g;
+
+    if (alpha == 0xFF) {
+        return pixel;
+    }
+
+    rb = ((pixel >> color_shift) & 0x00FF00FF) * alpha + 0x00800080;
+    rb = ((rb + ((rb >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+    g = ((pixel >> (color_shift + 8)) & 0xFF) * alpha + 0x80;
+    g = (g + (g >> 8)) >> 8;
+
+    return ((rb | (g << 8)) << color_shift) | (alpha << alpha_shift);
+}
+
+#ifdef __SSE2__
+#define PREMULTIPLY_ALPHA_SSE2(alpha_lane)                                                      \
+    for (; x + 4 <= width; x += 4) {                                                            \
+        const __m128i pixels = _mm_loadu_si128((const __m128i *)(src + x));                     \
+        __m128i lo = _mm_unpacklo_epi8(pixels, zero);                                           \
+        __m128i hi = _mm_unpackhi_epi8(pixels, zero);                                           \
+        const __m128i alpha_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, alpha_lane), alpha_lane); \
+        const __m128i alpha_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, alpha_lane), alpha_lane); \
+        lo = _mm_add_epi16(_mm_mullo_epi16(lo, alpha_lo), round);                               \
+        hi = _mm_add_epi16(_mm_mullo_epi16(hi, alpha_hi), round);                               \
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);                       \
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);                       \
+        _mm_storeu_si128((__m128i *)(dst + x),                                                  \
+                         _mm_or_si128(_mm_and_si128(pixels, alpha_mask),                        \
+                                      _mm_andnot_si128(alpha_mask, _mm_packus_epi16(lo, hi)))); \
+    }
+
+/* Premultiplies 4 pixels at a time, returns how many pixels were done */
+static int SDL_PremultiplyAlphaRow_SSE2(const Uint32 *src, Uint32 *dst, int width, int alpha_shift)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(0x80);
+    const __m128i alpha_mask = _mm_set1_epi32((int)(0xFFu << alpha_shift));
+    int x = 0;
+
+    /* the alpha of each pixel is spread over its four 16-bit lanes */
+    if (alpha_shift) {
+        PREMULTIPLY_ALPHA_SSE2(_MM_SHUFFLE(3, 3, 3, 3))
+    } else {
+        PREMULTIPLY_ALPHA_SSE2(_MM_SHUFFLE(0, 0, 0, 0))
+    }
+    return x;
+}
+#undef PREMULTIPLY_ALPHA_SSE2
+#endif /* __SSE2__ */
+
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+/* Premultiplies 8 pixels at a time, returns how many pixels were done */
+static int SDL_PremultiplyAlphaRow_NEON(const Uint32 *src, Uint32 *dst, int width, int alpha_shift)
+{
+    /* the channels in memory order, alpha is the last or the first byte */
+    const int alpha_index = alpha_shift ? 3 : 0;
+    int x = 0, i;
+
+    for (; x + 8 <= width; x += 8) {
+        uint8x8x4_t pixels = vld4_u8((const uint8_t *)(src + x));
+        const uint8x8_t alpha = pixels.val[alpha_index];
+
+        for (i = 0; i < 4; ++i) {
+            if (i != alpha_index) {
+                /* (t + (t >> 8)) >> 8 with t = c * a + 128, as in SDL_PremultiplyPixel() */
+                const uint16x8_t product = vmull_u8(pixels.val[i], alpha);
+                pixels.val[i] = vraddhn_u16(product, vrshrq_n_u16(product, 8));
+            }
+        }
+        vst4_u8((uint8_t *)(dst + x), pixels);
+    }
+    return x;
+}
+#endif
+
+/* ceil(255 * 65536 / a), with it (c * recip + 32768) >> 16 is c * 255 / a
+   rounded to the nearest integer, for all 8-bit c and a */
+static const Uint32 SDL_unpremultiply_reciprocals[256] = {
+    0x00000000, 0x00ff0000, 0x007f8000, 0x00550000, 0x003fc000, 0x00330000, 0x002a8000, 0x00246db7,
+    0x001fe000, 0x001c5556, 0x00198000, 0x00172e8c, 0x00154000, 0x00139d8a, 0x001236dc, 0x00110000,
+    0x000ff000, 0x000f0000, 0x000e2aab, 0x000d6bcb, 0x000cc000, 0x000c2493, 0x000b9746, 0x000b1643,
+    0x000aa000, 0x000a3334, 0x0009cec5, 0x000971c8, 0x00091b6e, 0x0008cb09, 0x00088000, 0x000839cf,
+    0x0007f800, 0x0007ba2f, 0x00078000, 0x00074925, 0x00071556, 0x0006e454, 0x0006b5e6, 0x000689d9,
+    0x00066000, 0x00063832, 0x0006124a, 0x0005ee24, 0x0005cba3, 0x0005aaab, 0x00058b22, 0x00056cf0,
+    0x00055000, 0x0005343f, 0x0005199a, 0x00050000, 0x0004e763, 0x0004cfb3, 0x0004b8e4, 0x0004a2e9,
+    0x00048db7, 0x00047944, 0x00046585, 0x00045271, 0x00044000, 0x00042e2a, 0x00041ce8, 0x00040c31,
+    0x0003fc00, 0x0003ec4f, 0x0003dd18, 0x0003ce55, 0x0003c000, 0x0003b217, 0x0003a493, 0x00039770,
+    0x00038aab, 0x00037e40, 0x0003722a, 0x00036667, 0x00035af3, 0x00034fcb, 0x000344ed, 0x00033a55,
+    0x00033000, 0x000325ee, 0x00031c19, 0x00031282, 0x00030925, 0x00030000, 0x0002f712, 0x0002ee59,
+    0x0002e5d2, 0x0002dd7c, 0x0002d556, 0x0002cd5d, 0x0002c591, 0x0002bdf0, 0x0002b678, 0x0002af29,
+    0x0002a800, 0x0002a0fe, 0x00029a20, 0x00029365, 0x00028ccd, 0x00028657, 0x00028000, 0x000279ca,
+    0x000273b2, 0x00026db7, 0x000267da, 0x00026218, 0x00025c72, 0x000256e7, 0x00025175, 0x00024c1c,
+    0x000246dc, 0x000241b3, 0x00023ca2, 0x000237a7, 0x000232c3, 0x00022df3, 0x00022939, 0x00022493,
+    0x00022000, 0x00021b82, 0x00021715, 0x000212bc, 0x00020e74, 0x00020a3e, 0x00020619, 0x00020205,
+    0x0001fe00, 0x0001fa0c, 0x0001f628, 0x0001f253, 0x0001ee8c, 0x0001ead4, 0x0001e72b, 0x0001e38f,
+    0x0001e000, 0x0001dc80, 0x0001d90c, 0x0001d5a4, 0x0001d24a, 0x0001cefb, 0x0001cbb8, 0x0001c881,
+    0x0001c556, 0x0001c235, 0x0001bf20, 0x0001bc15, 0x0001b915, 0x0001b61f, 0x0001b334, 0x0001b052,
+    0x0001ad7a, 0x0001aaab, 0x0001a7e6, 0x0001a52a, 0x0001a277, 0x00019fcc, 0x00019d2b, 0x00019a91,
+    0x00019800, 0x00019578, 0x000192f7, 0x0001907e, 0x00018e0d, 0x00018ba3, 0x00018941, 0x000186e6,
+    0x00018493, 0x00018246, 0x00018000, 0x00017dc2, 0x00017b89, 0x00017958, 0x0001772d, 0x00017508,
+    0x000172e9, 0x000170d1, 0x00016ebe, 0x00016cb2, 0x00016aab, 0x000168aa, 0x000166af, 0x000164b9,
+    0x000162c9, 0x000160de, 0x00015ef8, 0x00015d18, 0x00015b3c, 0x00015966, 0x00015795, 0x000155c8,
+    0x00015400, 0x0001523e, 0x0001507f, 0x00014ec5, 0x00014d10, 0x00014b5f, 0x000149b3, 0x0001480b,
+    0x00014667, 0x000144c7, 0x0001432c, 0x00014194, 0x00014000, 0x00013e71, 0x00013ce5, 0x00013b5d,
+    0x000139d9, 0x00013859, 0x000136dc, 0x00013563, 0x000133ed, 0x0001327b, 0x0001310c, 0x00012fa1,
+    0x00012e39, 0x00012cd5, 0x00012b74, 0x00012a16, 0x000128bb, 0x00012763, 0x0001260e, 0x000124bd,
+    0x0001236e, 0x00012223, 0x000120da, 0x00011f94, 0x00011e51, 0x00011d11, 0x00011bd4, 0x00011a99,
+    0x00011962, 0x0001182c, 0x000116fa, 0x000115ca, 0x0001149d, 0x00011372, 0x0001124a, 0x00011124,
+    0x00011000, 0x00010ee0, 0x00010dc1, 0x00010ca5, 0x00010b8b, 0x00010a73, 0x0001095e, 0x0001084b,
+    0x0001073a, 0x0001062c, 0x0001051f, 0x00010415, 0x0001030d, 0x00010207, 0x00010103, 0x00010000,
+};
+
+static SDL_INLINE Uint32 SDL_UnpremultiplyPixel(Uint32 pixel, int alpha_shift)
+{
+    const Uint32 alpha = (pixel >> alpha_shift) & 0xFF;
+    const int color_shift = alpha_shift ? 0 : 8;
+    Uint32 recip, c0, c1, c2;
+
+    if (alpha == 0xFF) {
+        return pixel;
+    }
+    if (alpha == 0) {
+        return 0;
+    }
+
+    recip = SDL_unpremultiply_reciprocals[alpha];
+    c0 = (((pixel >> color_shift) & 0xFF) * recip + 0x8000) >> 16;
+    c1 = (((pixel >> (color_shift + 8)) & 0xFF) * recip + 0x8000) >> 16;
+    c2 = (((pixel >> (color_shift + 16)) & 0xFF) * recip + 0x8000) >> 16;
+    c0 = SDL_min(c0, 0xFF);
+    c1 = SDL_min(c1, 0xFF);
+    c2 = SDL_min(c2, 0xFF);
+
+    return ((c0 | (c1 << 8) | (c2 << 16)) << color_shift) | (alpha << alpha_shift);
+}
+
+/* Checks the parameters shared by SDL_PremultiplyAlpha() and
+   SDL_UnpremultiplyAlpha(), and converts the pixels to dst_format first if
+   the formats differ. Returns the alpha shift of dst_format. */
+static int SDL_PrepareAlphaConversion(int width, int height,
+                                      Uint32 src_format, const void **src, int *src_pitch,
+                                      Uint32 dst_format, void *dst, int dst_pitch)
+{
+    int alpha_shift;
+
+    if (!*src) {
         return SDL_InvalidParamError("src");
     }
-    if (!src_pitch) {
+    if (!*src_pitch) {
         return SDL_InvalidParamError("src_pitch");
     }
     if (!dst) {
@@ -1505,30 +1666,91 @@ int SDL_PremultiplyAlpha(int width, int height,
     if (!dst_pitch) {
         return SDL_InvalidParamError("dst_pitch");
     }
-    if (src_format != SDL_PIXELFORMAT_ARGB8888) {
+    if (SDL_GetAlphaShift8888(src_format) < 0) {
         return SDL_InvalidParamError("src_format");
     }
-    if (dst_format != SDL_PIXELFORMAT_ARGB8888) {
+    alpha_shift = SDL_GetAlphaShift8888(dst_format);
+    if (alpha_shift < 0) {
         return SDL_InvalidParamError("dst_format");
     }
 
+    if (src_format != dst_format) {
+        /* Swizzling the channels doesn't change their values */
+        if (SDL_ConvertPixels(width, height, src_format, *src, *src_pitch, dst_format, dst, dst_pitch) < 0) {
+            return -1;
+        }
+        *src = dst;
+        *src_pitch = dst_pitch;
+    }
+    return alpha_shift;
+}
+
+/*
+ * Premultiply the alpha on a block of pixels
+ *
+ * This is implemented for the 32-bit formats with 8 bits of alpha in the
+ * top or bottom byte: SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888,
+ * SDL_PIXELFORMAT_RGBA8888 and SDL_PIXELFORMAT_BGRA8888
+ */
+int SDL_PremultiplyAlpha(int width, int height,
+                         Uint32 src_format, const void *src, int src_pitch,
+                         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const int alpha_shift = SDL_PrepareAlphaConversion(width, height, src_format, &src, &src_pitch, dst_format, dst, dst_pitch);
+#ifdef __SSE2__
+    const SDL_bool has_sse2 = SDL_HasSSE2();
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    const SDL_bool has_neon = SDL_HasNEON();
+#endif
+
+    if (alpha_shift < 0) {
+        return -1;
+    }
+
+    while (height--) {
+        const Uint32 *src_px = (const Uint32 *)src;
+        Uint32 *dst_px = (Uint32 *)dst;
+        int x = 0;
+
+#ifdef __SSE2__
+        if (has_sse2) {
+            x = SDL_PremultiplyAlphaRow_SSE2(src_px, dst_px, width, alpha_shift);
+        }
+#endif
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+        if (has_neon) {
+            x = SDL_PremultiplyAlphaRow_NEON(src_px, dst_px, width, alpha_shift);
+        }
+#endif
+        for (; x < width; ++x) {
+            dst_px[x] = SDL_PremultiplyPixel(src_px[x], alpha_shift);
+        }
+        src = (const Uint8 *)src + src_pitch;
+        dst = (Uint8 *)dst + dst_pitch;
+    }
+    return 0;
+}
+
+/*
+ * Remove premultiplied alpha from a block of pixels, see SDL_PremultiplyAlpha()
+ */
+int SDL_UnpremultiplyAlpha(int width, int height,
+                           Uint32 src_format, const void *src, int src_pitch,
+                           Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const int alpha_shift = SDL_PrepareAlphaConversion(width, height, src_format, &src, &src_pitch, dst_format, dst, dst_pitch);
+    int x;
+
+    if (alpha_shift < 0) {
+        return -1;
+    }
+
     while (height--) {
         const Uint32 *src_px = (const Uint32 *)src;
         Uint32 *dst_px = (Uint32 *)dst;
-        for (c = width; c; --c) {
-            /* Component bytes extraction. */
-            srcpixel = *src_px++;
-            RGBA_FROM_ARGB8888(srcpixel, srcR, srcG, srcB, srcA);
-
-            /* Alpha pre-multiplication of each component. */
-            dstA = srcA;
-            dstR = (srcA * srcR) / 255;
-            dstG = (srcA * srcG) / 255;
-            dstB = (srcA * srcB) / 255;
-
-            /* ARGB8888 pixel recomposition. */
-            ARGB8888_FROM_RGBA(dstpixel, dstR, dstG, dstB, dstA);
-            *dst_px++ = dstpixel;
+        for (x = 0; x < width; ++x) {
+            dst_px[x] = SDL_UnpremultiplyPixel(src_px[x], alpha_shift);
         }
         src = (const Uint8 *)src + src_pitch;
         dst = (Uint8 *)dst + dst_pitch;
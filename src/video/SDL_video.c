@@ -351,9 +351,10 @@ static SDL_atomic_t SDL_messagebox_count;
 static int SDL_UpdateWindowTexture(SDL_VideoDevice *unused, SDL_Window *window, const SDL_Rect *rects, int numrects)
 {
     SDL_WindowTextureData *data;
-    SDL_Rect rect;
+    SDL_Rect rect, full_rect, clipped;
     void *src;
-    int w, h;
+    int w, h, i;
+    Sint64 area = 0;
 
     SDL_GetWindowSizeInPixels(window, &w, &h);
 
@@ -363,20 +364,47 @@ static int SDL_UpdateWindowTexture(SDL_VideoDevice *unused, SDL_Window *window,
     }
 
     /* Update a single rect that contains subrects for best DMA performance */
-    if (SDL_GetSpanEnclosingRect(w, h, numrects, rects, &rect)) {
-        src = (void *)((Uint8 *)data->pixels +
-                       rect.y * data->pitch +
-                       rect.x * data->bytes_per_pixel);
-        if (SDL_UpdateTexture(data->texture, &rect, src, data->pitch) < 0) {
-            return -1;
+    if (numrects > 0 && SDL_GetSpanEnclosingRect(w, h, numrects, rects, &rect)) {
+        full_rect.x = 0;
+        full_rect.y = 0;
+        full_rect.w = w;
+        full_rect.h = h;
+        for (i = 0; i < numrects; ++i) {
+            if (SDL_IntersectRect(&rects[i], &full_rect, &clipped)) {
+                area += (Sint64)clipped.w * clipped.h;
+            }
         }
 
-        if (SDL_RenderCopy(data->renderer, data->texture, NULL, NULL) < 0) {
-            return -1;
+        if (area * 2 < (Sint64)rect.w * rect.h) {
+            /* ...unless the subrects only cover a small part of it, then
+               uploading them one at a time is less work. */
+            for (i = 0; i < numrects; ++i) {
+                if (!SDL_IntersectRect(&rects[i], &full_rect, &clipped)) {
+                    continue;
+                }
+                src = (void *)((Uint8 *)data->pixels +
+                               clipped.y * data->pitch +
+                               clipped.x * data->bytes_per_pixel);
+                if (SDL_UpdateTexture(data->texture, &clipped, src, data->pitch) < 0) {
+                    return -1;
+                }
+            }
+        } else {
+            src = (void *)((Uint8 *)data->pixels +
+                           rect.y * data->pitch +
+                           rect.x * data->bytes_per_pixel);
+            if (SDL_UpdateTexture(data->texture, &rect, src, data->pitch) < 0) {
+                return -1;
+            }
         }
+    }
 
-        SDL_RenderPresent(data->renderer);
+    /* Present even when nothing changed, the renderer paces the frames */
+    if (SDL_RenderCopy(data->renderer, data->texture, NULL, NULL) < 0) {
+        return -1;
     }
+
+    SDL_RenderPresent(data->renderer);
     return 0;
 }
 
@@ -21,18 +21,35 @@
 #include "../SDL_internal.h"
 
 #include "SDL_endian.h"
+#include "SDL_hints.h"
 #include "SDL_video.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "../thread/SDL_systhread.h"
 
 #include "yuv2rgb/yuv_rgb.h"
 
 #define SDL_YUV_SD_THRESHOLD 576
 
+/* Smaller images are always converted on the calling thread, splitting them
+   up costs more than it saves. */
+#define SDL_YUV_MIN_PARALLEL_PIXELS (640 * 360)
+
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
 static SDL_YUV_CONVERSION_MODE SDL_YUV_ConversionMode = SDL_YUV_CONVERSION_BT601;
 
 #if SDL_HAVE_YUV
 static SDL_bool IsPlanar2x2Format(Uint32 format);
+static SDL_bool IsP01xFormat(Uint32 format);
+
+/* Threads for SDL_HINT_YUV_CONVERSION_THREADS. The lock is held while the
+   pool converts an image, so only one conversion at a time runs on it. */
+static SDL_SpinLock SDL_YUV_workers_lock;
+static SDL_WorkerPool *SDL_YUV_workers;
+static int SDL_YUV_num_threads;
 #endif
 
 void SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_MODE mode)
@@ -69,7 +86,7 @@ int SDL_CalculateYUVSize(Uint32 format, int w, int h, size_t *size, int *pitch)
 #if SDL_HAVE_YUV
     int sz_plane = 0, sz_plane_chroma = 0, sz_plane_packed = 0;
 
-    if (IsPlanar2x2Format(format) == SDL_TRUE) {
+    if (IsPlanar2x2Format(format) == SDL_TRUE || IsP01xFormat(format) == SDL_TRUE) {
         {
             /* sz_plane == w * h; */
             size_t s1;
@@ -175,6 +192,33 @@ int SDL_CalculateYUVSize(Uint32 format, int w, int h, size_t *size, int *pitch)
         }
         break;
 
+    case SDL_PIXELFORMAT_P010: /**< Planar mode: Y + U/V interleaved, 16 bits per sample  (2 planes) */
+    case SDL_PIXELFORMAT_P016:
+        if (pitch) {
+            /* pitch == w * 2; */
+            size_t p1;
+            if (SDL_size_mul_overflow(w, 2, &p1) < 0) {
+                return -1;
+            }
+            *pitch = (int) p1;
+        }
+
+        if (size) {
+            /* dst_size == 2 * (sz_plane + sz_plane_chroma + sz_plane_chroma); */
+            size_t s1, s2, s3;
+            if (SDL_size_add_overflow(sz_plane, sz_plane_chroma, &s1) < 0) {
+                return -1;
+            }
+            if (SDL_size_add_overflow(s1, sz_plane_chroma, &s2) < 0) {
+                return -1;
+            }
+            if (SDL_size_mul_overflow(s2, 2, &s3) < 0) {
+                return -1;
+            }
+            *size = (int) s3;
+        }
+        break;
+
     default:
         return -1;
     }
@@ -210,6 +254,12 @@ static SDL_bool IsPlanar2x2Format(Uint32 format)
     return format == SDL_PIXELFORMAT_YV12 || format == SDL_PIXELFORMAT_IYUV || format == SDL_PIXELFORMAT_NV12 || format == SDL_PIXELFORMAT_NV21;
 }
 
+/* 2 plane formats like NV12, with 16 bit samples */
+static SDL_bool IsP01xFormat(Uint32 format)
+{
+    return format == SDL_PIXELFORMAT_P010 || format == SDL_PIXELFORMAT_P016;
+}
+
 static SDL_bool IsPacked4Format(Uint32 format)
 {
     return format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY || format == SDL_PIXELFORMAT_YVYU;
@@ -244,6 +294,13 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
         planes[0] = (const Uint8 *)yuv;
         planes[1] = planes[0] + pitches[0] * height;
         break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        pitches[0] = yuv_pitch;
+        pitches[1] = 4 * ((pitches[0] + 3) / 4);
+        planes[0] = (const Uint8 *)yuv;
+        planes[1] = planes[0] + pitches[0] * height;
+        break;
     default:
         return SDL_SetError("GetYUVPlanes(): Unsupported YUV format: %s", SDL_GetPixelFormatName(format));
     }
@@ -298,6 +355,14 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
         *u = *v + 1;
         *uv_stride = pitches[1];
         break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        *y = planes[0];
+        *y_stride = pitches[0];
+        *u = planes[1];
+        *v = *u + 2;
+        *uv_stride = pitches[1];
+        break;
     default:
         /* Should have caught this above */
         return SDL_SetError("GetYUVPlanes[2]: Unsupported YUV format: %s", SDL_GetPixelFormatName(format));
@@ -456,6 +521,130 @@ static SDL_bool yuv_rgb_lsx(
     return SDL_FALSE;
 }
 
+static SDL_bool yuv_rgb_neon(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+#ifdef HAVE_NEON_INTRINSICS
+    if (!SDL_HasNEON()) {
+        return SDL_FALSE;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (IsP01xFormat(src_format)) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvp010_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_ARGB2101010:
+            yuvp010_argb2101010_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+#endif
+    return SDL_FALSE;
+}
+
 static SDL_bool yuv_rgb_std(
     Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height,
@@ -556,9 +745,164 @@ static SDL_bool yuv_rgb_std(
             break;
         }
     }
+
+    if (IsP01xFormat(src_format)) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvp010_argb_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_ARGB2101010:
+            yuvp010_argb2101010_std(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
     return SDL_FALSE;
 }
 
+static SDL_bool yuv_rgb(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+
+    if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+
+    if (yuv_rgb_neon(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+
+    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    Uint32 width;
+    Uint32 height;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+    Uint32 band_height; /* even, so every band starts on a chroma row. */
+    SDL_bool converted;
+} YUVToRGBBands;
+
+static void yuv_rgb_band(void *userdata, int index, int thread_index)
+{
+    YUVToRGBBands *bands = (YUVToRGBBands *)userdata;
+    const Uint32 row = (Uint32)index * bands->band_height;
+    const Uint32 height = SDL_min(bands->band_height, bands->height - row);
+    const Uint32 uv_row = row / 2;
+    SDL_bool converted;
+
+    converted = yuv_rgb(bands->src_format, bands->dst_format, bands->width, height,
+                        bands->y + row * bands->y_stride,
+                        bands->u + uv_row * bands->uv_stride,
+                        bands->v + uv_row * bands->uv_stride,
+                        bands->y_stride, bands->uv_stride,
+                        bands->rgb + row * bands->rgb_stride, bands->rgb_stride,
+                        bands->yuv_type);
+
+    /* every band has the same formats, so they all either convert or don't. */
+    if (index == 0) {
+        bands->converted = converted;
+    }
+}
+
+/* Returns the pool for SDL_HINT_YUV_CONVERSION_THREADS, or NULL if the hint
+   asks for a single thread. Must be called with SDL_YUV_workers_lock held. */
+static SDL_WorkerPool *GetYUVWorkers(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_YUV_CONVERSION_THREADS);
+    int num_threads = (hint && *hint) ? SDL_atoi(hint) : 1;
+
+    if (num_threads <= 0) {
+        num_threads = SDL_GetCPUCount();
+    }
+    if (num_threads <= 1) {
+        return NULL;
+    }
+
+    if (!SDL_YUV_workers || num_threads != SDL_YUV_num_threads) {
+        SDL_DestroyWorkerPool(SDL_YUV_workers);
+        SDL_YUV_workers = SDL_CreateWorkerPool("SDLYUV", num_threads - 1);
+        SDL_YUV_num_threads = num_threads;
+    }
+    return SDL_YUV_workers;
+}
+
+static SDL_bool yuv_rgb_parallel(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    SDL_WorkerPool *workers;
+    YUVToRGBBands bands;
+    int num_bands;
+
+    /* Only 2x2 subsampled formats are split up. The SIMD code for packed
+       formats converts the last row of each call with the scalar code, so
+       bands of those wouldn't match a single conversion exactly. */
+    if ((!IsPlanar2x2Format(src_format) && !IsP01xFormat(src_format)) ||
+        (Sint64)width * height < SDL_YUV_MIN_PARALLEL_PIXELS) {
+        return SDL_FALSE;
+    }
+
+    /* if another thread is using the pool, just convert on this one. */
+    if (!SDL_AtomicTryLock(&SDL_YUV_workers_lock)) {
+        return SDL_FALSE;
+    }
+
+    workers = GetYUVWorkers();
+    if (!workers) {
+        SDL_AtomicUnlock(&SDL_YUV_workers_lock);
+        return SDL_FALSE;
+    }
+
+    bands.src_format = src_format;
+    bands.dst_format = dst_format;
+    bands.width = width;
+    bands.height = height;
+    bands.y = y;
+    bands.u = u;
+    bands.v = v;
+    bands.y_stride = y_stride;
+    bands.uv_stride = uv_stride;
+    bands.rgb = rgb;
+    bands.rgb_stride = rgb_stride;
+    bands.yuv_type = yuv_type;
+    bands.band_height = ((height + SDL_YUV_num_threads - 1) / SDL_YUV_num_threads + 1) & ~1;
+    bands.converted = SDL_FALSE;
+    num_bands = (int)((height + bands.band_height - 1) / bands.band_height);
+
+    SDL_RunWorkerPool(workers, yuv_rgb_band, &bands, num_bands);
+
+    SDL_AtomicUnlock(&SDL_YUV_workers_lock);
+
+    return bands.converted;
+}
+
 int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
                                  Uint32 src_format, const void *src, int src_pitch,
                                  Uint32 dst_format, void *dst, int dst_pitch)
@@ -578,15 +922,11 @@ int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return -1;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-        return 0;
-    }
-
-    if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+    if (yuv_rgb_parallel(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return 0;
     }
 
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+    if (yuv_rgb(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return 0;
     }
 
@@ -625,6 +965,84 @@ struct RGB2YUVFactors
     float v[3]; /* Rfactor, Gfactor, Bfactor */
 };
 
+#ifdef HAVE_NEON_INTRINSICS
+/* Four lanes of (int)(f[0] * r + f[1] * g + f[2] * b + 0.5f) + offset, evaluated in the same order as the scalar code */
+static SDL_INLINE int32x4_t rgb_yuv4_neon(const float *f, int offset, uint16x4_t r, uint16x4_t g, uint16x4_t b)
+{
+    float32x4_t sum = vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(r)), f[0]);
+    sum = vmlaq_n_f32(sum, vcvtq_f32_u32(vmovl_u16(g)), f[1]);
+    sum = vmlaq_n_f32(sum, vcvtq_f32_u32(vmovl_u16(b)), f[2]);
+    sum = vaddq_f32(sum, vdupq_n_f32(0.5f));
+    return vaddq_s32(vcvtq_s32_f32(sum), vdupq_n_s32(offset));
+}
+
+/* Eight lanes, truncated to Uint8 like the MAKE_Y/U/V macros */
+static SDL_INLINE uint8x8_t rgb_yuv8_neon(const float *f, int offset, uint16x8_t r, uint16x8_t g, uint16x8_t b)
+{
+    const int32x4_t lo = rgb_yuv4_neon(f, offset, vget_low_u16(r), vget_low_u16(g), vget_low_u16(b));
+    const int32x4_t hi = rgb_yuv4_neon(f, offset, vget_high_u16(r), vget_high_u16(g), vget_high_u16(b));
+    return vreinterpret_u8_s8(vmovn_s16(vcombine_s16(vmovn_s32(lo), vmovn_s32(hi))));
+}
+#endif
+
+/* Writes the luma of as many pixels of the row as possible with SIMD, returns the number of pixels written */
+static int argb8888_y_neon(const Uint8 *row, Uint8 *plane_y, int width, const struct RGB2YUVFactors *cvt)
+{
+    int i = 0;
+#ifdef HAVE_NEON_INTRINSICS
+    if (!SDL_HasNEON()) {
+        return 0;
+    }
+    for (; (i + 16) <= width; i += 16) {
+        /* Each ARGB8888 pixel is B, G, R, A in memory */
+        const uint8x16x4_t p = vld4q_u8(row + i * 4);
+        const uint8x16_t r = p.val[2];
+        const uint8x16_t g = p.val[1];
+        const uint8x16_t b = p.val[0];
+
+        vst1_u8(plane_y + i, rgb_yuv8_neon(cvt->y, cvt->y_offset, vmovl_u8(vget_low_u8(r)), vmovl_u8(vget_low_u8(g)), vmovl_u8(vget_low_u8(b))));
+        vst1_u8(plane_y + i + 8, rgb_yuv8_neon(cvt->y, cvt->y_offset, vmovl_u8(vget_high_u8(r)), vmovl_u8(vget_high_u8(g)), vmovl_u8(vget_high_u8(b))));
+    }
+#endif
+    return i;
+}
+
+/* Writes the chroma of as many 2x2 pixel blocks of the row pair as possible with SIMD, returns the number of blocks written.
+   For NV12 and NV21 the interleaved chroma goes to plane_u and plane_v is unused. */
+static int argb8888_uv_neon(Uint32 dst_format, const Uint8 *curr_row, const Uint8 *next_row, Uint8 *plane_u, Uint8 *plane_v, int width_half, const struct RGB2YUVFactors *cvt)
+{
+    int i = 0;
+#ifdef HAVE_NEON_INTRINSICS
+    if (!SDL_HasNEON()) {
+        return 0;
+    }
+    for (; (i + 8) <= width_half; i += 8) {
+        const uint8x16x4_t p1 = vld4q_u8(curr_row + i * 8);
+        const uint8x16x4_t p2 = vld4q_u8(next_row + i * 8);
+        const uint16x8_t r = vshrq_n_u16(vaddq_u16(vpaddlq_u8(p1.val[2]), vpaddlq_u8(p2.val[2])), 2);
+        const uint16x8_t g = vshrq_n_u16(vaddq_u16(vpaddlq_u8(p1.val[1]), vpaddlq_u8(p2.val[1])), 2);
+        const uint16x8_t b = vshrq_n_u16(vaddq_u16(vpaddlq_u8(p1.val[0]), vpaddlq_u8(p2.val[0])), 2);
+        const uint8x8_t u = rgb_yuv8_neon(cvt->u, 128, r, g, b);
+        const uint8x8_t v = rgb_yuv8_neon(cvt->v, 128, r, g, b);
+        uint8x8x2_t uv;
+
+        if (dst_format == SDL_PIXELFORMAT_NV12) {
+            uv.val[0] = u;
+            uv.val[1] = v;
+            vst2_u8(plane_u + i * 2, uv);
+        } else if (dst_format == SDL_PIXELFORMAT_NV21) {
+            uv.val[0] = v;
+            uv.val[1] = u;
+            vst2_u8(plane_u + i * 2, uv);
+        } else {
+            vst1_u8(plane_u + i, u);
+            vst1_u8(plane_v + i, v);
+        }
+    }
+#endif
+    return i;
+}
+
 static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
 {
     const int src_pitch_x_2 = src_pitch * 2;
@@ -734,7 +1152,9 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
 
         /* Write Y plane */
         for (j = 0; j < height; j++) {
-            for (i = 0; i < width; i++) {
+            i = argb8888_y_neon(curr_row, plane_y, width, cvt);
+            plane_y += i;
+            for (; i < width; i++) {
                 const Uint32 p1 = ((const Uint32 *)curr_row)[i];
                 const Uint32 r = (p1 & 0x00ff0000) >> 16;
                 const Uint32 g = (p1 & 0x0000ff00) >> 8;
@@ -753,7 +1173,10 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
             /* Write UV planes, not interleaved */
             uv_skip = (uv_stride - (width + 1) / 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = argb8888_uv_neon(dst_format, curr_row, next_row, plane_u, plane_v, width_half, cvt);
+                plane_u += i;
+                plane_v += i;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_u++ = MAKE_U(r, g, b);
                     *plane_v++ = MAKE_V(r, g, b);
@@ -785,7 +1208,9 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
         } else if (dst_format == SDL_PIXELFORMAT_NV12) {
             uv_skip = (uv_stride - ((width + 1) / 2) * 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = argb8888_uv_neon(dst_format, curr_row, next_row, plane_interleaved_uv, NULL, width_half, cvt);
+                plane_interleaved_uv += i * 2;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_interleaved_uv++ = MAKE_U(r, g, b);
                     *plane_interleaved_uv++ = MAKE_V(r, g, b);
@@ -814,7 +1239,9 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
         } else /* dst_format == SDL_PIXELFORMAT_NV21 */ {
             uv_skip = (uv_stride - ((width + 1) / 2) * 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = argb8888_uv_neon(dst_format, curr_row, next_row, plane_interleaved_uv, NULL, width_half, cvt);
+                plane_interleaved_uv += i * 2;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_interleaved_uv++ = MAKE_V(r, g, b);
                     *plane_interleaved_uv++ = MAKE_U(r, g, b);
@@ -1035,6 +1462,27 @@ static int SDL_ConvertPixels_YUV_to_YUV_Copy(int width, int height, Uint32 forma
         return 0;
     }
 
+    if (IsP01xFormat(format)) {
+        /* Y plane, 2 bytes per sample */
+        for (i = height; i--;) {
+            SDL_memcpy(dst, src, (size_t)width * 2);
+            src = (const Uint8 *)src + src_pitch;
+            dst = (Uint8 *)dst + dst_pitch;
+        }
+
+        /* U/V plane is half the height of the Y plane, rounded up */
+        height = (height + 1) / 2;
+        width = ((width + 1) / 2) * 4;
+        src_pitch = ((src_pitch + 3) / 4) * 4;
+        dst_pitch = ((dst_pitch + 3) / 4) * 4;
+        for (i = height; i--;) {
+            SDL_memcpy(dst, src, width);
+            src = (const Uint8 *)src + src_pitch;
+            dst = (Uint8 *)dst + dst_pitch;
+        }
+        return 0;
+    }
+
     if (IsPacked4Format(format)) {
         /* Packed planes */
         width = 4 * ((width + 1) / 2);
@@ -1986,4 +2434,15 @@ int SDL_ConvertPixels_YUV_to_YUV(int width, int height,
 #endif
 }
 
+void SDL_QuitYUV(void)
+{
+#if SDL_HAVE_YUV
+    SDL_AtomicLock(&SDL_YUV_workers_lock);
+    SDL_DestroyWorkerPool(SDL_YUV_workers);
+    SDL_YUV_workers = NULL;
+    SDL_YUV_num_threads = 0;
+    SDL_AtomicUnlock(&SDL_YUV_workers_lock);
+#endif
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
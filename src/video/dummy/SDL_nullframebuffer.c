@@ -26,10 +26,13 @@
 #include "SDL_nullframebuffer_c.h"
 
 #define DUMMY_SURFACE "_SDL_DummySurface"
+/* The "display" the framebuffer is pushed to. Only the updated rects reach
+   it, so tests can check what was presented through SDL_GetWindowData(). */
+#define DUMMY_SCREEN "_SDL_DummyScreen"
 
 int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window *window, Uint32 *format, void **pixels, int *pitch)
 {
-    SDL_Surface *surface;
+    SDL_Surface *surface, *screen;
     const Uint32 surface_format = SDL_PIXELFORMAT_RGB888;
     int w, h;
 
@@ -42,9 +45,15 @@ int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window *window, Uint32 *format,
     if (!surface) {
         return -1;
     }
+    screen = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, surface_format);
+    if (!screen) {
+        SDL_FreeSurface(surface);
+        return -1;
+    }
 
     /* Save the info and return! */
     SDL_SetWindowData(window, DUMMY_SURFACE, surface);
+    SDL_SetWindowData(window, DUMMY_SCREEN, screen);
     *format = surface_format;
     *pixels = surface->pixels;
     *pitch = surface->pitch;
@@ -54,14 +63,21 @@ int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window *window, Uint32 *format,
 int SDL_DUMMY_UpdateWindowFramebuffer(_THIS, SDL_Window *window, const SDL_Rect *rects, int numrects)
 {
     static int frame_number;
-    SDL_Surface *surface;
+    SDL_Surface *surface, *screen;
+    SDL_Rect rect;
+    int i;
 
     surface = (SDL_Surface *)SDL_GetWindowData(window, DUMMY_SURFACE);
-    if (!surface) {
+    screen = (SDL_Surface *)SDL_GetWindowData(window, DUMMY_SCREEN);
+    if (!surface || !screen) {
         return SDL_SetError("Couldn't find dummy surface for window");
     }
 
     /* Send the data to the display */
+    for (i = 0; i < numrects; ++i) {
+        rect = rects[i];
+        SDL_BlitSurface(surface, &rects[i], screen, &rect);
+    }
     if (SDL_getenv("SDL_VIDEO_DUMMY_SAVE_FRAMES")) {
         char file[128];
         (void)SDL_snprintf(file, sizeof(file), "SDL_window%" SDL_PRIu32 "-%8.8d.bmp",
@@ -77,6 +93,8 @@ void SDL_DUMMY_DestroyWindowFramebuffer(_THIS, SDL_Window *window)
 
     surface = (SDL_Surface *)SDL_SetWindowData(window, DUMMY_SURFACE, NULL);
     SDL_FreeSurface(surface);
+    surface = (SDL_Surface *)SDL_SetWindowData(window, DUMMY_SCREEN, NULL);
+    SDL_FreeSurface(surface);
 }
 
 #endif /* SDL_VIDEO_DRIVER_DUMMY */
@@ -85,6 +85,32 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = (_B << 24) | (_G << 16) | (_R << 8) | _A;",
 );
 
+# The order of the channels in memory for each format, X is an unused channel
+my %format_channels = (
+    "RGB888" => "BGRX",
+    "BGR888" => "RGBX",
+    "ARGB8888" => "BGRA",
+    "RGBA8888" => "ABGR",
+    "ABGR8888" => "RGBA",
+    "BGRA8888" => "ARGB",
+);
+
+# The SIMD instruction sets we generate blitters for
+my @simd_types = (
+    "SSE2",
+    "NEON",
+);
+
+my %simd_guard = (
+    "SSE2" => "#ifdef __SSE2__",
+    "NEON" => "#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)",
+);
+
+my %simd_width = (
+    "SSE2" => 4,
+    "NEON" => 8,
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -153,6 +179,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $simd = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -164,6 +191,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $simd ) {
+        print FILE "_$simd";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -576,6 +606,399 @@ __EOF__
 __EOF__
 }
 
+# The SIMD blitters keep the channels in the order of the destination pixel,
+# this returns where the source channel for destination lane $lane lives
+sub get_simd_lane
+{
+    my $src = shift;
+    my $dst = shift;
+    my $lane = shift;
+
+    my $src_channels = $format_channels{$src};
+    my $channel = substr($format_channels{$dst}, $lane, 1);
+
+    $src_channels =~ s/X/A/;
+    $channel =~ s/X/A/;
+    return index($src_channels, $channel);
+}
+
+sub output_simdhelpers
+{
+    my $simd = shift;
+
+    if ( $simd eq "SSE2" ) {
+        print FILE <<__EOF__;
+/* The SSE2 blitters work on two pixels at a time, each channel widened to
+   16 bits and sorted in destination order, with alpha in lanes 3 and 7 */
+
+/* Computes x / 255 exactly for x in [0, 255 * 255] */
+static SDL_INLINE __m128i SDL_Blit_Div255_SSE2(__m128i x)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+
+static SDL_INLINE __m128i SDL_Blit_Blend_SSE2(__m128i src, __m128i dst, int flags)
+{
+    const __m128i alpha_mask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i v255 = _mm_set1_epi16(0xFF);
+    const __m128i srcA = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, 0xFF), 0xFF);
+    const __m128i inv_srcA = _mm_sub_epi16(v255, srcA);
+    __m128i result;
+
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        const __m128i factor = _mm_or_si128(_mm_andnot_si128(alpha_mask, srcA), _mm_and_si128(alpha_mask, v255));
+        src = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src, factor));
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+    case SDL_COPY_BLEND:
+        return _mm_add_epi16(src, SDL_Blit_Div255_SSE2(_mm_mullo_epi16(inv_srcA, dst)));
+    case SDL_COPY_ADD:
+        result = _mm_min_epi16(_mm_add_epi16(src, dst), v255);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    case SDL_COPY_MUL:
+    {
+        /* The sum doesn't fit in 16 bits, so divide the terms separately */
+        const __m128i p = _mm_mullo_epi16(src, dst);
+        const __m128i q = _mm_mullo_epi16(dst, inv_srcA);
+        const __m128i quotient = _mm_add_epi16(SDL_Blit_Div255_SSE2(p), SDL_Blit_Div255_SSE2(q));
+        const __m128i remainder = _mm_sub_epi16(_mm_add_epi16(p, q), _mm_mullo_epi16(quotient, v255));
+        result = _mm_min_epi16(_mm_add_epi16(quotient, SDL_Blit_Div255_SSE2(remainder)), v255);
+        break;
+    }
+    default:
+        return dst;
+    }
+    /* The destination alpha is left alone */
+    return _mm_or_si128(_mm_andnot_si128(alpha_mask, result), _mm_and_si128(alpha_mask, dst));
+}
+
+__EOF__
+    } elsif ( $simd eq "NEON" ) {
+        print FILE <<__EOF__;
+/* The NEON blitters work on eight pixels at a time, with the channels
+   deinterleaved in destination order and alpha in val[3] */
+
+/* Computes x / 255 exactly for x in [0, 255 * 255] */
+static SDL_INLINE uint16x8_t SDL_Blit_Div255_NEON(uint16x8_t x)
+{
+    return vshrq_n_u16(vaddq_u16(vsraq_n_u16(x, x, 8), vdupq_n_u16(1)), 8);
+}
+
+static SDL_INLINE uint8x8_t SDL_Blit_Div255_Narrow_NEON(uint16x8_t x)
+{
+    return vaddhn_u16(vsraq_n_u16(x, x, 8), vdupq_n_u16(1));
+}
+
+static SDL_INLINE uint8x8x4_t SDL_Blit_Blend_NEON(uint8x8x4_t src, uint8x8x4_t dst, int flags)
+{
+    const uint8x8_t srcA = src.val[3];
+    const uint8x8_t inv_srcA = vmvn_u8(srcA);
+    int i;
+
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        for (i = 0; i < 3; ++i) {
+            src.val[i] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[i], srcA));
+        }
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+    case SDL_COPY_BLEND:
+        for (i = 0; i < 4; ++i) {
+            dst.val[i] = vadd_u8(src.val[i], SDL_Blit_Div255_Narrow_NEON(vmull_u8(inv_srcA, dst.val[i])));
+        }
+        break;
+    case SDL_COPY_ADD:
+        for (i = 0; i < 3; ++i) {
+            dst.val[i] = vqadd_u8(src.val[i], dst.val[i]);
+        }
+        break;
+    case SDL_COPY_MOD:
+        for (i = 0; i < 3; ++i) {
+            dst.val[i] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[i], dst.val[i]));
+        }
+        break;
+    case SDL_COPY_MUL:
+        for (i = 0; i < 3; ++i) {
+            /* The sum doesn't fit in 16 bits, so divide the terms separately */
+            const uint16x8_t p = vmull_u8(src.val[i], dst.val[i]);
+            const uint16x8_t q = vmull_u8(dst.val[i], inv_srcA);
+            const uint16x8_t quotient = vaddq_u16(SDL_Blit_Div255_NEON(p), SDL_Blit_Div255_NEON(q));
+            const uint16x8_t remainder = vmlsq_n_u16(vaddq_u16(p, q), quotient, 0xFF);
+            dst.val[i] = vqmovn_u16(vaddq_u16(quotient, SDL_Blit_Div255_NEON(remainder)));
+        }
+        break;
+    }
+    return dst;
+}
+
+__EOF__
+    }
+}
+
+sub output_simdfunc
+{
+    my $simd = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my $width = $simd_width{$simd};
+    my $dst_channels = $format_channels{$dst};
+    my @modulate_channels;
+
+    $dst_channels =~ s/X/A/;
+    @modulate_channels = map { "modulate$_" } split(//, $dst_channels);
+
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n", $simd);
+    print FILE <<__EOF__;
+{
+    const int flags = info->flags;
+__EOF__
+    if ( $simd eq "SSE2" ) {
+        print FILE <<__EOF__;
+    const __m128i zero = _mm_setzero_si128();
+__EOF__
+        if ( !$src_has_alpha ) {
+            print FILE <<__EOF__;
+    const __m128i srcA = _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0);
+__EOF__
+        }
+        if ( !$dst_has_alpha ) {
+            print FILE <<__EOF__;
+    const __m128i dstmask = _mm_set1_epi32(0x00FFFFFF);
+__EOF__
+        }
+    }
+    if ( $modulate ) {
+        my $type = ($simd eq "SSE2") ? "Sint16" : "uint8x8_t";
+        my $open = ($simd eq "SSE2") ? "" : "vdup_n_u8(";
+        my $close = ($simd eq "SSE2") ? "" : ")";
+        print FILE <<__EOF__;
+    const $type modulateR = ${open}(flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF${close};
+    const $type modulateG = ${open}(flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF${close};
+    const $type modulateB = ${open}(flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF${close};
+__EOF__
+        if ( $simd eq "SSE2" || $dst_has_alpha || $blend ) {
+            print FILE <<__EOF__;
+    const $type modulateA = ${open}(flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF${close};
+__EOF__
+        }
+        if ( $simd eq "SSE2" ) {
+            my $args = join(", ", reverse(@modulate_channels));
+            print FILE <<__EOF__;
+    const __m128i modulate = _mm_set_epi16($args, $args);
+__EOF__
+        }
+    }
+    print FILE <<__EOF__;
+    Uint32 srcbuf[$width], dstbuf[$width];
+__EOF__
+    if ( $simd eq "SSE2" ) {
+        print FILE <<__EOF__;
+    __m128i pixels, src_lo, src_hi;
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    uint8x8x4_t pixels, src;
+__EOF__
+    }
+    if ( $scale ) {
+        print FILE <<__EOF__;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        const Uint32 *src_row = (const Uint32 *)info->src;
+__EOF__
+    }
+    print FILE <<__EOF__;
+        Uint32 *dst_row = (Uint32 *)info->dst;
+        int n = info->dst_w;
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+        posx = incx / 2;
+__EOF__
+    }
+    print FILE <<__EOF__;
+        while (n > 0) {
+            const Uint32 *s = src_row;
+            Uint32 *d = dst_row;
+
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+            /* Gather the source pixels, padding the last group with zeroes */
+            if (n < $width) {
+                SDL_zeroa(srcbuf);
+            }
+            for (i = 0; i < SDL_min(n, $width); ++i) {
+                srcbuf[i] = src_row[posx >> 16];
+                posx += incx;
+            }
+            s = srcbuf;
+            if (n < $width) {
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            /* Pad the last group of pixels out to a full vector */
+            if (n < $width) {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src_row, n * sizeof(Uint32));
+                s = srcbuf;
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst_row, n * sizeof(Uint32));
+__EOF__
+    }
+    print FILE <<__EOF__;
+                d = dstbuf;
+            }
+
+__EOF__
+    if ( $simd eq "SSE2" ) {
+        my $imm = 0;
+        for (my $lane = 0; $lane < 4; ++$lane) {
+            $imm |= get_simd_lane($src, $dst, $lane) << (2 * $lane);
+        }
+        print FILE <<__EOF__;
+            pixels = _mm_loadu_si128((const __m128i *)s);
+            src_lo = _mm_unpacklo_epi8(pixels, zero);
+            src_hi = _mm_unpackhi_epi8(pixels, zero);
+__EOF__
+        if ( $imm != 0xE4 ) {
+            $imm = sprintf("0x%02X", $imm);
+            print FILE <<__EOF__;
+            src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, $imm), $imm);
+            src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, $imm), $imm);
+__EOF__
+        }
+        if ( !$src_has_alpha ) {
+            print FILE <<__EOF__;
+            src_lo = _mm_or_si128(src_lo, srcA);
+            src_hi = _mm_or_si128(src_hi, srcA);
+__EOF__
+        }
+        if ( $modulate ) {
+            print FILE <<__EOF__;
+            src_lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_lo, modulate));
+            src_hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(src_hi, modulate));
+__EOF__
+        }
+        if ( $blend ) {
+            print FILE <<__EOF__;
+            pixels = _mm_loadu_si128((const __m128i *)d);
+            src_lo = SDL_Blit_Blend_SSE2(src_lo, _mm_unpacklo_epi8(pixels, zero), flags);
+            src_hi = SDL_Blit_Blend_SSE2(src_hi, _mm_unpackhi_epi8(pixels, zero), flags);
+__EOF__
+        }
+        print FILE <<__EOF__;
+            pixels = _mm_packus_epi16(src_lo, src_hi);
+__EOF__
+        if ( !$dst_has_alpha ) {
+            print FILE <<__EOF__;
+            pixels = _mm_and_si128(pixels, dstmask);
+__EOF__
+        }
+        print FILE <<__EOF__;
+            _mm_storeu_si128((__m128i *)d, pixels);
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            pixels = vld4_u8((const Uint8 *)s);
+__EOF__
+        for (my $lane = 0; $lane < 4; ++$lane) {
+            my $index = get_simd_lane($src, $dst, $lane);
+            if ( $lane == 3 && !$src_has_alpha ) {
+                print FILE <<__EOF__;
+            src.val[3] = vdup_n_u8(0xFF);
+__EOF__
+            } else {
+                print FILE <<__EOF__;
+            src.val[$lane] = pixels.val[$index];
+__EOF__
+            }
+        }
+        if ( $modulate ) {
+            for (my $lane = 0; $lane < 4; ++$lane) {
+                if ( $lane == 3 && !$dst_has_alpha && !$blend ) {
+                    next;
+                }
+                print FILE <<__EOF__;
+            src.val[$lane] = SDL_Blit_Div255_Narrow_NEON(vmull_u8(src.val[$lane], $modulate_channels[$lane]));
+__EOF__
+            }
+        }
+        if ( $blend ) {
+            print FILE <<__EOF__;
+            src = SDL_Blit_Blend_NEON(src, vld4_u8((const Uint8 *)d), flags);
+__EOF__
+        }
+        if ( !$dst_has_alpha ) {
+            print FILE <<__EOF__;
+            src.val[3] = vdup_n_u8(0);
+__EOF__
+        }
+        print FILE <<__EOF__;
+            vst4_u8((Uint8 *)d, src);
+__EOF__
+    }
+    print FILE <<__EOF__;
+
+            if (n < $width) {
+                SDL_memcpy(dst_row, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+__EOF__
+    if ( !$scale ) {
+        print FILE <<__EOF__;
+            src_row += $width;
+__EOF__
+    }
+    print FILE <<__EOF__;
+            dst_row += $width;
+            n -= $width;
+        }
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+        posy += incy;
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+        info->src += info->src_pitch;
+__EOF__
+    }
+    print FILE <<__EOF__;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+}
+
 sub output_copyfunc_h
 {
 }
@@ -590,51 +1013,76 @@ sub output_copyinc
 __EOF__
 }
 
+sub output_copyfuncentry
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $simd = shift;
+
+    print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
+    my $flags = "";
+    my $flag = "";
+    if ( $modulate ) {
+        $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $blend ) {
+        $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $scale ) {
+        $flag = "SDL_COPY_NEAREST";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $flags eq "" ) {
+        $flags = "0";
+    }
+    if ( $simd ) {
+        print FILE "($flags), SDL_CPU_$simd,";
+    } else {
+        print FILE "($flags), SDL_CPU_ANY,";
+    }
+    output_copyfuncname("", $src, $dst, $modulate, $blend, $scale, 0, " },\n", $simd);
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
 __EOF__
+    # SDL_ChooseBlitFunc() takes the first entry whose flags cover the blit,
+    # so each SIMD blitter goes right before the scalar one it replaces.
+    # Listing them any earlier would let them catch blits they don't handle,
+    # like the plain scaled copy, which has no SIMD version.
     for (my $i = 0; $i <= $#src_formats; ++$i) {
-        my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
-            my $dst = $dst_formats[$j];
             for (my $modulate = 0; $modulate <= 1; ++$modulate) {
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
-                        if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
-                            my $flags = "";
-                            my $flag = "";
-                            if ( $modulate ) {
-                                $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
+                        if ( $modulate || $blend ) {
+                            foreach my $simd (@simd_types) {
+                                print FILE "$simd_guard{$simd}\n";
+                                output_copyfuncentry($src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, $simd);
+                                print FILE "#endif\n";
                             }
-                            if ( $scale ) {
-                                $flag = "SDL_COPY_NEAREST";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $flags eq "" ) {
-                                $flags = "0";
-                            }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                        }
+                        if ( $modulate || $blend || $scale ) {
+                            output_copyfuncentry($src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, "");
                         }
                     }
                 }
@@ -648,6 +1096,28 @@ __EOF__
 __EOF__
 }
 
+sub output_simdfunc_c
+{
+    my $simd = shift;
+
+    print FILE "$simd_guard{$simd}\n\n";
+    output_simdhelpers($simd);
+    for (my $i = 0; $i <= $#src_formats; ++$i) {
+        for (my $j = 0; $j <= $#dst_formats; ++$j) {
+            for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                for (my $blend = 0; $blend <= 1; ++$blend) {
+                    for (my $scale = 0; $scale <= 1; ++$scale) {
+                        if ( $modulate || $blend ) {
+                            output_simdfunc($simd, $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    print FILE "#endif\n\n";
+}
+
 sub output_copyfunc_c
 {
     my $src = shift;
@@ -681,5 +1151,8 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+foreach my $simd (@simd_types) {
+    output_simdfunc_c($simd);
+}
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
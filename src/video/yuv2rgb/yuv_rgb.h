@@ -30,4 +30,7 @@
 // yuv to rgb, lsx implementation
 #include "yuv_rgb_lsx.h"
 
+// yuv to rgb, neon implementation
+#include "yuv_rgb_neon.h"
+
 #endif /* YUV_RGB_H_ */
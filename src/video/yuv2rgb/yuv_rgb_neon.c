@@ -0,0 +1,298 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+#include "../../SDL_internal.h"
+
+#if SDL_HAVE_YUV
+#include "yuv_rgb.h"
+#include "yuv_rgb_internal.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_endian.h"
+
+#if defined(__ARM_NEON) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+
+/* The arithmetic matches the standard c implementation: the contributions are
+   computed with PRECISION fractional bits, and the sum is clamped to [0, 255] */
+
+static SDL_INLINE int16x8_t neon_y_contribution(uint8x8_t y, uint8x8_t y_shift, int16_t y_factor)
+{
+    return vmulq_n_s16(vreinterpretq_s16_u16(vsubl_u8(y, y_shift)), y_factor);
+}
+
+static SDL_INLINE void neon_uv_contribution(uint8x8_t u, uint8x8_t v, const YUV2RGBParam *param,
+                                            int16x8_t *r_tmp, int16x8_t *g_tmp, int16x8_t *b_tmp)
+{
+    const uint8x8_t bias = vdup_n_u8(128);
+    const int16x8_t u_tmp = vreinterpretq_s16_u16(vsubl_u8(u, bias));
+    const int16x8_t v_tmp = vreinterpretq_s16_u16(vsubl_u8(v, bias));
+
+    *r_tmp = vmulq_n_s16(v_tmp, param->v_r_factor);
+    *g_tmp = vmlaq_n_s16(vmulq_n_s16(u_tmp, param->u_g_factor), v_tmp, param->v_g_factor);
+    *b_tmp = vmulq_n_s16(u_tmp, param->u_b_factor);
+}
+
+static SDL_INLINE uint8x8_t neon_pack_channel(int16x8_t y_tmp, int16x8_t c_tmp)
+{
+    /* The saturating add keeps bright pixels with a large chroma contribution from wrapping */
+    return vqshrun_n_s16(vqaddq_s16(y_tmp, c_tmp), PRECISION);
+}
+
+#define NEON_FUNCTION_NAME	yuv420_rgb565_neon
+#define STD_FUNCTION_NAME	yuv420_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_rgb24_neon
+#define STD_FUNCTION_NAME	yuv420_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_rgba_neon
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_bgra_neon
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_argb_neon
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_abgr_neon
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgb565_neon
+#define STD_FUNCTION_NAME	yuv422_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgb24_neon
+#define STD_FUNCTION_NAME	yuv422_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgba_neon
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_bgra_neon
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_argb_neon
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_abgr_neon
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgb565_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgb24_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgba_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_bgra_neon
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_argb_neon
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_abgr_neon
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+/* P010 and P016 are laid out like NV12 with 16 bit samples, of which the top
+   10 bits are used. The sums don't fit in 16 bits any more, so they are kept
+   on 32 bit lanes, with two more integer bits than the 8 bit ones */
+
+static SDL_INLINE void neon_p010_uv_contribution(uint16x4_t u, uint16x4_t v, const YUV2RGBParam *param,
+                                                 int32x4x2_t *r_tmp, int32x4x2_t *g_tmp, int32x4x2_t *b_tmp)
+{
+    const int16x4_t bias = vdup_n_s16(512);
+    const int16x4_t u_tmp = vsub_s16(vreinterpret_s16_u16(vshr_n_u16(u, 6)), bias);
+    const int16x4_t v_tmp = vsub_s16(vreinterpret_s16_u16(vshr_n_u16(v, 6)), bias);
+    const int32x4_t r = vmull_n_s16(v_tmp, param->v_r_factor);
+    const int32x4_t g = vmlal_n_s16(vmull_n_s16(u_tmp, param->u_g_factor), v_tmp, param->v_g_factor);
+    const int32x4_t b = vmull_n_s16(u_tmp, param->u_b_factor);
+
+    /* Each chroma sample covers two horizontally adjacent pixels */
+    *r_tmp = vzipq_s32(r, r);
+    *g_tmp = vzipq_s32(g, g);
+    *b_tmp = vzipq_s32(b, b);
+}
+
+/* Returns the 8 sums for one channel, shifted down to 10 bits and clamped to [0, 1023] */
+static SDL_INLINE uint16x8_t neon_p010_pack_channel10(int32x4_t y_lo, int32x4_t y_hi, int32x4x2_t c_tmp)
+{
+    const uint16x4_t lo = vqshrun_n_s32(vaddq_s32(y_lo, c_tmp.val[0]), PRECISION);
+    const uint16x4_t hi = vqshrun_n_s32(vaddq_s32(y_hi, c_tmp.val[1]), PRECISION);
+    return vminq_u16(vcombine_u16(lo, hi), vdupq_n_u16(1023));
+}
+
+/* Same as above, shifted down to 8 bits and clamped to [0, 255] */
+static SDL_INLINE uint8x8_t neon_p010_pack_channel8(int32x4_t y_lo, int32x4_t y_hi, int32x4x2_t c_tmp)
+{
+    const uint16x4_t lo = vqshrun_n_s32(vaddq_s32(y_lo, c_tmp.val[0]), PRECISION + 2);
+    const uint16x4_t hi = vqshrun_n_s32(vaddq_s32(y_hi, c_tmp.val[1]), PRECISION + 2);
+    return vqmovn_u16(vcombine_u16(lo, hi));
+}
+
+static SDL_INLINE uint32x4_t neon_p010_pack_rgb10(uint16x4_t r, uint16x4_t g, uint16x4_t b)
+{
+    uint32x4_t rgb = vorrq_u32(vshlq_n_u32(vmovl_u16(r), 20), vshlq_n_u32(vmovl_u16(g), 10));
+    rgb = vorrq_u32(rgb, vmovl_u16(b));
+    return vorrq_u32(rgb, vdupq_n_u32(0xC0000000));
+}
+
+/* Converts and stores 8 pixels of one row */
+static SDL_INLINE void neon_p010_row(const uint16_t *y_ptr, uint8_t *rgb_ptr, int16_t y_shift, int16_t y_factor,
+                                     int32x4x2_t r_tmp, int32x4x2_t g_tmp, int32x4x2_t b_tmp, SDL_bool rgb10)
+{
+    const int16x8_t y_tmp = vsubq_s16(vreinterpretq_s16_u16(vshrq_n_u16(vld1q_u16(y_ptr), 6)), vdupq_n_s16(y_shift));
+    const int32x4_t y_lo = vmull_n_s16(vget_low_s16(y_tmp), y_factor);
+    const int32x4_t y_hi = vmull_n_s16(vget_high_s16(y_tmp), y_factor);
+
+    if (rgb10) {
+        const uint16x8_t r = neon_p010_pack_channel10(y_lo, y_hi, r_tmp);
+        const uint16x8_t g = neon_p010_pack_channel10(y_lo, y_hi, g_tmp);
+        const uint16x8_t b = neon_p010_pack_channel10(y_lo, y_hi, b_tmp);
+        vst1q_u32((uint32_t *)rgb_ptr, neon_p010_pack_rgb10(vget_low_u16(r), vget_low_u16(g), vget_low_u16(b)));
+        vst1q_u32((uint32_t *)rgb_ptr + 4, neon_p010_pack_rgb10(vget_high_u16(r), vget_high_u16(g), vget_high_u16(b)));
+    } else {
+        /* ARGB8888 is stored as native Uint32 values, so B, G, R, A in memory */
+        uint8x8x4_t argb;
+        argb.val[0] = neon_p010_pack_channel8(y_lo, y_hi, b_tmp);
+        argb.val[1] = neon_p010_pack_channel8(y_lo, y_hi, g_tmp);
+        argb.val[2] = neon_p010_pack_channel8(y_lo, y_hi, r_tmp);
+        argb.val[3] = vdup_n_u8(0xFF);
+        vst4_u8(rgb_ptr, argb);
+    }
+}
+
+static SDL_INLINE void yuvp010_neon(
+    uint32_t width, uint32_t height,
+    const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+    uint8_t *RGB, uint32_t RGB_stride,
+    YCbCrType yuv_type, SDL_bool rgb10)
+{
+    const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+    const int16_t y_shift = (int16_t)(param->y_shift << 2);
+    const uint32_t vector_width = (width & ~7);
+    /* The chroma samples are interleaved, the first one of each pair is at the lower address */
+    const uint8_t *uv_base = SDL_min(U, V);
+    const int u_index = (U < V) ? 0 : 1;
+    uint32_t x, y;
+
+    for (y = 0; y < (height - 1) && vector_width > 0; y += 2) {
+        const uint16_t *y_ptr1 = (const uint16_t *)(Y + y * Y_stride);
+        const uint16_t *y_ptr2 = (const uint16_t *)(Y + (y + 1) * Y_stride);
+        const uint16_t *uv_ptr = (const uint16_t *)(uv_base + (y / 2) * UV_stride);
+        uint8_t *rgb_ptr1 = RGB + y * RGB_stride;
+        uint8_t *rgb_ptr2 = RGB + (y + 1) * RGB_stride;
+
+        for (x = 0; x < vector_width; x += 8) {
+            const uint16x4x2_t uv = vld2_u16(uv_ptr);
+            int32x4x2_t r_tmp, g_tmp, b_tmp;
+
+            neon_p010_uv_contribution(uv.val[u_index], uv.val[1 - u_index], param, &r_tmp, &g_tmp, &b_tmp);
+            neon_p010_row(y_ptr1, rgb_ptr1, y_shift, param->y_factor, r_tmp, g_tmp, b_tmp, rgb10);
+            neon_p010_row(y_ptr2, rgb_ptr2, y_shift, param->y_factor, r_tmp, g_tmp, b_tmp, rgb10);
+
+            y_ptr1 += 8;
+            y_ptr2 += 8;
+            uv_ptr += 8;
+            rgb_ptr1 += 32;
+            rgb_ptr2 += 32;
+        }
+    }
+
+    /* Catch the remaining columns, and the last line if the height is odd */
+    if (vector_width < width) {
+        if (rgb10) {
+            yuvp010_argb2101010_std(width - vector_width, height,
+                Y + vector_width * 2, U + vector_width * 2, V + vector_width * 2, Y_stride, UV_stride,
+                RGB + vector_width * 4, RGB_stride, yuv_type);
+        } else {
+            yuvp010_argb_std(width - vector_width, height,
+                Y + vector_width * 2, U + vector_width * 2, V + vector_width * 2, Y_stride, UV_stride,
+                RGB + vector_width * 4, RGB_stride, yuv_type);
+        }
+    }
+    if ((height & 1) && vector_width > 0) {
+        y = height - 1;
+        if (rgb10) {
+            yuvp010_argb2101010_std(vector_width, 1,
+                Y + y * Y_stride, U + (y / 2) * UV_stride, V + (y / 2) * UV_stride, Y_stride, UV_stride,
+                RGB + y * RGB_stride, RGB_stride, yuv_type);
+        } else {
+            yuvp010_argb_std(vector_width, 1,
+                Y + y * Y_stride, U + (y / 2) * UV_stride, V + (y / 2) * UV_stride, Y_stride, UV_stride,
+                RGB + y * RGB_stride, RGB_stride, yuv_type);
+        }
+    }
+}
+
+void yuvp010_argb_neon(
+    uint32_t width, uint32_t height,
+    const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+    uint8_t *RGB, uint32_t RGB_stride,
+    YCbCrType yuv_type)
+{
+    yuvp010_neon(width, height, Y, U, V, Y_stride, UV_stride, RGB, RGB_stride, yuv_type, SDL_FALSE);
+}
+
+void yuvp010_argb2101010_neon(
+    uint32_t width, uint32_t height,
+    const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+    uint8_t *RGB, uint32_t RGB_stride,
+    YCbCrType yuv_type)
+{
+    yuvp010_neon(width, height, Y, U, V, Y_stride, UV_stride, RGB, RGB_stride, yuv_type, SDL_TRUE);
+}
+
+#endif  //__ARM_NEON
+
+#endif /* SDL_HAVE_YUV */
@@ -0,0 +1,243 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	NEON_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* PACK_PIXEL stores 16 pixels from the uint8x16_t channels r, g and b */
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define RGB_PIXEL_SIZE 2
+
+#define PACK_PIXEL(rgb_ptr, r, g, b) \
+{ \
+	uint16x8_t rgb_lo = vshll_n_u8(vget_low_u8(r), 8); \
+	uint16x8_t rgb_hi = vshll_n_u8(vget_high_u8(r), 8); \
+	rgb_lo = vsriq_n_u16(rgb_lo, vshll_n_u8(vget_low_u8(g), 8), 5); \
+	rgb_hi = vsriq_n_u16(rgb_hi, vshll_n_u8(vget_high_u8(g), 8), 5); \
+	rgb_lo = vsriq_n_u16(rgb_lo, vshll_n_u8(vget_low_u8(b), 8), 11); \
+	rgb_hi = vsriq_n_u16(rgb_hi, vshll_n_u8(vget_high_u8(b), 8), 11); \
+	vst1q_u16((uint16_t *)(rgb_ptr), rgb_lo); \
+	vst1q_u16((uint16_t *)(rgb_ptr) + 8, rgb_hi); \
+	rgb_ptr += 32; \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define RGB_PIXEL_SIZE 3
+
+#define PACK_PIXEL(rgb_ptr, r, g, b) \
+{ \
+	uint8x16x3_t rgb; \
+	rgb.val[0] = r; \
+	rgb.val[1] = g; \
+	rgb.val[2] = b; \
+	vst3q_u8(rgb_ptr, rgb); \
+	rgb_ptr += 48; \
+}
+
+#else
+
+#define RGB_PIXEL_SIZE 4
+
+/* The 32-bit formats are stored as native Uint32 values, the channels
+   below are listed in little endian memory order */
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define SET_CHANNELS(rgba, a, r, g, b) \
+	rgba.val[0] = a; \
+	rgba.val[1] = b; \
+	rgba.val[2] = g; \
+	rgba.val[3] = r;
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define SET_CHANNELS(rgba, a, r, g, b) \
+	rgba.val[0] = a; \
+	rgba.val[1] = r; \
+	rgba.val[2] = g; \
+	rgba.val[3] = b;
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define SET_CHANNELS(rgba, a, r, g, b) \
+	rgba.val[0] = b; \
+	rgba.val[1] = g; \
+	rgba.val[2] = r; \
+	rgba.val[3] = a;
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+#define SET_CHANNELS(rgba, a, r, g, b) \
+	rgba.val[0] = r; \
+	rgba.val[1] = g; \
+	rgba.val[2] = b; \
+	rgba.val[3] = a;
+#else
+#error PACK_PIXEL unimplemented
+#endif
+
+#define PACK_PIXEL(rgb_ptr, r, g, b) \
+{ \
+	const uint8x16_t a = vdupq_n_u8(0xFF); \
+	uint8x16x4_t rgba; \
+	SET_CHANNELS(rgba, a, r, g, b) \
+	vst4q_u8(rgb_ptr, rgba); \
+	rgb_ptr += 64; \
+}
+
+#endif
+
+/* CONVERT_PIXELS converts 16 Y values sharing the chroma contributions
+   r_tmp, g_tmp and b_tmp (one int16x8x2_t per output half) */
+#define CONVERT_PIXELS(y, r_tmp, g_tmp, b_tmp, r, g, b) \
+{ \
+	int16x8_t y_lo = neon_y_contribution(vget_low_u8(y), y_shift, param->y_factor); \
+	int16x8_t y_hi = neon_y_contribution(vget_high_u8(y), y_shift, param->y_factor); \
+	r = vcombine_u8(neon_pack_channel(y_lo, r_tmp.val[0]), neon_pack_channel(y_hi, r_tmp.val[1])); \
+	g = vcombine_u8(neon_pack_channel(y_lo, g_tmp.val[0]), neon_pack_channel(y_hi, g_tmp.val[1])); \
+	b = vcombine_u8(neon_pack_channel(y_lo, b_tmp.val[0]), neon_pack_channel(y_hi, b_tmp.val[1])); \
+}
+
+void NEON_FUNCTION_NAME(
+	uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	#define y_pixel_stride 1
+	#define uv_pixel_stride 1
+	#define uv_y_sample_interval 2
+#elif YUV_FORMAT == YUV_FORMAT_422
+	#define y_pixel_stride 2
+	#define uv_pixel_stride 4
+	#define uv_y_sample_interval 1
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	#define y_pixel_stride 1
+	#define uv_pixel_stride 2
+	#define uv_y_sample_interval 2
+#endif
+
+	const uint8x8_t y_shift = vdup_n_u8(param->y_shift);
+	const uint32_t vector_width = (width & ~15);
+	uint32_t x, y;
+
+#if YUV_FORMAT == YUV_FORMAT_422
+	/* The packed formats are read as groups of four bytes, find out where
+	   the luma and chroma samples sit inside of each group */
+	const uint8_t *packed_ptr = SDL_min(Y, SDL_min(U, V));
+	const int y_index = (int)(Y - packed_ptr);
+	const int u_index = (int)(U - packed_ptr);
+	const int v_index = (int)(V - packed_ptr);
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	/* The chroma samples are interleaved, U first for NV12 and V first for NV21 */
+	const uint8_t *uv_base = SDL_min(U, V);
+	const int u_index = (U < V) ? 0 : 1;
+#endif
+
+	for (y = 0; y < (height - (uv_y_sample_interval - 1)) && vector_width > 0; y += uv_y_sample_interval)
+	{
+		uint8_t *rgb_ptr1 = RGB + y * RGB_stride;
+#if YUV_FORMAT == YUV_FORMAT_420
+		const uint8_t *y_ptr1 = Y + y * Y_stride;
+		const uint8_t *y_ptr2 = Y + (y + 1) * Y_stride;
+		const uint8_t *u_ptr = U + (y / 2) * UV_stride;
+		const uint8_t *v_ptr = V + (y / 2) * UV_stride;
+		uint8_t *rgb_ptr2 = RGB + (y + 1) * RGB_stride;
+#elif YUV_FORMAT == YUV_FORMAT_422
+		const uint8_t *packed_row = packed_ptr + y * Y_stride;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+		const uint8_t *y_ptr1 = Y + y * Y_stride;
+		const uint8_t *y_ptr2 = Y + (y + 1) * Y_stride;
+		const uint8_t *uv_ptr = uv_base + (y / 2) * UV_stride;
+		uint8_t *rgb_ptr2 = RGB + (y + 1) * RGB_stride;
+#endif
+
+		for (x = 0; x < vector_width; x += 16)
+		{
+			int16x8_t r_tmp, g_tmp, b_tmp;
+			uint8x16_t r, g, b;
+#if YUV_FORMAT == YUV_FORMAT_422
+			/* 8 pairs of pixels, each pair sharing one U and V sample */
+			const uint8x8x4_t packed = vld4_u8(packed_row);
+			const int16x8_t y_even = neon_y_contribution(packed.val[y_index], y_shift, param->y_factor);
+			const int16x8_t y_odd = neon_y_contribution(packed.val[y_index + 2], y_shift, param->y_factor);
+			uint8x8x2_t r_zip, g_zip, b_zip;
+
+			neon_uv_contribution(packed.val[u_index], packed.val[v_index], param, &r_tmp, &g_tmp, &b_tmp);
+
+			r_zip = vzip_u8(neon_pack_channel(y_even, r_tmp), neon_pack_channel(y_odd, r_tmp));
+			g_zip = vzip_u8(neon_pack_channel(y_even, g_tmp), neon_pack_channel(y_odd, g_tmp));
+			b_zip = vzip_u8(neon_pack_channel(y_even, b_tmp), neon_pack_channel(y_odd, b_tmp));
+
+			r = vcombine_u8(r_zip.val[0], r_zip.val[1]);
+			g = vcombine_u8(g_zip.val[0], g_zip.val[1]);
+			b = vcombine_u8(b_zip.val[0], b_zip.val[1]);
+			PACK_PIXEL(rgb_ptr1, r, g, b);
+
+			packed_row += 32;
+#else
+			int16x8x2_t r_tmp2, g_tmp2, b_tmp2;
+			uint8x16_t y1, y2;
+#if YUV_FORMAT == YUV_FORMAT_420
+			neon_uv_contribution(vld1_u8(u_ptr), vld1_u8(v_ptr), param, &r_tmp, &g_tmp, &b_tmp);
+			u_ptr += 8;
+			v_ptr += 8;
+#else
+			const uint8x8x2_t uv = vld2_u8(uv_ptr);
+			neon_uv_contribution(uv.val[u_index], uv.val[1 - u_index], param, &r_tmp, &g_tmp, &b_tmp);
+			uv_ptr += 16;
+#endif
+			/* Each chroma sample covers two horizontally adjacent pixels */
+			r_tmp2 = vzipq_s16(r_tmp, r_tmp);
+			g_tmp2 = vzipq_s16(g_tmp, g_tmp);
+			b_tmp2 = vzipq_s16(b_tmp, b_tmp);
+
+			y1 = vld1q_u8(y_ptr1);
+			CONVERT_PIXELS(y1, r_tmp2, g_tmp2, b_tmp2, r, g, b);
+			PACK_PIXEL(rgb_ptr1, r, g, b);
+
+			y2 = vld1q_u8(y_ptr2);
+			CONVERT_PIXELS(y2, r_tmp2, g_tmp2, b_tmp2, r, g, b);
+			PACK_PIXEL(rgb_ptr2, r, g, b);
+
+			y_ptr1 += 16;
+			y_ptr2 += 16;
+#endif
+		}
+	}
+
+	/* Catch the remaining columns, and the last line if the height is odd */
+	if (vector_width < width) {
+		STD_FUNCTION_NAME(width - vector_width, height,
+			Y + vector_width * y_pixel_stride,
+			U + (vector_width / 2) * uv_pixel_stride,
+			V + (vector_width / 2) * uv_pixel_stride,
+			Y_stride, UV_stride,
+			RGB + vector_width * RGB_PIXEL_SIZE, RGB_stride,
+			yuv_type);
+	}
+	if (uv_y_sample_interval == 2 && (height & 1) && vector_width > 0) {
+		y = height - 1;
+		STD_FUNCTION_NAME(vector_width, 1,
+			Y + y * Y_stride,
+			U + (y / 2) * UV_stride,
+			V + (y / 2) * UV_stride,
+			Y_stride, UV_stride,
+			RGB + y * RGB_stride, RGB_stride,
+			yuv_type);
+	}
+
+	#undef y_pixel_stride
+	#undef uv_pixel_stride
+	#undef uv_y_sample_interval
+}
+
+#undef NEON_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef RGB_PIXEL_SIZE
+#undef SET_CHANNELS
+#undef PACK_PIXEL
+#undef CONVERT_PIXELS
@@ -119,6 +119,103 @@ static uint8_t clampU8(int32_t v)
 #define RGB_FORMAT			RGB_FORMAT_ABGR
 #include "yuv_rgb_std_func.h"
 
+// The P010 samples are reduced to 10 bits, so the sums below have two more
+// integer bits than the 8 bit ones. Shift them down and clamp to [0:255]
+static uint8_t clampU8_10(int32_t v)
+{
+    if (v < 0) {
+        return 0;
+    }
+    v >>= PRECISION + 2;
+    return (uint8_t)(v > 255 ? 255 : v);
+}
+
+// same as clampU8_10, keeping all 10 bits
+static uint32_t clampU10(int32_t v)
+{
+    if (v < 0) {
+        return 0;
+    }
+    v >>= PRECISION;
+    return (uint32_t)(v > 1023 ? 1023 : v);
+}
+
+static SDL_INLINE uint32_t pack_p010_pixel(int32_t y_tmp, int32_t r_tmp, int32_t g_tmp, int32_t b_tmp, SDL_bool rgb10)
+{
+    if (rgb10) {
+        return 0xC0000000 |
+               (clampU10(y_tmp + r_tmp) << 20) |
+               (clampU10(y_tmp + g_tmp) << 10) |
+               clampU10(y_tmp + b_tmp);
+    }
+    return 0xFF000000 |
+           (((uint32_t)clampU8_10(y_tmp + r_tmp)) << 16) |
+           (((uint32_t)clampU8_10(y_tmp + g_tmp)) << 8) |
+           ((uint32_t)clampU8_10(y_tmp + b_tmp));
+}
+
+static void yuvp010_std(
+    uint32_t width, uint32_t height,
+    const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+    uint8_t *RGB, uint32_t RGB_stride,
+    YCbCrType yuv_type, SDL_bool rgb10)
+{
+    const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+    const int32_t y_shift = param->y_shift << 2;
+    uint32_t x, y;
+
+    for (y = 0; y < height; ++y) {
+        const uint16_t *y_ptr = (const uint16_t *)(Y + y * Y_stride);
+        const uint16_t *u_ptr = (const uint16_t *)(U + (y / 2) * UV_stride);
+        const uint16_t *v_ptr = (const uint16_t *)(V + (y / 2) * UV_stride);
+        uint32_t *rgb_ptr = (uint32_t *)(RGB + y * RGB_stride);
+
+        for (x = 0; x < width; x += 2) {
+            // Compute U and V contributions, common to the two pixels
+
+            int32_t u_tmp = (*u_ptr >> 6) - 512;
+            int32_t v_tmp = (*v_ptr >> 6) - 512;
+
+            int32_t r_tmp = (v_tmp * param->v_r_factor);
+            int32_t g_tmp = (u_tmp * param->u_g_factor + v_tmp * param->v_g_factor);
+            int32_t b_tmp = (u_tmp * param->u_b_factor);
+
+            // Compute the Y contribution for each pixel
+
+            int32_t y_tmp = (((y_ptr[0] >> 6) - y_shift) * param->y_factor);
+            rgb_ptr[0] = pack_p010_pixel(y_tmp, r_tmp, g_tmp, b_tmp, rgb10);
+
+            if (x + 1 < width) {
+                y_tmp = (((y_ptr[1] >> 6) - y_shift) * param->y_factor);
+                rgb_ptr[1] = pack_p010_pixel(y_tmp, r_tmp, g_tmp, b_tmp, rgb10);
+            }
+
+            y_ptr += 2;
+            u_ptr += 2;
+            v_ptr += 2;
+            rgb_ptr += 2;
+        }
+    }
+}
+
+void yuvp010_argb_std(
+    uint32_t width, uint32_t height,
+    const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+    uint8_t *RGB, uint32_t RGB_stride,
+    YCbCrType yuv_type)
+{
+    yuvp010_std(width, height, Y, U, V, Y_stride, UV_stride, RGB, RGB_stride, yuv_type, SDL_FALSE);
+}
+
+void yuvp010_argb2101010_std(
+    uint32_t width, uint32_t height,
+    const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+    uint8_t *RGB, uint32_t RGB_stride,
+    YCbCrType yuv_type)
+{
+    yuvp010_std(width, height, Y, U, V, Y_stride, UV_stride, RGB, RGB_stride, yuv_type, SDL_TRUE);
+}
+
 void rgb24_yuv420_std(
     uint32_t width, uint32_t height,
     const uint8_t *RGB, uint32_t RGB_stride,
@@ -0,0 +1,427 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmarks the audio conversion, resampling, stream and mixing paths.
+
+   Results go to stdout as CSV, one line per benchmark, so runs from
+   different builds can be compared with a script. Lines starting with '#'
+   describe the machine and build the numbers came from. */
+
+#include <stdio.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    const char *name;
+    SDL_AudioFormat format;
+} BenchFormat;
+
+static const BenchFormat formats[] = {
+    { "U8", AUDIO_U8 },
+    { "S8", AUDIO_S8 },
+    { "S16LSB", AUDIO_S16LSB },
+    { "S16MSB", AUDIO_S16MSB },
+    { "U16LSB", AUDIO_U16LSB },
+    { "U16MSB", AUDIO_U16MSB },
+    { "S32LSB", AUDIO_S32LSB },
+    { "S32MSB", AUDIO_S32MSB },
+    { "F32LSB", AUDIO_F32LSB },
+    { "F32MSB", AUDIO_F32MSB },
+};
+
+static double bench_seconds = 0.25;
+static int bench_frames = 4096;
+static const char *bench_filter = NULL;
+
+/* Each benchmark prepares its data untimed, then times a single call. */
+typedef void (*BenchPrepareFunc)(void *userdata);
+typedef int (*BenchRunFunc)(void *userdata);
+
+static void RunBenchmark(const char *group, const char *name, int channels, int samples,
+                         BenchPrepareFunc prepare, BenchRunFunc run, void *userdata)
+{
+    const double freq = (double)SDL_GetPerformanceFrequency();
+    const Uint64 budget = (Uint64)(bench_seconds * freq);
+    Uint64 total = 0, min = ~(Uint64)0, max = 0;
+    Uint64 calls = 0;
+    int i;
+
+    if (bench_filter && !SDL_strstr(group, bench_filter) && !SDL_strstr(name, bench_filter)) {
+        return;
+    }
+
+    /* warm up the caches and any lazily chosen code paths. */
+    for (i = 0; i < 3; i++) {
+        if (prepare) {
+            prepare(userdata);
+        }
+        if (run(userdata) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s/%s failed: %s\n", group, name, SDL_GetError());
+            return;
+        }
+    }
+
+    while (total < budget) {
+        Uint64 start, elapsed;
+        if (prepare) {
+            prepare(userdata);
+        }
+        start = SDL_GetPerformanceCounter();
+        run(userdata);
+        elapsed = SDL_GetPerformanceCounter() - start;
+        total += elapsed;
+        min = SDL_min(min, elapsed);
+        max = SDL_max(max, elapsed);
+        calls++;
+    }
+
+    printf("%s,%s,%d,%d,%" SDL_PRIu64 ",%.0f,%.1f,%.1f,%.1f\n", group, name, channels, samples, calls,
+           ((double)samples * calls) / (total / freq),
+           (total / freq) * 1e9 / calls, (min / freq) * 1e9, (max / freq) * 1e9);
+    fflush(stdout);
+}
+
+/* SDL_ConvertAudio() works in place, so the input is copied back in before every call. */
+typedef struct
+{
+    SDL_AudioCVT cvt;
+    Uint8 *src;
+    int srclen;
+} ConvertBench;
+
+static void PrepareConvert(void *userdata)
+{
+    ConvertBench *bench = (ConvertBench *)userdata;
+    SDL_memcpy(bench->cvt.buf, bench->src, bench->srclen);
+    bench->cvt.len = bench->srclen;
+}
+
+static int RunConvert(void *userdata)
+{
+    ConvertBench *bench = (ConvertBench *)userdata;
+    return SDL_ConvertAudio(&bench->cvt);
+}
+
+static void BenchmarkConvert(const char *group, const char *name,
+                             SDL_AudioFormat src_format, int src_channels, int src_rate,
+                             SDL_AudioFormat dst_format, int dst_channels, int dst_rate)
+{
+    ConvertBench bench;
+    int i;
+
+    SDL_zero(bench);
+    if (SDL_BuildAudioCVT(&bench.cvt, src_format, src_channels, src_rate, dst_format, dst_channels, dst_rate) <= 0) {
+        return; /* nothing to convert, or not supported. */
+    }
+
+    bench.srclen = bench_frames * src_channels * (SDL_AUDIO_BITSIZE(src_format) / 8);
+    bench.src = (Uint8 *)SDL_malloc(bench.srclen);
+    bench.cvt.buf = (Uint8 *)SDL_malloc((size_t)bench.srclen * bench.cvt.len_mult);
+    if (!bench.src || !bench.cvt.buf) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory.\n");
+    } else {
+        /* something that isn't silence, so nothing can take a shortcut. */
+        for (i = 0; i < bench.srclen; i++) {
+            bench.src[i] = (Uint8)((i * 37) ^ (i >> 3));
+        }
+        if (SDL_AUDIO_ISFLOAT(src_format)) {
+            const int samples = bench.srclen / 4;
+            for (i = 0; i < samples; i++) {
+                const float sample = SDL_sinf(i * 0.01f) * 0.9f;
+                SDL_memcpy(bench.src + i * 4, &sample, 4);
+            }
+            if (SDL_AUDIO_ISBIGENDIAN(src_format) != SDL_AUDIO_ISBIGENDIAN(AUDIO_F32SYS)) {
+                for (i = 0; i < samples; i++) {
+                    Uint32 *sample = (Uint32 *)(bench.src + i * 4);
+                    *sample = SDL_Swap32(*sample);
+                }
+            }
+        }
+        RunBenchmark(group, name, src_channels, bench_frames * src_channels, PrepareConvert, RunConvert, &bench);
+    }
+
+    SDL_free(bench.cvt.buf);
+    SDL_free(bench.src);
+}
+
+static void BenchmarkConversions(void)
+{
+    static const struct
+    {
+        const char *name;
+        int src_channels;
+        int dst_channels;
+    } layouts[] = {
+        { "mono->stereo", 1, 2 },
+        { "stereo->mono", 2, 1 },
+        { "stereo->5.1", 2, 6 },
+        { "5.1->stereo", 6, 2 },
+        { "7.1->5.1", 8, 6 },
+    };
+    char name[64];
+    int i;
+
+    /* every format to and from float covers each of the SDL_Convert_* kernels. */
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        SDL_snprintf(name, sizeof(name), "%s->F32SYS", formats[i].name);
+        BenchmarkConvert("convert", name, formats[i].format, 2, 48000, AUDIO_F32SYS, 2, 48000);
+        SDL_snprintf(name, sizeof(name), "F32SYS->%s", formats[i].name);
+        BenchmarkConvert("convert", name, AUDIO_F32SYS, 2, 48000, formats[i].format, 2, 48000);
+    }
+
+    for (i = 0; i < SDL_arraysize(layouts); i++) {
+        BenchmarkConvert("channels", layouts[i].name, AUDIO_F32SYS, layouts[i].src_channels, 48000,
+                         AUDIO_F32SYS, layouts[i].dst_channels, 48000);
+    }
+}
+
+static void BenchmarkResampling(void)
+{
+    static const int rates[][2] = {
+        { 44100, 48000 },
+        { 48000, 44100 },
+        { 22050, 48000 },
+        { 48000, 16000 },
+        { 44100, 96000 },
+        { 44100, 48001 }, /* doesn't reduce to a small ratio. */
+    };
+    static const int channels[] = { 1, 2, 6 };
+    char name[64];
+    int i, j;
+
+    for (i = 0; i < SDL_arraysize(rates); i++) {
+        for (j = 0; j < SDL_arraysize(channels); j++) {
+            SDL_snprintf(name, sizeof(name), "%d->%d", rates[i][0], rates[i][1]);
+            BenchmarkConvert("resample", name, AUDIO_F32SYS, channels[j], rates[i][0],
+                             AUDIO_F32SYS, channels[j], rates[i][1]);
+        }
+    }
+}
+
+typedef struct
+{
+    SDL_AudioStream *stream;
+    Uint8 *src;
+    int srclen;
+    Uint8 *dst;
+    int dstlen;
+    SDL_bool reserve;
+} StreamBench;
+
+static int RunStream(void *userdata)
+{
+    StreamBench *bench = (StreamBench *)userdata;
+    int avail;
+
+    if (bench->reserve) {
+        const void *ptr;
+        void *buf = SDL_AudioStreamReservePut(bench->stream, bench->srclen);
+        if (!buf) {
+            return -1;
+        }
+        SDL_memcpy(buf, bench->src, bench->srclen);
+        if (SDL_AudioStreamCommitPut(bench->stream, bench->srclen) < 0) {
+            return -1;
+        }
+        /* just touch the data, like a mixer reading it would. */
+        avail = bench->dstlen;
+        while ((ptr = SDL_AudioStreamReserveGet(bench->stream, &avail)) != NULL) {
+            bench->dst[0] ^= *(const Uint8 *)ptr;
+            SDL_AudioStreamCommitGet(bench->stream, avail);
+            avail = bench->dstlen;
+        }
+        return 0;
+    }
+
+    if (SDL_AudioStreamPut(bench->stream, bench->src, bench->srclen) < 0) {
+        return -1;
+    }
+    while ((avail = SDL_AudioStreamGet(bench->stream, bench->dst, bench->dstlen)) > 0) {
+    }
+    return avail;
+}
+
+static void BenchmarkStreams(void)
+{
+    static const int chunks[] = { 64, 256, 1024, 4096, 16384 }; /* sample frames */
+    static const struct
+    {
+        const char *name;
+        SDL_AudioFormat src_format;
+        int src_rate;
+        SDL_AudioFormat dst_format;
+        int dst_rate;
+    } specs[] = {
+        { "S16-44100->F32-48000", AUDIO_S16SYS, 44100, AUDIO_F32SYS, 48000 },
+        { "S16-48000->F32-48000", AUDIO_S16SYS, 48000, AUDIO_F32SYS, 48000 },
+        { "F32-48000->F32-48000", AUDIO_F32SYS, 48000, AUDIO_F32SYS, 48000 },
+    };
+    char name[64];
+    int i, j, reserve;
+
+    for (i = 0; i < SDL_arraysize(specs); i++) {
+        for (j = 0; j < SDL_arraysize(chunks); j++) {
+            for (reserve = 0; reserve < 2; reserve++) {
+                StreamBench bench;
+                int k;
+
+                SDL_zero(bench);
+                bench.reserve = reserve ? SDL_TRUE : SDL_FALSE;
+                bench.stream = SDL_NewAudioStream(specs[i].src_format, 2, specs[i].src_rate, specs[i].dst_format, 2, specs[i].dst_rate);
+                bench.srclen = chunks[j] * 2 * (SDL_AUDIO_BITSIZE(specs[i].src_format) / 8);
+                bench.src = (Uint8 *)SDL_calloc(1, bench.srclen);
+                bench.dstlen = 4096 * 2 * (SDL_AUDIO_BITSIZE(specs[i].dst_format) / 8);
+                bench.dst = (Uint8 *)SDL_malloc(bench.dstlen);
+                if (!bench.stream || !bench.src || !bench.dst) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up stream: %s\n", SDL_GetError());
+                } else {
+                    for (k = 0; k < bench.srclen; k++) {
+                        bench.src[k] = (Uint8)(k * 13);
+                    }
+                    SDL_snprintf(name, sizeof(name), "%s/%d/%s", specs[i].name, chunks[j], reserve ? "reserve" : "put");
+                    RunBenchmark("stream", name, 2, chunks[j] * 2, NULL, RunStream, &bench);
+                }
+                SDL_free(bench.dst);
+                SDL_free(bench.src);
+                SDL_FreeAudioStream(bench.stream);
+            }
+        }
+    }
+}
+
+typedef struct
+{
+    SDL_AudioFormat format;
+    Uint8 *dst;
+    Uint8 *src[4];
+    int volume;
+    int num_srcs;
+    Uint32 len;
+} MixBench;
+
+static int RunMix(void *userdata)
+{
+    MixBench *bench = (MixBench *)userdata;
+    if (bench->num_srcs > 1) {
+        return SDL_MixAudioBuffers(bench->dst, (const Uint8 **)bench->src, NULL, bench->num_srcs, bench->format, bench->len);
+    }
+    SDL_MixAudioFormat(bench->dst, bench->src[0], bench->format, bench->len, bench->volume);
+    return 0;
+}
+
+static void BenchmarkMixing(void)
+{
+    static const int volumes[] = { SDL_MIX_MAXVOLUME, SDL_MIX_MAXVOLUME / 2 };
+    static const int num_srcs[] = { 1, 4 };
+    char name[64];
+    int i, j, k;
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        for (k = 0; k < SDL_arraysize(num_srcs); k++) {
+            for (j = 0; j < SDL_arraysize(volumes); j++) {
+                const int bytes = SDL_AUDIO_BITSIZE(formats[i].format) / 8;
+                MixBench bench;
+                int n, s;
+
+                if (num_srcs[k] > 1 && volumes[j] != SDL_MIX_MAXVOLUME) {
+                    continue; /* SDL_MixAudioBuffers() cost doesn't depend on the volume. */
+                }
+
+                SDL_zero(bench);
+                bench.format = formats[i].format;
+                bench.volume = volumes[j];
+                bench.num_srcs = num_srcs[k];
+                bench.len = (Uint32)(bench_frames * 2 * bytes);
+                bench.dst = (Uint8 *)SDL_calloc(1, bench.len);
+                for (s = 0; s < bench.num_srcs; s++) {
+                    bench.src[s] = (Uint8 *)SDL_malloc(bench.len);
+                    if (bench.src[s]) {
+                        /* quiet enough not to clip all the time, so the loops do real work. */
+                        for (n = 0; n < (int)bench.len; n++) {
+                            bench.src[s][n] = (Uint8)((n * (s + 3)) & 0x3F);
+                        }
+                        if (SDL_AUDIO_ISFLOAT(bench.format)) {
+                            for (n = 0; n < (int)bench.len / 4; n++) {
+                                const float sample = SDL_sinf(n * 0.01f * (s + 1)) * 0.2f;
+                                SDL_memcpy(bench.src[s] + n * 4, &sample, 4);
+                            }
+                        }
+                    }
+                }
+                if (!bench.dst || !bench.src[0] || !bench.src[bench.num_srcs - 1]) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory.\n");
+                } else if (bench.num_srcs > 1) {
+                    SDL_snprintf(name, sizeof(name), "%s/buffers/%d", formats[i].name, bench.num_srcs);
+                    RunBenchmark("mix", name, 2, bench_frames * 2 * bench.num_srcs, NULL, RunMix, &bench);
+                } else {
+                    SDL_snprintf(name, sizeof(name), "%s/volume/%d", formats[i].name, bench.volume);
+                    RunBenchmark("mix", name, 2, bench_frames * 2, NULL, RunMix, &bench);
+                }
+
+                for (s = 0; s < bench.num_srcs; s++) {
+                    SDL_free(bench.src[s]);
+                }
+                SDL_free(bench.dst);
+            }
+        }
+    }
+}
+
+static void PrintBuildInfo(void)
+{
+    SDL_version version;
+
+    SDL_GetVersion(&version);
+    printf("# SDL %d.%d.%d (%s) on %s\n", version.major, version.minor, version.patch, SDL_GetRevision(), SDL_GetPlatform());
+    printf("# cpus=%d cacheline=%d sse=%d sse2=%d sse3=%d sse41=%d sse42=%d avx=%d avx2=%d neon=%d altivec=%d\n",
+           SDL_GetCPUCount(), SDL_GetCPUCacheLineSize(), SDL_HasSSE(), SDL_HasSSE2(), SDL_HasSSE3(),
+           SDL_HasSSE41(), SDL_HasSSE42(), SDL_HasAVX(), SDL_HasAVX2(), SDL_HasNEON(), SDL_HasAltiVec());
+    printf("# frames=%d seconds=%g\n", bench_frames, bench_seconds);
+    printf("group,name,channels,samples_per_call,calls,samples_per_sec,avg_ns,min_ns,max_ns\n");
+}
+
+int main(int argc, char **argv)
+{
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--seconds") == 0 && argv[i + 1]) {
+            bench_seconds = SDL_atof(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+            bench_frames = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--filter") == 0 && argv[i + 1]) {
+            bench_filter = argv[++i];
+        } else {
+            SDL_Log("USAGE: %s [--seconds per_benchmark] [--frames per_call] [--filter substring]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (bench_seconds <= 0.0 || bench_frames <= 0) {
+        SDL_Log("--seconds and --frames must be positive\n");
+        return 1;
+    }
+
+    PrintBuildInfo();
+    BenchmarkConversions();
+    BenchmarkResampling();
+    BenchmarkStreams();
+    BenchmarkMixing();
+
+    return 0;
+}
+
+/* end of testaudiobench.c ... */
@@ -1213,6 +1213,450 @@ int audio_resampleLoss(void)
   return TEST_COMPLETED;
 }
 
+/**
+ * \brief Check that resampling interleaved channels gives the same result as resampling each channel on its own.
+ */
+int audio_resampleChannels(void)
+{
+  const int rates[][2] = { { 44100, 48000 }, { 48000, 22050 }, { 8000, 44100 }, { 44100, 48001 } };
+  const int channels[] = { 2, 4, 6, 8 };
+  const int frames_in = 4000;
+  int r, c, ch, i;
+
+  for (r = 0; r < (int)SDL_arraysize(rates); ++r) {
+    const int rate_in = rates[r][0];
+    const int rate_out = rates[r][1];
+    SDL_AudioCVT mono;
+    float *expected;
+    int frames_out;
+    int ret;
+
+    ret = SDL_BuildAudioCVT(&mono, AUDIO_F32SYS, 1, rate_in, AUDIO_F32SYS, 1, rate_out);
+    SDLTest_AssertCheck(ret == 1, "Expected SDL_BuildAudioCVT to succeed and conversion to be needed.");
+    if (ret != 1) {
+      return TEST_ABORTED;
+    }
+    mono.len = frames_in * (int)sizeof(float);
+    mono.buf = (Uint8 *)SDL_malloc(mono.len * mono.len_mult);
+    SDLTest_AssertCheck(mono.buf != NULL, "Expected input buffer to be created.");
+    if (mono.buf == NULL) {
+      return TEST_ABORTED;
+    }
+    for (i = 0; i < frames_in; ++i) {
+      ((float *)mono.buf)[i] = (float)sine_wave_sample(i, rate_in, 440, 0);
+    }
+    ret = SDL_ConvertAudio(&mono);
+    SDLTest_AssertPass("Call to SDL_ConvertAudio() resampling mono from %i Hz to %i Hz", rate_in, rate_out);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_ConvertAudio to succeed.");
+    expected = (float *)mono.buf;
+    frames_out = mono.len_cvt / (int)sizeof(float);
+
+    for (c = 0; c < (int)SDL_arraysize(channels); ++c) {
+      const int chans = channels[c];
+      SDL_AudioCVT cvt;
+      double max_error = 0;
+      float *output;
+
+      ret = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, chans, rate_in, AUDIO_F32SYS, chans, rate_out);
+      SDLTest_AssertCheck(ret == 1, "Expected SDL_BuildAudioCVT to succeed and conversion to be needed.");
+      if (ret != 1) {
+        SDL_free(mono.buf);
+        return TEST_ABORTED;
+      }
+      cvt.len = frames_in * chans * (int)sizeof(float);
+      cvt.buf = (Uint8 *)SDL_malloc(cvt.len * cvt.len_mult);
+      SDLTest_AssertCheck(cvt.buf != NULL, "Expected input buffer to be created.");
+      if (cvt.buf == NULL) {
+        SDL_free(mono.buf);
+        return TEST_ABORTED;
+      }
+      /* scale each channel differently, so swapped channels show up as errors. */
+      for (i = 0; i < frames_in; ++i) {
+        for (ch = 0; ch < chans; ++ch) {
+          ((float *)cvt.buf)[i * chans + ch] = (float)(sine_wave_sample(i, rate_in, 440, 0) * (ch + 1) / chans);
+        }
+      }
+      ret = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertPass("Call to SDL_ConvertAudio() resampling %i channels from %i Hz to %i Hz", chans, rate_in, rate_out);
+      SDLTest_AssertCheck(ret == 0, "Expected SDL_ConvertAudio to succeed.");
+      SDLTest_AssertCheck(cvt.len_cvt == frames_out * chans * (int)sizeof(float), "Expected output length %i, got %i.",
+                          frames_out * chans * (int)sizeof(float), cvt.len_cvt);
+      if (ret != 0 || cvt.len_cvt != frames_out * chans * (int)sizeof(float)) {
+        SDL_free(cvt.buf);
+        SDL_free(mono.buf);
+        return TEST_ABORTED;
+      }
+      output = (float *)cvt.buf;
+      for (i = 0; i < frames_out; ++i) {
+        for (ch = 0; ch < chans; ++ch) {
+          const double target = (double)expected[i] * (ch + 1) / chans;
+          max_error = SDL_max(max_error, SDL_fabs(target - output[i * chans + ch]));
+        }
+      }
+      SDL_free(cvt.buf);
+      SDLTest_AssertCheck(max_error <= 1e-5, "Maximum difference from mono resampling %g should be no more than 1e-5.", max_error);
+    }
+    SDL_free(mono.buf);
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* Reference mixers, one sample at a time, matching what SDL_MixAudioFormat() documents */
+static void mix_s16_reference(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    int i;
+    for (i = 0; i < num_samples; ++i) {
+        const int sample = dst[i] + (src[i] * volume) / SDL_MIX_MAXVOLUME;
+        dst[i] = (Sint16)SDL_clamp(sample, SDL_MIN_SINT16, SDL_MAX_SINT16);
+    }
+}
+
+static void mix_s32_reference(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    int i;
+    for (i = 0; i < num_samples; ++i) {
+        const Sint64 sample = dst[i] + ((Sint64)src[i] * volume) / SDL_MIX_MAXVOLUME;
+        dst[i] = (Sint32)SDL_clamp(sample, SDL_MIN_SINT32, SDL_MAX_SINT32);
+    }
+}
+
+static void mix_f32_reference(float *dst, const float *src, int num_samples, int volume)
+{
+    int i;
+    for (i = 0; i < num_samples; ++i) {
+        const double sample = (double)dst[i] + (double)((src[i] * (float)volume) * (1.0f / SDL_MIX_MAXVOLUME));
+        dst[i] = (float)SDL_clamp(sample, -3.402823466e+38F, 3.402823466e+38F);
+    }
+}
+
+/**
+ * \brief Check that SDL_MixAudioFormat gives bit-exact results for native 16-bit, 32-bit and float samples.
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioFormat
+ */
+int audio_mixAudioFormat(void *arg)
+{
+    /* An odd sample count so the leftover samples after the SIMD loops are covered too */
+    const int num_samples = 1027;
+    const int volumes[] = { 1, 37, 64, 100, SDL_MIX_MAXVOLUME };
+    Sint32 *src = (Sint32 *)SDL_malloc(num_samples * sizeof(Sint32));
+    Sint32 *dst = (Sint32 *)SDL_malloc(num_samples * sizeof(Sint32));
+    Sint32 *expected = (Sint32 *)SDL_malloc(num_samples * sizeof(Sint32));
+    int i, v, format;
+
+    SDLTest_AssertCheck(src && dst && expected, "Expected buffers to be created.");
+    if (!src || !dst || !expected) {
+        SDL_free(src);
+        SDL_free(dst);
+        SDL_free(expected);
+        return TEST_ABORTED;
+    }
+
+    for (format = 0; format < 3; ++format) {
+        for (v = 0; v < (int)SDL_arraysize(volumes); ++v) {
+            const int volume = volumes[v];
+            int mismatch = -1;
+
+            for (i = 0; i < num_samples; ++i) {
+                if (format == 0) {
+                    /* Include full scale values so the saturation is exercised */
+                    ((Sint16 *)src)[i] = (i % 7 == 0) ? SDL_MIN_SINT16 : (Sint16)SDLTest_RandomSint16();
+                    ((Sint16 *)dst)[i] = (i % 5 == 0) ? SDL_MAX_SINT16 : (Sint16)SDLTest_RandomSint16();
+                } else if (format == 1) {
+                    src[i] = (i % 7 == 0) ? SDL_MIN_SINT32 : SDLTest_RandomSint32();
+                    dst[i] = (i % 5 == 0) ? SDL_MAX_SINT32 : SDLTest_RandomSint32();
+                } else {
+                    ((float *)src)[i] = (i % 7 == 0) ? 3.4e+38f : SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+                    ((float *)dst)[i] = (i % 5 == 0) ? 3.4e+38f : SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+                }
+            }
+            SDL_memcpy(expected, dst, num_samples * sizeof(Sint32));
+
+            if (format == 0) {
+                mix_s16_reference((Sint16 *)expected, (const Sint16 *)src, num_samples, volume);
+                SDL_MixAudioFormat((Uint8 *)dst, (const Uint8 *)src, AUDIO_S16SYS, num_samples * sizeof(Sint16), volume);
+            } else if (format == 1) {
+                mix_s32_reference(expected, src, num_samples, volume);
+                SDL_MixAudioFormat((Uint8 *)dst, (const Uint8 *)src, AUDIO_S32SYS, num_samples * sizeof(Sint32), volume);
+            } else {
+                mix_f32_reference((float *)expected, (const float *)src, num_samples, volume);
+                SDL_MixAudioFormat((Uint8 *)dst, (const Uint8 *)src, AUDIO_F32SYS, num_samples * sizeof(float), volume);
+            }
+
+            for (i = 0; i < num_samples; ++i) {
+                if (dst[i] != expected[i]) {
+                    mismatch = i;
+                    break;
+                }
+            }
+            SDLTest_AssertCheck(mismatch < 0, "Check mixed %s samples at volume %d match the reference (first mismatch: %d)",
+                                format == 0 ? "AUDIO_S16SYS" : format == 1 ? "AUDIO_S32SYS" : "AUDIO_F32SYS", volume, mismatch);
+        }
+    }
+
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_free(expected);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Check that SDL_MixAudioBuffers sums all sources before clipping once.
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioBuffers
+ */
+int audio_mixAudioBuffers(void *arg)
+{
+    enum { NUM_SAMPLES = 1500, NUM_SRCS = 3 };
+    const int volumes[NUM_SRCS] = { SDL_MIX_MAXVOLUME, 64, 17 };
+    Sint16 srcs16[NUM_SRCS][NUM_SAMPLES];
+    float srcsf[NUM_SRCS][NUM_SAMPLES];
+    const Uint8 *srcs[NUM_SRCS];
+    Sint16 dst16[NUM_SAMPLES];
+    float dstf[NUM_SAMPLES];
+    Sint16 expected16[NUM_SAMPLES];
+    float expectedf[NUM_SAMPLES];
+    int i, j, ret, mismatch;
+
+    for (i = 0; i < NUM_SAMPLES; ++i) {
+        Sint32 sum16;
+        float sumf;
+
+        dst16[i] = SDLTest_RandomSint16();
+        dstf[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+        sum16 = dst16[i];
+        sumf = dstf[i];
+        for (j = 0; j < NUM_SRCS; ++j) {
+            srcs16[j][i] = SDLTest_RandomSint16();
+            srcsf[j][i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+            sum16 += (srcs16[j][i] * volumes[j]) / SDL_MIX_MAXVOLUME;
+            sumf += (srcsf[j][i] * (float)volumes[j]) * (1.0f / SDL_MIX_MAXVOLUME);
+        }
+        expected16[i] = (Sint16)SDL_clamp(sum16, SDL_MIN_SINT16, SDL_MAX_SINT16);
+        expectedf[i] = sumf;
+    }
+
+    for (j = 0; j < NUM_SRCS; ++j) {
+        srcs[j] = (const Uint8 *)srcs16[j];
+    }
+    ret = SDL_MixAudioBuffers((Uint8 *)dst16, srcs, volumes, NUM_SRCS, AUDIO_S16SYS, sizeof(dst16));
+    SDLTest_AssertPass("Call to SDL_MixAudioBuffers(AUDIO_S16SYS)");
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_MixAudioBuffers to succeed, got %d", ret);
+    for (i = 0, mismatch = -1; i < NUM_SAMPLES && mismatch < 0; ++i) {
+        if (dst16[i] != expected16[i]) {
+            mismatch = i;
+        }
+    }
+    SDLTest_AssertCheck(mismatch < 0, "Check mixed AUDIO_S16SYS samples match the reference (first mismatch: %d)", mismatch);
+
+    for (j = 0; j < NUM_SRCS; ++j) {
+        srcs[j] = (const Uint8 *)srcsf[j];
+    }
+    ret = SDL_MixAudioBuffers((Uint8 *)dstf, srcs, volumes, NUM_SRCS, AUDIO_F32SYS, sizeof(dstf));
+    SDLTest_AssertPass("Call to SDL_MixAudioBuffers(AUDIO_F32SYS)");
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_MixAudioBuffers to succeed, got %d", ret);
+    for (i = 0, mismatch = -1; i < NUM_SAMPLES && mismatch < 0; ++i) {
+        if (SDL_fabs(dstf[i] - expectedf[i]) > 1e-6) {
+            mismatch = i;
+        }
+    }
+    SDLTest_AssertCheck(mismatch < 0, "Check mixed AUDIO_F32SYS samples match the reference (first mismatch: %d)", mismatch);
+
+    /* A NULL source is skipped, even when it's the only one */
+    SDL_memcpy(expected16, dst16, sizeof(dst16));
+    srcs[0] = NULL;
+    ret = SDL_MixAudioBuffers((Uint8 *)dst16, srcs, volumes, 1, AUDIO_S16SYS, sizeof(dst16));
+    SDLTest_AssertPass("Call to SDL_MixAudioBuffers() with a single NULL source");
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_MixAudioBuffers to succeed, got %d", ret);
+    SDLTest_AssertCheck(SDL_memcmp(dst16, expected16, sizeof(dst16)) == 0, "Check the destination wasn't changed");
+
+    ret = SDL_MixAudioBuffers((Uint8 *)dst16, srcs, volumes, NUM_SRCS, 0x1234, sizeof(dst16));
+    SDLTest_AssertCheck(ret < 0, "Expected SDL_MixAudioBuffers to fail with an invalid format, got %d", ret);
+    ret = SDL_MixAudioBuffers(NULL, srcs, volumes, NUM_SRCS, AUDIO_S16SYS, sizeof(dst16));
+    SDLTest_AssertCheck(ret < 0, "Expected SDL_MixAudioBuffers to fail with a NULL destination, got %d", ret);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Check that the reserve/commit functions give the same result as SDL_AudioStreamPut() and SDL_AudioStreamGet().
+ */
+int audio_audioStreamReserveCommit(void *arg)
+{
+  const struct {
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+    int dst_rate;
+  } specs[] = {
+    { AUDIO_S16SYS, 2, 44100, AUDIO_S16SYS, 2, 44100 },
+    { AUDIO_S16SYS, 2, 48000, AUDIO_F32SYS, 6, 48000 },
+    { AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 48000 },
+    { AUDIO_U8, 1, 22050, AUDIO_S16SYS, 3, 48000 },
+  };
+  const int chunks[] = { 4, 100, 4096, 17, 20000, 1000, 3 }; /* in sample frames */
+  int s, c, i;
+
+  for (s = 0; s < (int)SDL_arraysize(specs); ++s) {
+    const int src_frame = (SDL_AUDIO_BITSIZE(specs[s].src_format) / 8) * specs[s].src_channels;
+    const int dst_frame = (SDL_AUDIO_BITSIZE(specs[s].dst_format) / 8) * specs[s].dst_channels;
+    SDL_AudioStream *put = SDL_NewAudioStream(specs[s].src_format, specs[s].src_channels, specs[s].src_rate,
+                                              specs[s].dst_format, specs[s].dst_channels, specs[s].dst_rate);
+    SDL_AudioStream *reserve = SDL_NewAudioStream(specs[s].src_format, specs[s].src_channels, specs[s].src_rate,
+                                                  specs[s].dst_format, specs[s].dst_channels, specs[s].dst_rate);
+    Uint8 *expected = NULL;
+    int expected_len, offset;
+    Uint8 sample = 0;
+
+    SDLTest_AssertPass("Testing stream %d (%d channels at %d Hz to %d channels at %d Hz)", s,
+                       specs[s].src_channels, specs[s].src_rate, specs[s].dst_channels, specs[s].dst_rate);
+    SDLTest_AssertCheck(put != NULL && reserve != NULL, "Expected SDL_NewAudioStream to succeed.");
+    if (put == NULL || reserve == NULL) {
+      SDL_FreeAudioStream(put);
+      SDL_FreeAudioStream(reserve);
+      return TEST_ABORTED;
+    }
+
+    for (c = 0; c < (int)SDL_arraysize(chunks); ++c) {
+      const int len = chunks[c] * src_frame;
+      Uint8 *data = (Uint8 *)SDL_malloc(len);
+      Uint8 *ptr;
+      int ret;
+
+      SDLTest_AssertCheck(data != NULL, "Expected buffer to be created.");
+      if (data == NULL) {
+        return TEST_ABORTED;
+      }
+      for (i = 0; i < len; ++i) {
+        data[i] = sample++;
+      }
+      ret = SDL_AudioStreamPut(put, data, len);
+      SDLTest_AssertCheck(ret == 0, "Expected SDL_AudioStreamPut(%d) to succeed.", len);
+
+      /* reserve a bit more than we use, to test shorter commits. */
+      ptr = (Uint8 *)SDL_AudioStreamReservePut(reserve, len + src_frame);
+      SDLTest_AssertCheck(ptr != NULL, "Expected SDL_AudioStreamReservePut(%d) to succeed.", len + src_frame);
+      if (ptr == NULL) {
+        SDL_free(data);
+        return TEST_ABORTED;
+      }
+      ret = SDL_AudioStreamPut(reserve, data, len);
+      SDLTest_AssertCheck(ret == -1, "Expected SDL_AudioStreamPut to fail while space is reserved.");
+      SDL_memcpy(ptr, data, len);
+      ret = SDL_AudioStreamCommitPut(reserve, len);
+      SDLTest_AssertCheck(ret == 0, "Expected SDL_AudioStreamCommitPut(%d) to succeed.", len);
+      SDL_free(data);
+    }
+
+    SDL_AudioStreamFlush(put);
+    SDL_AudioStreamFlush(reserve);
+
+    expected_len = SDL_AudioStreamAvailable(put);
+    SDLTest_AssertCheck(SDL_AudioStreamAvailable(reserve) == expected_len, "Expected %d bytes available, got %d.",
+                        expected_len, SDL_AudioStreamAvailable(reserve));
+    expected = (Uint8 *)SDL_malloc(expected_len);
+    SDLTest_AssertCheck(expected != NULL, "Expected buffer to be created.");
+    if (expected == NULL) {
+      return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_AudioStreamGet(put, expected, expected_len) == expected_len, "Expected SDL_AudioStreamGet to get all the data.");
+
+    offset = 0;
+    while (offset < expected_len) {
+      int len = SDL_min(expected_len - offset, dst_frame * 1000);
+      const Uint8 *ptr = (const Uint8 *)SDL_AudioStreamReserveGet(reserve, &len);
+      if (ptr == NULL || len <= 0 || SDL_memcmp(ptr, expected + offset, len) != 0) {
+        break;
+      }
+      SDL_AudioStreamCommitGet(reserve, len);
+      offset += len;
+    }
+    SDLTest_AssertCheck(offset == expected_len, "Expected SDL_AudioStreamReserveGet to return the same %d bytes as SDL_AudioStreamGet, matched %d.",
+                        expected_len, offset);
+    SDLTest_AssertCheck(SDL_AudioStreamAvailable(reserve) == 0, "Expected the stream to be empty.");
+
+    SDL_free(expected);
+    SDL_FreeAudioStream(put);
+    SDL_FreeAudioStream(reserve);
+  }
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Queue audio with SDL_HINT_AUDIO_QUEUE_LOCKFREE set, while the device drains it.
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudio
+ * \sa https://wiki.libsdl.org/SDL_GetQueuedAudioSize
+ */
+int audio_queueAudioLockFree(void *arg)
+{
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  Uint8 data[1000];
+  Uint32 queued, total = 0;
+  int i, ret;
+
+  SDL_SetHint(SDL_HINT_AUDIO_QUEUE_LOCKFREE, "1");
+
+  SDL_zero(desired);
+  desired.freq = 48000;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 1024;
+  desired.callback = NULL;
+
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDL_SetHint(SDL_HINT_AUDIO_QUEUE_LOCKFREE, NULL);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice(NULL, 0, ...)");
+  if (id == 0) {
+    SDLTest_Log("No devices to test with");
+    return TEST_SKIPPED;
+  }
+
+  for (i = 0; i < (int)sizeof(data); ++i) {
+    data[i] = (Uint8)i;
+  }
+
+  /* more than fits in the lock-free ring, so some of it goes to the overflow list. */
+  for (i = 0; i < 1000; ++i) {
+    ret = SDL_QueueAudio(id, data, sizeof(data));
+    if (ret != 0) {
+      break;
+    }
+    total += sizeof(data);
+  }
+  SDLTest_AssertCheck(i == 1000, "Expected SDL_QueueAudio to succeed, failed at call %d.", i);
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == total, "Expected %" SDL_PRIu32 " bytes queued on a paused device, got %" SDL_PRIu32 ".", total, queued);
+
+  /* keep queueing while the device thread reads. */
+  SDL_PauseAudioDevice(id, 0);
+  for (i = 0; i < 100; ++i) {
+    ret = SDL_QueueAudio(id, data, sizeof(data));
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_QueueAudio to succeed while playing.");
+    total += sizeof(data);
+  }
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued <= total, "Expected at most %" SDL_PRIu32 " bytes queued, got %" SDL_PRIu32 ".", total, queued);
+
+  SDL_ClearQueuedAudio(id);
+  queued = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(queued == 0, "Expected no bytes queued after SDL_ClearQueuedAudio, got %" SDL_PRIu32 ".", queued);
+
+  ret = SDL_QueueAudio(id, data, sizeof(data));
+  SDLTest_AssertCheck(ret == 0, "Expected SDL_QueueAudio to succeed after clearing.");
+
+  SDL_CloseAudioDevice(id);
+  SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1285,11 +1729,32 @@ static const SDLTest_TestCaseReference audioTest16 = {
     (SDLTest_TestCaseFp)audio_resampleLoss, "audio_resampleLoss", "Check signal-to-noise ratio and maximum error of audio resampling.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest17 = {
+    (SDLTest_TestCaseFp)audio_mixAudioFormat, "audio_mixAudioFormat", "Check that mixing native 16-bit, 32-bit and float samples is bit-exact.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest18 = {
+    (SDLTest_TestCaseFp)audio_mixAudioBuffers, "audio_mixAudioBuffers", "Check mixing several audio buffers in one pass.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest19 = {
+    (SDLTest_TestCaseFp)audio_resampleChannels, "audio_resampleChannels", "Check that resampling gives the same result for every channel layout.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    (SDLTest_TestCaseFp)audio_audioStreamReserveCommit, "audio_audioStreamReserveCommit", "Check putting and getting audio stream data without copying it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    (SDLTest_TestCaseFp)audio_queueAudioLockFree, "audio_queueAudioLockFree", "Queue audio through the lock-free buffer queue.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, &audioTest17,
+    &audioTest18, &audioTest19, &audioTest20, &audioTest21, NULL
 };
 
 /* Audio test suite (global) */
@@ -174,6 +174,434 @@ int events_addDelEventWatchWithUserdata(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Pushes events of two types and checks that SDL_PeepEvents() filters and orders them.
+ *
+ * @sa http://wiki.libsdl.org/SDL_PeepEvents
+ */
+int events_peepEventsTypeRange(void *arg)
+{
+    SDL_Event events[16];
+    SDL_Event event;
+    int i, result;
+
+    /* Start with an empty queue */
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_USEREVENT, SDL_USEREVENT + 1);
+
+    for (i = 0; i < (int)SDL_arraysize(events); ++i) {
+        SDL_zero(event);
+        event.type = SDL_USEREVENT + (i % 2);
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+    SDLTest_AssertPass("Call to SDL_PushEvent()");
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_PEEKEVENT, SDL_USEREVENT + 1, SDL_USEREVENT + 1);
+    SDLTest_AssertCheck(result == 8, "Check result from SDL_PeepEvents(SDL_PEEKEVENT), expected: 8, got: %d", result);
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT);
+    SDLTest_AssertCheck(result == 8, "Check result from SDL_PeepEvents(SDL_GETEVENT), expected: 8, got: %d", result);
+    for (i = 0; i < result; ++i) {
+        SDLTest_AssertCheck(events[i].type == SDL_USEREVENT && events[i].user.code == i * 2,
+                            "Check event %d, expected code: %d, got: %d", i, i * 2, events[i].user.code);
+    }
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT + 1);
+    SDLTest_AssertCheck(result == 8, "Check result from SDL_PeepEvents(SDL_GETEVENT), expected: 8, got: %d", result);
+    for (i = 0; i < result; ++i) {
+        SDLTest_AssertCheck(events[i].type == SDL_USEREVENT + 1 && events[i].user.code == i * 2 + 1,
+                            "Check event %d, expected code: %d, got: %d", i, i * 2 + 1, events[i].user.code);
+    }
+
+    result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_USEREVENT, SDL_USEREVENT + 1);
+    SDLTest_AssertCheck(result == 0, "Check that the queue is empty, expected: 0, got: %d", result);
+
+    return TEST_COMPLETED;
+}
+
+/* Event filter that rejects user events with an odd code */
+int SDLCALL _events_oddCodeEventFilter(void *userdata, SDL_Event *event)
+{
+    if (event->type == SDL_USEREVENT && (event->user.code % 2) != 0) {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Pushes several events at once and checks that they are filtered and queued in order.
+ *
+ * @sa http://wiki.libsdl.org/SDL_PushEvents
+ * @sa http://wiki.libsdl.org/SDL_SetEventFilter
+ */
+int events_pushEvents(void *arg)
+{
+    SDL_Event events[16];
+    int i, result;
+
+    for (i = 0; i < (int)SDL_arraysize(events); ++i) {
+        SDL_zero(events[i]);
+        events[i].type = SDL_USEREVENT;
+        events[i].user.code = i;
+    }
+
+    result = SDL_PushEvents(events, SDL_arraysize(events));
+    SDLTest_AssertPass("Call to SDL_PushEvents()");
+    SDLTest_AssertCheck(result == 16, "Check result from SDL_PushEvents, expected: 16, got: %d", result);
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT);
+    SDLTest_AssertCheck(result == 16, "Check result from SDL_PeepEvents, expected: 16, got: %d", result);
+    for (i = 0; i < result; ++i) {
+        SDLTest_AssertCheck(events[i].user.code == i, "Check event %d, expected code: %d, got: %d", i, i, events[i].user.code);
+    }
+
+    /* Only the events with an even code should make it through the filter */
+    SDL_SetEventFilter(_events_oddCodeEventFilter, NULL);
+    SDLTest_AssertPass("Call to SDL_SetEventFilter()");
+
+    for (i = 0; i < (int)SDL_arraysize(events); ++i) {
+        events[i].user.code = i;
+    }
+    result = SDL_PushEvents(events, SDL_arraysize(events));
+    SDLTest_AssertPass("Call to SDL_PushEvents()");
+    SDLTest_AssertCheck(result == 8, "Check result from SDL_PushEvents, expected: 8, got: %d", result);
+
+    SDL_SetEventFilter(NULL, NULL);
+    SDLTest_AssertPass("Call to SDL_SetEventFilter(NULL, NULL)");
+
+    result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_USEREVENT, SDL_USEREVENT);
+    SDLTest_AssertCheck(result == 0, "Check that resetting the filter flushed the queue, expected: 0, got: %d", result);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks the event queue statistics after pushing and polling events.
+ *
+ * @sa http://wiki.libsdl.org/SDL_GetEventQueueStats
+ * @sa http://wiki.libsdl.org/SDL_GetEventQueueTypeCount
+ * @sa http://wiki.libsdl.org/SDL_ResetEventQueueStats
+ */
+int events_queueStats(void *arg)
+{
+    SDL_EventQueueStats stats;
+    SDL_Event event;
+    Uint32 count;
+    int i, result, removed;
+
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+    SDL_ResetEventQueueStats();
+    SDLTest_AssertPass("Call to SDL_ResetEventQueueStats()");
+
+    count = SDL_GetEventQueueTypeCount(SDL_USEREVENT);
+    SDLTest_AssertCheck(count == 0, "Check SDL_GetEventQueueTypeCount after reset, expected: 0, got: %u", (unsigned int)count);
+
+    for (i = 0; i < 3; ++i) {
+        SDL_zero(event);
+        event.type = SDL_USEREVENT;
+        SDL_PushEvent(&event);
+    }
+
+    count = SDL_GetEventQueueTypeCount(SDL_USEREVENT);
+    SDLTest_AssertCheck(count == 3, "Check SDL_GetEventQueueTypeCount, expected: 3, got: %u", (unsigned int)count);
+
+    result = SDL_GetEventQueueStats(&stats);
+    SDLTest_AssertCheck(result == 0, "Check result from SDL_GetEventQueueStats, expected: 0, got: %d", result);
+    SDLTest_AssertCheck(stats.events_added >= 3, "Check events_added, expected: >= 3, got: %u", (unsigned int)stats.events_added);
+    SDLTest_AssertCheck(stats.num_events >= 3, "Check num_events, expected: >= 3, got: %d", stats.num_events);
+    SDLTest_AssertCheck(stats.max_events_seen >= stats.num_events, "Check max_events_seen, expected: >= %d, got: %d", stats.num_events, stats.max_events_seen);
+
+    removed = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) > 0) {
+    }
+
+    result = SDL_GetEventQueueStats(&stats);
+    SDLTest_AssertCheck(result == 0, "Check result from SDL_GetEventQueueStats, expected: 0, got: %d", result);
+    for (i = 0, count = 0; i < SDL_EVENT_LATENCY_BUCKETS; ++i) {
+        count += stats.latency_histogram[i];
+    }
+    SDLTest_AssertCheck(count >= 3 && count <= (Uint32)removed, "Check latency histogram total, expected: 3 to %d, got: %u", removed, (unsigned int)count);
+
+    result = SDL_GetEventQueueStats(NULL);
+    SDLTest_AssertCheck(result < 0, "Check result from SDL_GetEventQueueStats(NULL), expected: < 0, got: %d", result);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks that queued mouse motion is merged when SDL_HINT_EVENT_COALESCE_MOTION is set.
+ *
+ * @sa http://wiki.libsdl.org/SDL_HINT_EVENT_COALESCE_MOTION
+ */
+int events_coalesceMotion(void *arg)
+{
+    SDL_Event events[4];
+    SDL_Event event;
+    int i, result;
+
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, "1");
+    SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, \"1\")");
+
+    /* Three motion events, then a button press, then more motion */
+    for (i = 0; i < 3; ++i) {
+        SDL_zero(event);
+        event.type = SDL_MOUSEMOTION;
+        event.motion.x = 10 * (i + 1);
+        event.motion.y = 20 * (i + 1);
+        event.motion.xrel = 10;
+        event.motion.yrel = 20;
+        SDL_PushEvent(&event);
+    }
+    SDL_zero(event);
+    event.type = SDL_MOUSEBUTTONDOWN;
+    event.button.button = SDL_BUTTON_LEFT;
+    SDL_PushEvent(&event);
+    SDL_zero(event);
+    event.type = SDL_MOUSEMOTION;
+    event.motion.xrel = 1;
+    SDL_PushEvent(&event);
+
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_MOUSEMOTION, SDL_MOUSEBUTTONDOWN);
+    SDLTest_AssertCheck(result == 3, "Check result from SDL_PeepEvents, expected: 3, got: %d", result);
+    if (result == 3) {
+        SDLTest_AssertCheck(events[0].type == SDL_MOUSEMOTION, "Check first event is SDL_MOUSEMOTION, got: 0x%x", events[0].type);
+        SDLTest_AssertCheck(events[0].motion.x == 30 && events[0].motion.y == 60,
+                            "Check merged position, expected: 30,60, got: %d,%d", events[0].motion.x, events[0].motion.y);
+        SDLTest_AssertCheck(events[0].motion.xrel == 30 && events[0].motion.yrel == 60,
+                            "Check merged relative motion, expected: 30,60, got: %d,%d", events[0].motion.xrel, events[0].motion.yrel);
+        SDLTest_AssertCheck(events[1].type == SDL_MOUSEBUTTONDOWN, "Check second event is SDL_MOUSEBUTTONDOWN, got: 0x%x", events[1].type);
+        SDLTest_AssertCheck(events[2].type == SDL_MOUSEMOTION && events[2].motion.xrel == 1,
+                            "Check motion after the button press wasn't merged across it");
+    }
+
+    /* Axis motion is merged past other controllers, but not past another axis of the same one */
+    {
+        static const struct
+        {
+            SDL_JoystickID which;
+            Uint8 axis;
+            Sint16 value;
+        } axes[] = {
+            { 0, SDL_CONTROLLER_AXIS_LEFTX, 1 },
+            { 1, SDL_CONTROLLER_AXIS_LEFTX, 2 },
+            { 0, SDL_CONTROLLER_AXIS_LEFTX, 3 },
+            { 0, SDL_CONTROLLER_AXIS_LEFTY, 4 },
+            { 0, SDL_CONTROLLER_AXIS_LEFTX, 5 },
+        };
+        static const Sint16 expected[] = { 3, 2, 4, 5 };
+
+        for (i = 0; i < SDL_arraysize(axes); ++i) {
+            SDL_zero(event);
+            event.type = SDL_CONTROLLERAXISMOTION;
+            event.caxis.which = axes[i].which;
+            event.caxis.axis = axes[i].axis;
+            event.caxis.value = axes[i].value;
+            SDL_PushEvent(&event);
+        }
+
+        result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_CONTROLLERAXISMOTION, SDL_CONTROLLERAXISMOTION);
+        SDLTest_AssertCheck(result == SDL_arraysize(expected), "Check result from SDL_PeepEvents, expected: %d, got: %d", (int)SDL_arraysize(expected), result);
+        for (i = 0; i < result && i < SDL_arraysize(expected); ++i) {
+            SDLTest_AssertCheck(events[i].caxis.value == expected[i], "Check axis event %d, expected value: %d, got: %d", i, expected[i], events[i].caxis.value);
+        }
+    }
+
+    SDL_ResetHint(SDL_HINT_EVENT_COALESCE_MOTION);
+    SDLTest_AssertPass("Call to SDL_ResetHint(SDL_HINT_EVENT_COALESCE_MOTION)");
+
+    return TEST_COMPLETED;
+}
+
+#define LOCKFREE_PRODUCERS          4
+#define LOCKFREE_EVENTS_PER_PRODUCER 5000
+
+static SDL_atomic_t _lockFreeProducersDone;
+
+static int SDLCALL _events_lockFreeProducer(void *data)
+{
+    const int producer = (int)(intptr_t)data;
+    SDL_Event event;
+    int i;
+
+    for (i = 0; i < LOCKFREE_EVENTS_PER_PRODUCER; ++i) {
+        SDL_zero(event);
+        event.type = SDL_USEREVENT;
+        event.user.code = producer;
+        event.user.data1 = (void *)(intptr_t)i;
+        while (SDL_PushEvent(&event) != 1) {
+            /* The queue is full, wait for the consumer */
+            SDL_Delay(1);
+        }
+    }
+    SDL_AtomicAdd(&_lockFreeProducersDone, 1);
+    return 0;
+}
+
+/**
+ * @brief Pushes events from several threads with SDL_HINT_EVENT_QUEUE_LOCKFREE set while reading them.
+ *
+ * @sa http://wiki.libsdl.org/SDL_HINT_EVENT_QUEUE_LOCKFREE
+ */
+int events_lockFreeQueue(void *arg)
+{
+    int round;
+
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    /* The second round switches the ring off once the producers are done */
+    for (round = 0; round < 2; ++round) {
+        SDL_Thread *threads[LOCKFREE_PRODUCERS];
+        int next[LOCKFREE_PRODUCERS];
+        int received = 0, out_of_order = 0;
+        SDL_Event events[64];
+        Uint32 start;
+        int i, n;
+
+        SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, "1");
+        SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, \"1\")");
+
+        SDL_AtomicSet(&_lockFreeProducersDone, 0);
+        for (i = 0; i < LOCKFREE_PRODUCERS; ++i) {
+            next[i] = 0;
+            threads[i] = SDL_CreateThread(_events_lockFreeProducer, "EventProducer", (void *)(intptr_t)i);
+            SDLTest_AssertCheck(threads[i] != NULL, "Check SDL_CreateThread() succeeded");
+        }
+
+        start = SDL_GetTicks();
+        if (round == 1) {
+            /* Events still in the ring must be kept when it goes away */
+            while (SDL_AtomicGet(&_lockFreeProducersDone) < LOCKFREE_PRODUCERS &&
+                   !SDL_TICKS_PASSED(SDL_GetTicks(), start + 30000)) {
+                SDL_Delay(1);
+            }
+            SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, "0");
+            SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, \"0\")");
+        }
+        while (received < LOCKFREE_PRODUCERS * LOCKFREE_EVENTS_PER_PRODUCER &&
+               !SDL_TICKS_PASSED(SDL_GetTicks(), start + 30000)) {
+            n = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT);
+            for (i = 0; i < n; ++i) {
+                const int producer = events[i].user.code;
+                if (producer < 0 || producer >= LOCKFREE_PRODUCERS ||
+                    (int)(intptr_t)events[i].user.data1 != next[producer]) {
+                    ++out_of_order;
+                } else {
+                    ++next[producer];
+                }
+            }
+            received += SDL_max(n, 0);
+            if (n <= 0) {
+                SDL_Delay(0);
+            }
+        }
+
+        for (i = 0; i < LOCKFREE_PRODUCERS; ++i) {
+            SDL_WaitThread(threads[i], NULL);
+        }
+        SDLTest_AssertCheck(SDL_AtomicGet(&_lockFreeProducersDone) == LOCKFREE_PRODUCERS, "Check all producers finished");
+        SDLTest_AssertCheck(received == LOCKFREE_PRODUCERS * LOCKFREE_EVENTS_PER_PRODUCER,
+                            "Check events received in round %d, expected: %d, got: %d", round, LOCKFREE_PRODUCERS * LOCKFREE_EVENTS_PER_PRODUCER, received);
+        SDLTest_AssertCheck(out_of_order == 0, "Check events from each producer are in order, expected: 0 out of order, got: %d", out_of_order);
+        n = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_USEREVENT, SDL_USEREVENT);
+        SDLTest_AssertCheck(n == 0, "Check no events are left, expected: 0, got: %d", n);
+    }
+
+    SDL_ResetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE);
+    SDLTest_AssertPass("Call to SDL_ResetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE)");
+
+    return TEST_COMPLETED;
+}
+
+static int _batchedPushResult;
+static int _batchedPushCalls;
+
+static int SDLCALL _events_pushFromWatch(void *userdata, SDL_Event *event)
+{
+    if (event->type == SDL_JOYAXISMOTION) {
+        SDL_Event user;
+
+        SDL_zero(user);
+        user.type = SDL_USEREVENT;
+        user.user.code = 2;
+        _batchedPushResult = SDL_PushEvent(&user);
+        ++_batchedPushCalls;
+    }
+    return 0;
+}
+
+/**
+ * @brief Checks the result of SDL_PushEvent() for events pushed while SDL_PumpEvents() is running.
+ *
+ * @sa http://wiki.libsdl.org/SDL_PushEvent
+ * @sa http://wiki.libsdl.org/SDL_PumpEvents
+ */
+int events_pushWhilePumping(void *arg)
+{
+    SDL_Event events[1024];
+    SDL_Joystick *joystick;
+    int device_index, i, n, queued;
+
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_JOYSTICK) == 0, "SDL_InitSubSystem(SDL_INIT_JOYSTICK)");
+    device_index = SDL_JoystickAttachVirtual(SDL_JOYSTICK_TYPE_GAMECONTROLLER, 1, 0, 0);
+    SDLTest_AssertCheck(device_index >= 0, "SDL_JoystickAttachVirtual()");
+    joystick = SDL_JoystickOpen(device_index);
+    SDLTest_AssertCheck(joystick != NULL, "SDL_JoystickOpen()");
+    if (joystick == NULL) {
+        SDL_JoystickDetachVirtual(device_index);
+        SDL_QuitSubSystem(SDL_INIT_JOYSTICK);
+        return TEST_ABORTED;
+    }
+
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+    SDL_AddEventWatch(_events_pushFromWatch, NULL);
+
+    /* There's room in the queue, the event is queued */
+    _batchedPushCalls = 0;
+    _batchedPushResult = -2;
+    SDL_JoystickSetVirtualAxis(joystick, 0, 1000);
+    SDL_PumpEvents();
+    SDLTest_AssertCheck(_batchedPushCalls == 1, "Check the event watch ran, expected: 1, got: %d", _batchedPushCalls);
+    SDLTest_AssertCheck(_batchedPushResult == 1, "Check SDL_PushEvent() while pumping, expected: 1, got: %d", _batchedPushResult);
+    n = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_USEREVENT, SDL_USEREVENT);
+    SDLTest_AssertCheck(n == 1, "Check the pushed event was queued, expected: 1, got: %d", n);
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    /* The queue is full, the event is reported as dropped */
+    SDL_zeroa(events);
+    for (i = 0; i < SDL_arraysize(events); ++i) {
+        events[i].type = SDL_USEREVENT;
+    }
+    queued = 0;
+    do {
+        n = SDL_PeepEvents(events, SDL_arraysize(events), SDL_ADDEVENT, 0, 0);
+        queued += SDL_max(n, 0);
+    } while (n == SDL_arraysize(events));
+    _batchedPushCalls = 0;
+    _batchedPushResult = -2;
+    SDL_JoystickSetVirtualAxis(joystick, 0, 2000);
+    SDL_PumpEvents();
+    SDLTest_AssertCheck(_batchedPushCalls == 1, "Check the event watch ran, expected: 1, got: %d", _batchedPushCalls);
+    SDLTest_AssertCheck(_batchedPushResult == -1, "Check SDL_PushEvent() while pumping with a full queue, expected: -1, got: %d", _batchedPushResult);
+    n = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_USEREVENT, SDL_USEREVENT);
+    SDLTest_AssertCheck(n == queued, "Check nothing was added to the full queue, expected: %d, got: %d", queued, n);
+
+    SDL_DelEventWatch(_events_pushFromWatch, NULL);
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+    SDL_JoystickClose(joystick);
+    SDL_JoystickDetachVirtual(device_index);
+    SDL_QuitSubSystem(SDL_INIT_JOYSTICK);
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -189,9 +617,33 @@ static const SDLTest_TestCaseReference eventsTest3 = {
     (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest4 = {
+    (SDLTest_TestCaseFp)events_peepEventsTypeRange, "events_peepEventsTypeRange", "Filters queued events by type range with SDL_PeepEvents", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest5 = {
+    (SDLTest_TestCaseFp)events_pushEvents, "events_pushEvents", "Pushes several events at once with SDL_PushEvents", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest6 = {
+    (SDLTest_TestCaseFp)events_queueStats, "events_queueStats", "Queries event queue statistics", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest7 = {
+    (SDLTest_TestCaseFp)events_coalesceMotion, "events_coalesceMotion", "Merges queued mouse motion events", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest8 = {
+    (SDLTest_TestCaseFp)events_lockFreeQueue, "events_lockFreeQueue", "Pushes events from several threads through the lock-free ring", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest9 = {
+    (SDLTest_TestCaseFp)events_pushWhilePumping, "events_pushWhilePumping", "Checks the result of SDL_PushEvent() while events are pumped", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, &eventsTest5, &eventsTest6, &eventsTest7, &eventsTest8, &eventsTest9, NULL
 };
 
 /* Events test suite (global) */
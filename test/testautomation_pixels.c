@@ -83,7 +83,7 @@ const char *_RGBPixelFormatsVerbose[] = {
 };
 
 /* Definition of all Non-RGB formats used to test pixel conversions */
-const int _numNonRGBPixelFormats = 7;
+const int _numNonRGBPixelFormats = 9;
 Uint32 _nonRGBPixelFormats[] = {
     SDL_PIXELFORMAT_YV12,
     SDL_PIXELFORMAT_IYUV,
@@ -91,7 +91,9 @@ Uint32 _nonRGBPixelFormats[] = {
     SDL_PIXELFORMAT_UYVY,
     SDL_PIXELFORMAT_YVYU,
     SDL_PIXELFORMAT_NV12,
-    SDL_PIXELFORMAT_NV21
+    SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_P010,
+    SDL_PIXELFORMAT_P016
 };
 const char *_nonRGBPixelFormatsVerbose[] = {
     "SDL_PIXELFORMAT_YV12",
@@ -100,7 +102,9 @@ const char *_nonRGBPixelFormatsVerbose[] = {
     "SDL_PIXELFORMAT_UYVY",
     "SDL_PIXELFORMAT_YVYU",
     "SDL_PIXELFORMAT_NV12",
-    "SDL_PIXELFORMAT_NV21"
+    "SDL_PIXELFORMAT_NV21",
+    "SDL_PIXELFORMAT_P010",
+    "SDL_PIXELFORMAT_P016"
 };
 
 /* Definition of some invalid formats for negative tests */
@@ -469,6 +473,319 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * @brief Converts large YUV images with SDL_HINT_YUV_CONVERSION_THREADS set
+ *
+ * @sa http://wiki.libsdl.org/SDL_ConvertPixels
+ */
+int pixels_convertYUVThreads(void *arg)
+{
+    const Uint32 formats[] = {
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_P010
+    };
+    const int sizes[][2] = {
+        { 1280, 720 },
+        { 1281, 723 }
+    };
+    const int rgb_pitch = 1284 * 4;
+    const int yuv_pitch = 1284 * 2;
+    const size_t yuv_size = (size_t)yuv_pitch * 724 * 2;
+    const size_t rgb_size = (size_t)rgb_pitch * 724;
+    Uint8 *yuv, *single, *threaded;
+    size_t i;
+    int f, n, ret1, ret2;
+
+    yuv = (Uint8 *)SDL_malloc(yuv_size);
+    single = (Uint8 *)SDL_calloc(1, rgb_size);
+    threaded = (Uint8 *)SDL_calloc(1, rgb_size);
+    SDLTest_AssertCheck(yuv && single && threaded, "Validate that the image buffers could be allocated");
+    if (!yuv || !single || !threaded) {
+        SDL_free(yuv);
+        SDL_free(single);
+        SDL_free(threaded);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < yuv_size; i++) {
+        yuv[i] = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+    }
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        for (n = 0; n < SDL_arraysize(sizes); n++) {
+            const int w = sizes[n][0];
+            const int h = sizes[n][1];
+
+            SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS, "1");
+            ret1 = SDL_ConvertPixels(w, h, formats[f], yuv, yuv_pitch, SDL_PIXELFORMAT_ARGB8888, single, rgb_pitch);
+            SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS, "4");
+            ret2 = SDL_ConvertPixels(w, h, formats[f], yuv, yuv_pitch, SDL_PIXELFORMAT_ARGB8888, threaded, rgb_pitch);
+            SDLTest_AssertPass("Call to SDL_ConvertPixels(%d, %d, %s)", w, h, SDL_GetPixelFormatName(formats[f]));
+            SDLTest_AssertCheck(ret1 == 0 && ret2 == 0, "Verify result values; expected: 0, 0, got: %d, %d", ret1, ret2);
+            SDLTest_AssertCheck(SDL_memcmp(single, threaded, rgb_size) == 0, "Verify that both conversions have the same result");
+        }
+    }
+    SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS, NULL);
+
+    SDL_free(yuv);
+    SDL_free(single);
+    SDL_free(threaded);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Converts P010 images, and uploads them to a software texture
+ *
+ * The P010 image holds the samples of an NV12 image in its top 8 bits,
+ * so both have to convert to the same ARGB8888 pixels.
+ *
+ * @sa http://wiki.libsdl.org/SDL_ConvertPixels
+ * @sa http://wiki.libsdl.org/SDL_UpdateNVTexture
+ */
+int pixels_convertP010(void *arg)
+{
+    const int w = 37;
+    const int h = 19;
+    const int nv12_pitch = 40;
+    const int p010_pitch = 2 * nv12_pitch;
+    const int rgb_pitch = w * 4;
+    const int uv_offset = nv12_pitch * h; /* in samples, for both formats */
+    const size_t nv12_size = (size_t)nv12_pitch * (h + (h + 1) / 2);
+    Uint8 *nv12 = (Uint8 *)SDL_malloc(nv12_size);
+    Uint16 *p010 = (Uint16 *)SDL_malloc(nv12_size * sizeof(Uint16));
+    Uint32 *expected = (Uint32 *)SDL_malloc((size_t)rgb_pitch * h);
+    Uint32 *result = (Uint32 *)SDL_malloc((size_t)rgb_pitch * h);
+    SDL_Surface *surface = NULL;
+    SDL_Renderer *renderer = NULL;
+    SDL_Texture *texture = NULL;
+    int i, ret, mismatches;
+
+    SDLTest_AssertCheck(nv12 && p010 && expected && result, "Validate that the image buffers could be allocated");
+    if (!nv12 || !p010 || !expected || !result) {
+        SDL_free(nv12);
+        SDL_free(p010);
+        SDL_free(expected);
+        SDL_free(result);
+        return TEST_ABORTED;
+    }
+
+    /* Keep the colors in gamut, the 8-bit code doesn't clamp values far out of range */
+    for (i = 0; i < uv_offset; i++) {
+        nv12[i] = (Uint8)SDLTest_RandomIntegerInRange(16, 235);
+    }
+    for (i = uv_offset; i < (int)nv12_size; i++) {
+        nv12[i] = (Uint8)SDLTest_RandomIntegerInRange(80, 176);
+    }
+    for (i = 0; i < (int)nv12_size; i++) {
+        p010[i] = (Uint16)(nv12[i] << 8);
+    }
+
+    ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_NV12, nv12, nv12_pitch, SDL_PIXELFORMAT_ARGB8888, expected, rgb_pitch);
+    SDLTest_AssertCheck(ret == 0, "Verify NV12 conversion result; expected: 0, got: %d", ret);
+
+    ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_P010, p010, p010_pitch, SDL_PIXELFORMAT_ARGB8888, result, rgb_pitch);
+    SDLTest_AssertPass("Call to SDL_ConvertPixels(P010 -> ARGB8888)");
+    SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %d", ret);
+    SDLTest_AssertCheck(SDL_memcmp(expected, result, (size_t)rgb_pitch * h) == 0, "Verify that P010 and NV12 convert to the same pixels");
+
+    ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_P010, p010, p010_pitch, SDL_PIXELFORMAT_ARGB2101010, result, rgb_pitch);
+    SDLTest_AssertPass("Call to SDL_ConvertPixels(P010 -> ARGB2101010)");
+    SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %d", ret);
+    mismatches = 0;
+    for (i = 0; i < w * h; i++) {
+        const Uint32 rgb10 = result[i];
+        const Uint32 rgb8 = 0xFF000000 |
+                            (((rgb10 >> 22) & 0xFF) << 16) |
+                            (((rgb10 >> 12) & 0xFF) << 8) |
+                            ((rgb10 >> 2) & 0xFF);
+        if ((rgb10 >> 30) != 3 || rgb8 != expected[i]) {
+            ++mismatches;
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify that the top 8 bits of each channel match the ARGB8888 pixels, %d mismatches", mismatches);
+
+    /* Upload the planes separately, and draw the texture 1:1 */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Validate that the render target could be created");
+    if (surface) {
+        renderer = SDL_CreateSoftwareRenderer(surface);
+    }
+    if (renderer) {
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_P010, SDL_TEXTUREACCESS_STREAMING, w, h);
+    }
+    SDLTest_AssertCheck(texture != NULL, "Validate that a P010 texture could be created");
+    if (texture) {
+        ret = SDL_UpdateNVTexture(texture, NULL, (const Uint8 *)p010, p010_pitch, (const Uint8 *)(p010 + uv_offset), p010_pitch);
+        SDLTest_AssertPass("Call to SDL_UpdateNVTexture()");
+        SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %d", ret);
+
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+        SDL_RenderCopy(renderer, texture, NULL, NULL);
+        ret = SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_ARGB8888, result, rgb_pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify SDL_RenderReadPixels result; expected: 0, got: %d", ret);
+        SDLTest_AssertCheck(SDL_memcmp(expected, result, (size_t)rgb_pitch * h) == 0, "Verify that the P010 texture draws the NV12 pixels");
+        SDL_DestroyTexture(texture);
+    }
+    if (renderer) {
+        SDL_DestroyRenderer(renderer);
+    }
+    SDL_FreeSurface(surface);
+
+    SDL_free(nv12);
+    SDL_free(p010);
+    SDL_free(expected);
+    SDL_free(result);
+
+    return TEST_COMPLETED;
+}
+
+/* Straightforward nearest color search to check SDL_MapRGBA() against */
+static Uint8 _findPaletteColor(const SDL_Palette *palette, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    unsigned int smallest = ~0U;
+    Uint8 pixel = 0;
+    int i;
+
+    for (i = 0; i < palette->ncolors; ++i) {
+        const int rd = palette->colors[i].r - r;
+        const int gd = palette->colors[i].g - g;
+        const int bd = palette->colors[i].b - b;
+        const int ad = palette->colors[i].a - a;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            smallest = distance;
+            pixel = (Uint8)i;
+        }
+    }
+    return pixel;
+}
+
+/**
+ * @brief Maps colors to indexed formats and blits between palettes, checking the nearest color is picked
+ *
+ * @sa http://wiki.libsdl.org/SDL_MapRGBA
+ */
+int pixels_mapRGBPalette(void *arg)
+{
+    const int ncolors[] = { 256, 16, 2 };
+    SDL_Color colors[256];
+    size_t variation;
+    int i, round;
+
+    for (variation = 0; variation < SDL_arraysize(ncolors); ++variation) {
+        SDL_PixelFormat *format = SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8);
+        SDL_Palette *palette = SDL_AllocPalette(ncolors[variation]);
+        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, 64, 64, 8, SDL_PIXELFORMAT_INDEX8);
+        SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, 64, 64, 8, SDL_PIXELFORMAT_INDEX8);
+
+        SDLTest_AssertCheck(format && palette && src && dst, "Verify format, palette and surfaces are not NULL");
+        if (!format || !palette || !src || !dst) {
+            SDL_FreeFormat(format);
+            SDL_FreePalette(palette);
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            return TEST_ABORTED;
+        }
+        SDL_SetPixelFormatPalette(format, palette);
+        SDL_SetSurfacePalette(dst, palette);
+
+        /* The palette changes between rounds, lookups must follow */
+        for (round = 0; round < 2; ++round) {
+            int errors = 0;
+
+            for (i = 0; i < palette->ncolors; ++i) {
+                colors[i].r = SDLTest_RandomUint8();
+                colors[i].g = SDLTest_RandomUint8();
+                colors[i].b = SDLTest_RandomUint8();
+                /* a few translucent entries, and some duplicates so ties are checked */
+                colors[i].a = (i % 7) == 3 ? SDLTest_RandomUint8() : SDL_ALPHA_OPAQUE;
+                if (i >= 4 && (i % 5) == 0) {
+                    colors[i] = colors[i - 4];
+                }
+            }
+            SDL_SetPaletteColors(palette, colors, 0, palette->ncolors);
+
+            for (i = 0; i < 20000; ++i) {
+                const Uint8 r = SDLTest_RandomUint8();
+                const Uint8 g = SDLTest_RandomUint8();
+                const Uint8 b = SDLTest_RandomUint8();
+                const Uint8 a = (i % 8) == 0 ? SDLTest_RandomUint8() : SDL_ALPHA_OPAQUE;
+                if (SDL_MapRGBA(format, r, g, b, a) != _findPaletteColor(palette, r, g, b, a)) {
+                    ++errors;
+                }
+            }
+            for (i = 0; i < palette->ncolors; ++i) {
+                const SDL_Color *c = &palette->colors[i];
+                if (SDL_MapRGBA(format, c->r, c->g, c->b, c->a) != _findPaletteColor(palette, c->r, c->g, c->b, c->a)) {
+                    ++errors;
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify SDL_MapRGBA() with %d colors in round %d, expected: 0 errors, got: %d",
+                                palette->ncolors, round, errors);
+
+            /* Blitting between palettes maps every source color to the destination palette */
+            for (i = 0; i < 256; ++i) {
+                colors[i].r = SDLTest_RandomUint8();
+                colors[i].g = SDLTest_RandomUint8();
+                colors[i].b = SDLTest_RandomUint8();
+                colors[i].a = SDL_ALPHA_OPAQUE;
+            }
+            SDL_SetPaletteColors(src->format->palette, colors, 0, 256);
+            for (i = 0; i < src->h * src->pitch; ++i) {
+                ((Uint8 *)src->pixels)[i] = (Uint8)i;
+            }
+            SDLTest_AssertCheck(SDL_BlitSurface(src, NULL, dst, NULL) == 0, "Verify SDL_BlitSurface() succeeded");
+            errors = 0;
+            for (i = 0; i < src->h * src->pitch; ++i) {
+                const SDL_Color *c = &colors[(Uint8)i];
+                if (((Uint8 *)dst->pixels)[i] != _findPaletteColor(palette, c->r, c->g, c->b, c->a)) {
+                    ++errors;
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify INDEX8 blit with %d colors in round %d, expected: 0 errors, got: %d",
+                                palette->ncolors, round, errors);
+        }
+
+        /* Entries written directly, without SDL_SetPaletteColors(), are picked up too */
+        {
+            int errors = 0;
+
+            for (i = 0; i < palette->ncolors; ++i) {
+                palette->colors[i].r = SDLTest_RandomUint8();
+                palette->colors[i].g = SDLTest_RandomUint8();
+                palette->colors[i].b = SDLTest_RandomUint8();
+                palette->colors[i].a = SDL_ALPHA_OPAQUE;
+            }
+            for (i = 0; i < 2000; ++i) {
+                const Uint8 r = SDLTest_RandomUint8();
+                const Uint8 g = SDLTest_RandomUint8();
+                const Uint8 b = SDLTest_RandomUint8();
+                if (SDL_MapRGB(format, r, g, b) != _findPaletteColor(palette, r, g, b, SDL_ALPHA_OPAQUE)) {
+                    ++errors;
+                }
+            }
+            for (i = 0; i < palette->ncolors; ++i) {
+                const SDL_Color *c = &palette->colors[i];
+                if (SDL_MapRGB(format, c->r, c->g, c->b) != _findPaletteColor(palette, c->r, c->g, c->b, SDL_ALPHA_OPAQUE)) {
+                    ++errors;
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify SDL_MapRGB() with %d directly written colors, expected: 0 errors, got: %d",
+                                palette->ncolors, errors);
+        }
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeFormat(format);
+        SDL_FreePalette(palette);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -486,9 +803,18 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_convertYUVThreads, "pixels_convertYUVThreads", "Convert large YUV images on several threads", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest6 =
+        { (SDLTest_TestCaseFp)pixels_convertP010, "pixels_convertP010", "Convert and upload P010 images", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest7 =
+        { (SDLTest_TestCaseFp)pixels_mapRGBPalette, "pixels_mapRGBPalette", "Map colors to indexed formats and blit between palettes", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, &pixelsTest6, &pixelsTest7, NULL
 };
 
 /* Pixels test suite (global) */
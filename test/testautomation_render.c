@@ -811,6 +811,1038 @@ int render_testBlitBlend(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Draws a scene with the software renderer, for render_testSoftwareThreads.
+ */
+static void
+_drawSoftwareScene(SDL_Renderer *swrenderer)
+{
+    SDL_Surface *face;
+    SDL_Texture *texture;
+    SDL_Rect rect, viewport, cliprect;
+    SDL_FRect frect;
+    SDL_FPoint points[64];
+    SDL_Vertex verts[3 * 16];
+    int i;
+
+    /* A texture with a gradient and varying alpha. */
+    face = SDL_CreateRGBSurfaceWithFormat(0, 97, 61, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (face == NULL) {
+        return;
+    }
+    for (i = 0; i < face->w * face->h; i++) {
+        ((Uint32 *)face->pixels)[i] = ((Uint32)(i * 7) << 24) | (Uint32)(i * 2654435761u >> 8);
+    }
+    texture = SDL_CreateTextureFromSurface(swrenderer, face);
+    SDL_FreeSurface(face);
+
+    SDL_SetRenderDrawColor(swrenderer, 10, 20, 30, 255);
+    SDL_RenderClear(swrenderer);
+
+    /* Rectangles, some crossing tiles and the edge of the target. */
+    for (i = 0; i < 40; i++) {
+        rect.x = (i * 53) % 700 - 40;
+        rect.y = (i * 37) % 500 - 30;
+        rect.w = 20 + (i * 31) % 300;
+        rect.h = 10 + (i * 17) % 200;
+        SDL_SetRenderDrawBlendMode(swrenderer, (i & 1) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(swrenderer, i * 5, 255 - i * 3, i * 11, 96 + i);
+        SDL_RenderFillRect(swrenderer, &rect);
+    }
+
+    /* Copies with color, alpha and blend modes, then lines and scaled copies in between. */
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    for (i = 0; i < 30; i++) {
+        rect.x = (i * 71) % 680 - 50;
+        rect.y = (i * 43) % 480 - 20;
+        rect.w = 97;
+        rect.h = 61;
+        SDL_SetTextureColorMod(texture, 255 - i * 4, 128 + i, i * 8);
+        SDL_SetTextureAlphaMod(texture, 255 - i * 2);
+        SDL_SetTextureBlendMode(texture, (i % 3) == 0 ? SDL_BLENDMODE_ADD : SDL_BLENDMODE_BLEND);
+        SDL_RenderCopy(swrenderer, texture, NULL, &rect);
+        if ((i % 10) == 9) {
+            SDL_SetRenderDrawColor(swrenderer, 255, 255, 0, 255);
+            SDL_RenderDrawLine(swrenderer, 0, i * 10, 639, 479 - i * 10);
+            rect.w = 150;
+            rect.h = 40;
+            SDL_RenderCopy(swrenderer, texture, NULL, &rect);
+        }
+    }
+
+    /* Clipped and offset by a viewport. */
+    viewport.x = 100;
+    viewport.y = 70;
+    viewport.w = 400;
+    viewport.h = 300;
+    SDL_RenderSetViewport(swrenderer, &viewport);
+    cliprect.x = 30;
+    cliprect.y = 20;
+    cliprect.w = 300;
+    cliprect.h = 250;
+    SDL_RenderSetClipRect(swrenderer, &cliprect);
+
+    for (i = 0; i < (int)SDL_arraysize(points); i++) {
+        points[i].x = (float)((i * 29) % 420) - 10.0f;
+        points[i].y = (float)((i * 13) % 320) - 10.0f;
+    }
+    SDL_SetRenderDrawBlendMode(swrenderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(swrenderer, 255, 0, 255, 255);
+    SDL_RenderDrawPointsF(swrenderer, points, SDL_arraysize(points));
+
+    for (i = 0; i < (int)SDL_arraysize(verts); i++) {
+        verts[i].position.x = (float)((i * 67) % 450) - 20.0f + 0.5f * (i & 1);
+        verts[i].position.y = (float)((i * 41) % 330) - 15.0f;
+        verts[i].color.r = (Uint8)(i * 19);
+        verts[i].color.g = (Uint8)(255 - i * 5);
+        verts[i].color.b = (Uint8)(i * 3);
+        verts[i].color.a = (Uint8)(128 + i);
+        verts[i].tex_coord.x = 0.0f;
+        verts[i].tex_coord.y = 0.0f;
+    }
+    SDL_RenderGeometry(swrenderer, NULL, verts, SDL_arraysize(verts) / 2, NULL, 0);
+    SDL_SetRenderDrawBlendMode(swrenderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(swrenderer, NULL, verts + SDL_arraysize(verts) / 2, SDL_arraysize(verts) / 2, NULL, 0);
+
+    SDL_SetTextureColorMod(texture, 255, 255, 255);
+    SDL_SetTextureAlphaMod(texture, 200);
+    frect.x = 250.5f;
+    frect.y = 180.0f;
+    frect.w = 97.0f;
+    frect.h = 61.0f;
+    SDL_RenderCopyF(swrenderer, texture, NULL, &frect);
+
+    SDL_RenderFlush(swrenderer);
+    SDL_DestroyTexture(texture);
+}
+
+/**
+ * @brief Tests that the software renderer draws the same with several threads as with one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_CreateSoftwareRenderer
+ */
+int render_testSoftwareThreads(void *arg)
+{
+    SDL_Surface *serial, *threaded;
+    SDL_Renderer *swrenderer;
+    int y, mismatched = 0;
+
+    serial = SDL_CreateRGBSurfaceWithFormat(0, 640, 480, 32, SDL_PIXELFORMAT_ARGB8888);
+    threaded = SDL_CreateRGBSurfaceWithFormat(0, 640, 480, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(serial != NULL && threaded != NULL, "Validate result from SDL_CreateRGBSurfaceWithFormat");
+    if (serial == NULL || threaded == NULL) {
+        SDL_FreeSurface(serial);
+        SDL_FreeSurface(threaded);
+        return TEST_ABORTED;
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "1");
+    swrenderer = SDL_CreateSoftwareRenderer(serial);
+    SDLTest_AssertCheck(swrenderer != NULL, "Validate result from SDL_CreateSoftwareRenderer with 1 thread");
+    if (swrenderer != NULL) {
+        _drawSoftwareScene(swrenderer);
+        SDL_DestroyRenderer(swrenderer);
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "4");
+    swrenderer = SDL_CreateSoftwareRenderer(threaded);
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, NULL);
+    SDLTest_AssertCheck(swrenderer != NULL, "Validate result from SDL_CreateSoftwareRenderer with 4 threads");
+    if (swrenderer != NULL) {
+        _drawSoftwareScene(swrenderer);
+        SDL_DestroyRenderer(swrenderer);
+    }
+
+    for (y = 0; y < serial->h; y++) {
+        if (SDL_memcmp((Uint8 *)serial->pixels + y * serial->pitch, (Uint8 *)threaded->pixels + y * threaded->pitch, serial->w * 4) != 0) {
+            mismatched++;
+        }
+    }
+    SDLTest_AssertCheck(mismatched == 0, "Validate that drawing with 4 threads matches 1 thread, %d rows differ", mismatched);
+
+    SDL_FreeSurface(serial);
+    SDL_FreeSurface(threaded);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws colored, textured and blended triangles, for render_testGeometrySpans.
+ *
+ * With blend_colors, only one set of colored triangles with SDL_BLENDMODE_BLEND is drawn.
+ */
+static void
+_drawGeometryScene(SDL_Renderer *swrenderer, SDL_bool blend_colors)
+{
+    static const SDL_BlendMode blendmodes[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD
+    };
+    SDL_Surface *face;
+    SDL_Texture *texture;
+    SDL_Vertex verts[3 * 8];
+    int i, j;
+
+    /* A texture with a gradient and varying alpha. */
+    face = SDL_CreateRGBSurfaceWithFormat(0, 61, 47, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (face == NULL) {
+        return;
+    }
+    for (i = 0; i < face->w * face->h; i++) {
+        ((Uint32 *)face->pixels)[i] = ((Uint32)(i * 5) << 24) | (Uint32)(i * 2654435761u >> 8);
+    }
+    texture = SDL_CreateTextureFromSurface(swrenderer, face);
+    SDL_FreeSurface(face);
+
+    SDL_SetRenderDrawColor(swrenderer, 40, 90, 160, 255);
+    SDL_RenderClear(swrenderer);
+
+    for (j = blend_colors ? 1 : 0; j < (blend_colors ? 2 : 6); j++) {
+        for (i = 0; i < (int)SDL_arraysize(verts); i++) {
+            verts[i].position.x = (float)((i * 67 + j * 29) % 300) - 20.0f + 0.25f * (i & 3);
+            verts[i].position.y = (float)((i * 41 + j * 53) % 220) - 15.0f;
+            if (j == 0) {
+                /* Uniform color */
+                verts[i].color.r = 200;
+                verts[i].color.g = 30;
+                verts[i].color.b = 120;
+                verts[i].color.a = 255;
+            } else {
+                verts[i].color.r = (Uint8)(i * 19 + j);
+                verts[i].color.g = (Uint8)(255 - i * 5);
+                verts[i].color.b = (Uint8)(i * 3 + j * 40);
+                verts[i].color.a = (Uint8)(90 + i * 7);
+            }
+            verts[i].tex_coord.x = (float)((i * 7) % 11) / 10.0f;
+            verts[i].tex_coord.y = (float)((i * 5) % 13) / 12.0f;
+        }
+
+        /* Colored triangles */
+        SDL_SetRenderDrawBlendMode(swrenderer, blend_colors ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+        SDL_RenderGeometry(swrenderer, NULL, verts, SDL_arraysize(verts) / 2, NULL, 0);
+
+        /* Textured triangles, with color and alpha modulation */
+        if (texture && !blend_colors) {
+            SDL_SetTextureBlendMode(texture, blendmodes[j % SDL_arraysize(blendmodes)]);
+            SDL_SetTextureAlphaMod(texture, (Uint8)(255 - j * 30));
+            SDL_RenderGeometry(swrenderer, texture, verts + SDL_arraysize(verts) / 2, SDL_arraysize(verts) / 2, NULL, 0);
+        }
+    }
+
+    SDL_RenderFlush(swrenderer);
+    SDL_DestroyTexture(texture);
+}
+
+/**
+ * @brief Tests that triangles draw the same on 32 bits targets, which have span and SIMD fast paths, as on 24 bits targets, which don't.
+ *
+ * Blended colored triangles are blended onto the target by the surface blitters,
+ * which may round differently for 24 bits targets, so they are allowed to be
+ * off by up to 3 per channel. Everything else has to match exactly.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderGeometry
+ */
+int render_testGeometrySpans(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24
+    };
+    SDL_Surface *surfaces[SDL_arraysize(formats)];
+    SDL_Renderer *swrenderer;
+    int pass, i, ret;
+
+    for (pass = 0; pass < 2; pass++) {
+        const SDL_bool blend_colors = (pass == 1);
+        const int allowable_error = blend_colors ? 3 * 3 * 3 : 0;
+
+        for (i = 0; i < (int)SDL_arraysize(formats); i++) {
+            SDL_Surface *target = SDL_CreateRGBSurfaceWithFormat(0, 256, 192, 32, formats[i]);
+            SDLTest_AssertCheck(target != NULL, "Validate result from SDL_CreateRGBSurfaceWithFormat(%s)", SDL_GetPixelFormatName(formats[i]));
+            surfaces[i] = NULL;
+            if (target == NULL) {
+                continue;
+            }
+            swrenderer = SDL_CreateSoftwareRenderer(target);
+            SDLTest_AssertCheck(swrenderer != NULL, "Validate result from SDL_CreateSoftwareRenderer");
+            if (swrenderer != NULL) {
+                _drawGeometryScene(swrenderer, blend_colors);
+                SDL_DestroyRenderer(swrenderer);
+            }
+            surfaces[i] = SDL_ConvertSurfaceFormat(target, formats[0], 0);
+            SDL_FreeSurface(target);
+        }
+
+        for (i = 1; i < (int)SDL_arraysize(formats); i++) {
+            if (surfaces[0] != NULL && surfaces[i] != NULL) {
+                ret = SDLTest_CompareSurfaces(surfaces[i], surfaces[0], allowable_error);
+                SDLTest_AssertCheck(ret == 0, "Validate that %s triangles drawn on %s match %s, expected: 0, got: %i",
+                                    blend_colors ? "blended" : "opaque and textured",
+                                    SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[0]), ret);
+            }
+        }
+
+        for (i = 0; i < (int)SDL_arraysize(formats); i++) {
+            SDL_FreeSurface(surfaces[i]);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+static int _programsSaved;
+static int _programsLoaded;
+static char _programFiles[16][1024];
+static int _numProgramFiles;
+
+static void SDLCALL _programCacheLog(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+    const char *file = NULL;
+    int i;
+
+    if (SDL_strncmp(message, "Saved program binary ", 21) == 0) {
+        ++_programsSaved;
+        file = message + 21;
+    } else if (SDL_strncmp(message, "Loaded program binary ", 22) == 0) {
+        ++_programsLoaded;
+        file = message + 22;
+    }
+    if (file == NULL) {
+        return;
+    }
+    for (i = 0; i < _numProgramFiles; i++) {
+        if (SDL_strcmp(_programFiles[i], file) == 0) {
+            return;
+        }
+    }
+    if (_numProgramFiles < (int)SDL_arraysize(_programFiles)) {
+        SDL_strlcpy(_programFiles[_numProgramFiles++], file, sizeof(_programFiles[0]));
+    }
+}
+
+static void
+_removeProgramFiles(void)
+{
+    int i;
+
+    for (i = 0; i < _numProgramFiles; i++) {
+        remove(_programFiles[i]);
+    }
+    _numProgramFiles = 0;
+}
+
+/**
+ * @brief Creates an OpenGL ES 2 renderer and draws with it, for render_testGLES2ProgramCache.
+ *
+ * Returns 0 if the renderer couldn't be created.
+ */
+static int
+_drawWithGLES2(int driver)
+{
+    SDL_Window *cachewindow;
+    SDL_Renderer *cacherenderer;
+    SDL_Texture *texture;
+    SDL_Rect rect = { 8, 8, 32, 32 };
+
+    cachewindow = SDL_CreateWindow("render_testGLES2ProgramCache", 100, 100, 64, 64, SDL_WINDOW_HIDDEN);
+    if (cachewindow == NULL) {
+        return 0;
+    }
+    cacherenderer = SDL_CreateRenderer(cachewindow, driver, 0);
+    if (cacherenderer == NULL) {
+        SDL_DestroyWindow(cachewindow);
+        return 0;
+    }
+
+    texture = SDL_CreateTexture(cacherenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 16, 16);
+    SDL_SetRenderDrawColor(cacherenderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(cacherenderer);
+    SDL_RenderFillRect(cacherenderer, &rect);
+    if (texture) {
+        SDL_RenderCopy(cacherenderer, texture, NULL, &rect);
+    }
+    SDL_RenderPresent(cacherenderer);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(cacherenderer);
+    SDL_DestroyWindow(cachewindow);
+    return 1;
+}
+
+/**
+ * @brief Tests that the OpenGL ES 2 renderer saves its programs to the cache directory and loads them next time.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_OPENGLES2_PROGRAM_CACHE
+ */
+int render_testGLES2ProgramCache(void *arg)
+{
+    SDL_LogOutputFunction original_function;
+    void *original_userdata;
+    SDL_LogPriority original_priority;
+    SDL_RendererInfo info;
+    SDL_RWops *rw;
+    char *path;
+    int driver = -1, i, created;
+
+    for (i = 0; i < SDL_GetNumRenderDrivers(); i++) {
+        if (SDL_GetRenderDriverInfo(i, &info) == 0 && SDL_strcmp(info.name, "opengles2") == 0) {
+            driver = i;
+        }
+    }
+    if (driver < 0) {
+        SDLTest_Log("The opengles2 renderer isn't available, skipping");
+        return TEST_SKIPPED;
+    }
+
+    path = SDL_GetPrefPath("libsdl", "testautomation_gles2_programs");
+    SDLTest_AssertCheck(path != NULL, "Validate result from SDL_GetPrefPath");
+    if (path == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_SetHint(SDL_HINT_RENDER_OPENGLES2_PROGRAM_CACHE, path);
+
+    SDL_LogGetOutputFunction(&original_function, &original_userdata);
+    original_priority = SDL_LogGetPriority(SDL_LOG_CATEGORY_RENDER);
+    SDL_LogSetOutputFunction(_programCacheLog, NULL);
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_RENDER, SDL_LOG_PRIORITY_DEBUG);
+
+    /* The first renderer compiles its programs and saves them */
+    _numProgramFiles = 0;
+    _programsSaved = _programsLoaded = 0;
+    created = _drawWithGLES2(driver);
+    if (created && _programsLoaded > 0) {
+        /* Left over from an earlier run, start from an empty cache */
+        _removeProgramFiles();
+        _programsSaved = _programsLoaded = 0;
+        created = _drawWithGLES2(driver);
+    }
+    SDL_LogSetOutputFunction(original_function, original_userdata);
+    if (!created || _programsSaved == 0) {
+        /* No OpenGL ES 2 context here, or no GL_OES_get_program_binary */
+        SDL_LogSetPriority(SDL_LOG_CATEGORY_RENDER, original_priority);
+        SDL_ResetHint(SDL_HINT_RENDER_OPENGLES2_PROGRAM_CACHE);
+        SDL_free(path);
+        SDLTest_Log("The opengles2 renderer can't cache programs here, skipping");
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertCheck(_programsLoaded == 0, "Validate that no programs were loaded from an empty cache, got: %d", _programsLoaded);
+    for (i = 0; i < _numProgramFiles; i++) {
+        rw = SDL_RWFromFile(_programFiles[i], "rb");
+        SDLTest_AssertCheck(rw != NULL, "Validate that %s was created", _programFiles[i]);
+        if (rw != NULL) {
+            SDLTest_AssertCheck(SDL_RWsize(rw) > 0, "Validate that %s isn't empty", _programFiles[i]);
+            SDL_RWclose(rw);
+        }
+    }
+
+    /* The second one loads them instead */
+    SDL_LogSetOutputFunction(_programCacheLog, NULL);
+    _programsSaved = _programsLoaded = 0;
+    created = _drawWithGLES2(driver);
+    SDL_LogSetOutputFunction(original_function, original_userdata);
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_RENDER, original_priority);
+    SDL_ResetHint(SDL_HINT_RENDER_OPENGLES2_PROGRAM_CACHE);
+    SDLTest_AssertCheck(created, "Validate that the second renderer was created");
+    SDLTest_AssertCheck(_programsLoaded > 0, "Validate that programs were loaded from the cache, got: %d", _programsLoaded);
+    SDLTest_AssertCheck(_programsSaved == 0, "Validate that no programs were compiled and saved again, got: %d", _programsSaved);
+
+    _removeProgramFiles();
+    SDL_free(path);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws many small draws with redundant state changes, for render_testBatchedDraws.
+ */
+static void
+_drawBatchScene(SDL_Texture *texture, SDL_bool flush)
+{
+    SDL_Rect viewport;
+    SDL_FPoint points[4];
+    SDL_Vertex verts[6];
+    SDL_FRect frect;
+    int i, j;
+
+    SDL_RenderSetViewport(renderer, NULL);
+    SDL_RenderSetClipRect(renderer, NULL);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+
+    for (i = 0; i < 48; i++) {
+        /* Viewport and color changes that are undone before the next draw */
+        viewport.x = (i % 3) * 8;
+        viewport.y = (i % 5) * 4;
+        viewport.w = 200;
+        viewport.h = 150;
+        if (i & 1) {
+            SDL_Rect other = viewport;
+            other.x += 50;
+            SDL_RenderSetViewport(renderer, &other);
+        }
+        SDL_RenderSetViewport(renderer, &viewport);
+        SDL_SetRenderDrawColor(renderer, 255, 255, 255, SDL_ALPHA_OPAQUE);
+        SDL_SetRenderDrawColor(renderer, (Uint8)(i * 5), (Uint8)(255 - i * 5), (Uint8)(i * 3), SDL_ALPHA_OPAQUE);
+
+        /* Consecutive textured quads, like sprites */
+        for (j = 0; j < 3; j++) {
+            frect.x = (float)((i * 37 + j * 53) % 180);
+            frect.y = (float)((i * 23 + j * 31) % 130);
+            frect.w = 24.0f;
+            frect.h = 18.0f;
+            SDL_RenderCopyF(renderer, texture, NULL, &frect);
+            if (flush) {
+                SDL_RenderFlush(renderer);
+            }
+        }
+
+        /* Consecutive untextured triangles */
+        for (j = 0; j < 6; j++) {
+            verts[j].position.x = (float)((i * 41 + j * 29) % 200);
+            verts[j].position.y = (float)((i * 17 + j * 43) % 150);
+            verts[j].color.r = (Uint8)(j * 40);
+            verts[j].color.g = (Uint8)(i * 5);
+            verts[j].color.b = (Uint8)(255 - j * 40);
+            verts[j].color.a = SDL_ALPHA_OPAQUE;
+            verts[j].tex_coord.x = 0.0f;
+            verts[j].tex_coord.y = 0.0f;
+        }
+        SDL_RenderGeometry(renderer, NULL, verts, 3, NULL, 0);
+        if (flush) {
+            SDL_RenderFlush(renderer);
+        }
+        SDL_RenderGeometry(renderer, NULL, verts + 3, 3, NULL, 0);
+        if (flush) {
+            SDL_RenderFlush(renderer);
+        }
+
+        /* Points with the same color */
+        for (j = 0; j < 4; j++) {
+            points[j].x = (float)((i * 13 + j * 7) % 200);
+            points[j].y = (float)((i * 11 + j * 19) % 150);
+        }
+        SDL_RenderDrawPointsF(renderer, points, 2);
+        if (flush) {
+            SDL_RenderFlush(renderer);
+        }
+        SDL_RenderDrawPointsF(renderer, points + 2, 2);
+        if (flush) {
+            SDL_RenderFlush(renderer);
+        }
+    }
+    SDL_RenderSetViewport(renderer, NULL);
+    SDL_RenderFlush(renderer);
+}
+
+/**
+ * @brief Tests that batched draws, with their state changes optimized, match draws flushed one at a time.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderFlush
+ */
+int render_testBatchedDraws(void *arg)
+{
+    SDL_Texture *texture;
+    SDL_Surface *flushed, *batched;
+    int w, h, ret;
+
+    texture = _loadTestFace();
+    SDLTest_AssertCheck(texture != NULL, "Verify _loadTestFace() result");
+    if (texture == NULL) {
+        return TEST_ABORTED;
+    }
+
+    ret = SDL_GetRendererOutputSize(renderer, &w, &h);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererOutputSize, expected: 0, got: %i", ret);
+    flushed = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, RENDER_COMPARE_FORMAT);
+    batched = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(flushed != NULL && batched != NULL, "Validate result from SDL_CreateRGBSurfaceWithFormat");
+    if (flushed == NULL || batched == NULL) {
+        SDL_FreeSurface(flushed);
+        SDL_FreeSurface(batched);
+        SDL_DestroyTexture(texture);
+        return TEST_ABORTED;
+    }
+
+    _drawBatchScene(texture, SDL_TRUE);
+    ret = SDL_RenderReadPixels(renderer, NULL, RENDER_COMPARE_FORMAT, flushed->pixels, flushed->pitch);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+    _drawBatchScene(texture, SDL_FALSE);
+    ret = SDL_RenderReadPixels(renderer, NULL, RENDER_COMPARE_FORMAT, batched->pixels, batched->pitch);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+    ret = SDLTest_CompareSurfaces(batched, flushed, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate that batched draws match flushed draws, expected: 0, got: %i", ret);
+
+    SDL_FreeSurface(flushed);
+    SDL_FreeSurface(batched);
+    SDL_DestroyTexture(texture);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that the statistics of a presented frame count what was drawn.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderGetStats
+ */
+int render_testGetStats(void *arg)
+{
+    SDL_RendererInfo info;
+    SDL_RenderStats stats;
+    SDL_Texture *texture;
+    SDL_Rect rect = { 4, 4, 16, 16 };
+    Uint32 pixels[16 * 16];
+    Uint32 frames;
+    int ret;
+
+    ret = SDL_RenderGetStats(renderer, NULL);
+    SDLTest_AssertCheck(ret < 0, "Validate result from SDL_RenderGetStats(renderer, NULL), expected: <0, got: %i", ret);
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 16, 16);
+    SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+    if (texture == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Start from a fresh frame */
+    SDL_RenderPresent(renderer);
+    ret = SDL_RenderGetStats(renderer, &stats);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+    frames = stats.frames_presented;
+
+    SDL_memset(pixels, 0xFF, sizeof(pixels));
+    ret = SDL_UpdateTexture(texture, NULL, pixels, 16 * 4);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+    ret = SDL_SetRenderDrawColor(renderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawColor, expected: 0, got: %i", ret);
+    ret = SDL_RenderFillRect(renderer, &rect);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+    rect.x += 20;
+    ret = SDL_RenderCopy(renderer, texture, NULL, &rect);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+    SDL_RenderPresent(renderer);
+
+    ret = SDL_RenderGetStats(renderer, &stats);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(stats.frames_presented == frames + 1, "Validate frames_presented, expected: %u, got: %u", (unsigned int)(frames + 1), (unsigned int)stats.frames_presented);
+    SDLTest_AssertCheck(stats.vertex_bytes > 0, "Validate vertex_bytes, expected: >0, got: %" SDL_PRIu64, stats.vertex_bytes);
+    SDLTest_AssertCheck(stats.texture_upload_bytes == sizeof(pixels), "Validate texture_upload_bytes, expected: %u, got: %" SDL_PRIu64, (unsigned int)sizeof(pixels), stats.texture_upload_bytes);
+
+    ret = SDL_GetRendererInfo(renderer, &info);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererInfo, expected: 0, got: %i", ret);
+    if (ret == 0 && (SDL_strcmp(info.name, "software") == 0 || SDL_strcmp(info.name, "PSP") == 0)) {
+        /* These renderers have their own rect and copy commands */
+        SDLTest_AssertCheck(stats.rect_commands == 1, "Validate rect_commands, expected: 1, got: %u", (unsigned int)stats.rect_commands);
+        SDLTest_AssertCheck(stats.copy_commands == 1, "Validate copy_commands, expected: 1, got: %u", (unsigned int)stats.copy_commands);
+        SDLTest_AssertCheck(stats.geometry_commands == 0, "Validate geometry_commands, expected: 0, got: %u", (unsigned int)stats.geometry_commands);
+    } else {
+        /* The others queue rects and copies as geometry */
+        SDLTest_AssertCheck(stats.rect_commands == 0, "Validate rect_commands, expected: 0, got: %u", (unsigned int)stats.rect_commands);
+        SDLTest_AssertCheck(stats.copy_commands == 0, "Validate copy_commands, expected: 0, got: %u", (unsigned int)stats.copy_commands);
+        SDLTest_AssertCheck(stats.geometry_commands == 2, "Validate geometry_commands, expected: 2, got: %u", (unsigned int)stats.geometry_commands);
+    }
+    if (ret == 0 && SDL_strcmp(info.name, "software") == 0) {
+        SDLTest_AssertCheck(stats.draw_calls == 2, "Validate draw_calls, expected: 2, got: %u", (unsigned int)stats.draw_calls);
+    }
+
+    /* An empty frame has nothing to count */
+    SDL_RenderPresent(renderer);
+    ret = SDL_RenderGetStats(renderer, &stats);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(stats.rect_commands == 0 && stats.copy_commands == 0 && stats.geometry_commands == 0 &&
+                        stats.draw_calls == 0 && stats.vertex_bytes == 0,
+                        "Validate that an empty frame has no draws");
+
+    SDL_DestroyTexture(texture);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Returns what reached the display of a window, in RENDER_COMPARE_FORMAT.
+ *
+ * The dummy video driver keeps a screen surface that only receives the
+ * rects pushed by SDL_UpdateWindowSurfaceRects(). Other drivers don't, so
+ * the window surface is used there.
+ */
+static SDL_Surface *
+_getPresentedWindow(SDL_Window *win)
+{
+    SDL_Surface *screen = (SDL_Surface *)SDL_GetWindowData(win, "_SDL_DummyScreen");
+    SDL_Surface *presented;
+
+    if (screen == NULL) {
+        screen = SDL_GetWindowSurface(win);
+        SDLTest_AssertCheck(screen != NULL, "Verify SDL_GetWindowSurface() result");
+        if (screen == NULL) {
+            return NULL;
+        }
+    }
+    presented = SDL_ConvertSurfaceFormat(screen, RENDER_COMPARE_FORMAT, 0);
+    SDLTest_AssertCheck(presented != NULL, "Verify SDL_ConvertSurfaceFormat() result");
+    return presented;
+}
+
+/**
+ * @brief Creates a hidden window with a software renderer, for the present tests.
+ */
+static SDL_Renderer *
+_createSoftwareWindowRenderer(const char *title, int w, int h, SDL_Window **win)
+{
+    SDL_RendererInfo info;
+    SDL_Renderer *swrenderer = NULL;
+    int i;
+
+    *win = SDL_CreateWindow(title, 100, 100, w, h, SDL_WINDOW_HIDDEN);
+    SDLTest_AssertCheck(*win != NULL, "Verify SDL_CreateWindow() result");
+    if (*win == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < SDL_GetNumRenderDrivers(); i++) {
+        if (SDL_GetRenderDriverInfo(i, &info) == 0 && SDL_strcmp(info.name, "software") == 0) {
+            swrenderer = SDL_CreateRenderer(*win, i, 0);
+            break;
+        }
+    }
+    SDLTest_AssertCheck(swrenderer != NULL, "Verify the software renderer was created");
+    if (swrenderer == NULL) {
+        SDL_DestroyWindow(*win);
+        *win = NULL;
+    }
+    return swrenderer;
+}
+
+/**
+ * @brief Tests that the software renderer presents every part of its window it drew to.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderPresent
+ */
+int render_testPresentDirtyRects(void *arg)
+{
+    const SDL_Rect viewport = { 8, 4, 80, 52 };
+    const SDL_Rect rects[] = { { 2, 2, 6, 4 }, { 60, 40, 10, 6 } };
+    const SDL_Rect copy_rect = { 30, 10, 8, 8 };
+    const SDL_Vertex triangle[] = {
+        { { 10.0f, 30.0f }, { 0, 255, 0, 255 }, { 0.0f, 0.0f } },
+        { { 30.0f, 48.0f }, { 0, 255, 0, 255 }, { 0.0f, 0.0f } },
+        { { 4.0f, 50.0f }, { 0, 255, 0, 255 }, { 0.0f, 0.0f } },
+    };
+    SDL_Window *swwindow;
+    SDL_Renderer *swrenderer;
+    SDL_Texture *texture;
+    SDL_Surface *drawn, *presented;
+    Uint32 pixels[8 * 8];
+    int i, ret;
+
+    swrenderer = _createSoftwareWindowRenderer("render_testPresentDirtyRects", 96, 64, &swwindow);
+    if (swrenderer == NULL) {
+        return TEST_ABORTED;
+    }
+    texture = SDL_CreateTexture(swrenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+    SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+    if (texture == NULL) {
+        SDL_DestroyRenderer(swrenderer);
+        SDL_DestroyWindow(swwindow);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < (int)SDL_arraysize(pixels); i++) {
+        pixels[i] = 0xFF0000FF;
+    }
+    SDL_UpdateTexture(texture, NULL, pixels, 8 * sizeof(Uint32));
+
+    /* Present a cleared frame first, so the next one only presents what it draws */
+    SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(swrenderer);
+    SDL_RenderPresent(swrenderer);
+
+    /* Draw one of each command, inside a viewport */
+    ret = SDL_RenderSetViewport(swrenderer, &viewport);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderSetViewport, expected: 0, got: %i", ret);
+    SDL_SetRenderDrawColor(swrenderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+    ret = SDL_RenderFillRects(swrenderer, rects, SDL_arraysize(rects));
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRects, expected: 0, got: %i", ret);
+    SDL_SetRenderDrawColor(swrenderer, 255, 255, 0, SDL_ALPHA_OPAQUE);
+    ret = SDL_RenderDrawLine(swrenderer, 40, 2, 70, 20);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderDrawLine, expected: 0, got: %i", ret);
+    ret = SDL_RenderDrawPoint(swrenderer, 75, 50);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderDrawPoint, expected: 0, got: %i", ret);
+    ret = SDL_RenderCopy(swrenderer, texture, NULL, &copy_rect);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+    ret = SDL_RenderGeometry(swrenderer, NULL, triangle, SDL_arraysize(triangle), NULL, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGeometry, expected: 0, got: %i", ret);
+    SDL_RenderPresent(swrenderer);
+
+    /* Everything drawn to the window surface has to have reached the display */
+    drawn = SDL_ConvertSurfaceFormat(SDL_GetWindowSurface(swwindow), RENDER_COMPARE_FORMAT, 0);
+    SDLTest_AssertCheck(drawn != NULL, "Verify the window surface was converted");
+    presented = _getPresentedWindow(swwindow);
+    if (drawn != NULL && presented != NULL) {
+        ret = SDLTest_CompareSurfaces(presented, drawn, ALLOWABLE_ERROR_OPAQUE);
+        SDLTest_AssertCheck(ret == 0, "Validate the presented window, expected: 0, got: %i", ret);
+    }
+    SDL_FreeSurface(presented);
+
+    /* An empty frame leaves the display as it is */
+    SDL_RenderPresent(swrenderer);
+    presented = _getPresentedWindow(swwindow);
+    if (drawn != NULL && presented != NULL) {
+        ret = SDLTest_CompareSurfaces(presented, drawn, ALLOWABLE_ERROR_OPAQUE);
+        SDLTest_AssertCheck(ret == 0, "Validate the window after an empty frame, expected: 0, got: %i", ret);
+    }
+    SDL_FreeSurface(presented);
+    SDL_FreeSurface(drawn);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(swrenderer);
+    SDL_DestroyWindow(swwindow);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that the software renderer presents everything a scaled frame drew to its window.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderPresent
+ */
+int render_testPresentScaledCopyEx(void *arg)
+{
+    const SDL_Rect red_rect = { 4, 4, 8, 8 };
+    const SDL_Rect blue_rect = { 30, 4, 8, 8 };
+    SDL_Window *swwindow;
+    SDL_Renderer *swrenderer;
+    SDL_Texture *red, *blue;
+    SDL_Surface *presented, *reference;
+    int i, ret;
+
+    swrenderer = _createSoftwareWindowRenderer("render_testPresentScaledCopyEx", 96, 64, &swwindow);
+    if (swrenderer == NULL) {
+        return TEST_ABORTED;
+    }
+
+    red = SDL_CreateTexture(swrenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+    blue = SDL_CreateTexture(swrenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+    SDLTest_AssertCheck(red != NULL && blue != NULL, "Verify SDL_CreateTexture() results");
+    reference = SDL_CreateRGBSurface(SDL_SWSURFACE, 96, 64, 32,
+                                     RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+    SDLTest_AssertCheck(reference != NULL, "Verify SDL_CreateRGBSurface() result");
+    if (red == NULL || blue == NULL || reference == NULL) {
+        SDL_FreeSurface(reference);
+        SDL_DestroyRenderer(swrenderer);
+        SDL_DestroyWindow(swwindow);
+        return TEST_ABORTED;
+    }
+    SDL_SetTextureBlendMode(red, SDL_BLENDMODE_NONE);
+    SDL_SetTextureBlendMode(blue, SDL_BLENDMODE_NONE);
+
+    /* Present a cleared frame first, so the next one only presents what it draws */
+    SDL_FillRect(reference, NULL, SDL_MapRGB(reference->format, 255, 0, 0));
+    SDL_UpdateTexture(red, NULL, reference->pixels, reference->pitch);
+    SDL_FillRect(reference, NULL, SDL_MapRGB(reference->format, 0, 0, 255));
+    SDL_UpdateTexture(blue, NULL, reference->pixels, reference->pitch);
+    SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(swrenderer);
+    SDL_RenderPresent(swrenderer);
+
+    /* The flip turns the first copy into a COPY_EX command, which the renderer scales itself */
+    ret = SDL_RenderSetScale(swrenderer, 2.0f, 2.0f);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderSetScale, expected: 0, got: %i", ret);
+    ret = SDL_RenderCopyEx(swrenderer, red, NULL, &red_rect, 0.0, NULL, SDL_FLIP_HORIZONTAL);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+    ret = SDL_RenderCopy(swrenderer, blue, NULL, &blue_rect);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+    SDL_RenderPresent(swrenderer);
+
+    SDL_FillRect(reference, NULL, SDL_MapRGB(reference->format, 0, 0, 0));
+    for (i = 0; i < 2; i++) {
+        const SDL_Rect *rect = (i == 0) ? &red_rect : &blue_rect;
+        SDL_Rect scaled;
+
+        scaled.x = rect->x * 2;
+        scaled.y = rect->y * 2;
+        scaled.w = rect->w * 2;
+        scaled.h = rect->h * 2;
+        SDL_FillRect(reference, &scaled, (i == 0) ? SDL_MapRGB(reference->format, 255, 0, 0) : SDL_MapRGB(reference->format, 0, 0, 255));
+    }
+
+    presented = _getPresentedWindow(swwindow);
+    if (presented != NULL) {
+        ret = SDLTest_CompareSurfaces(presented, reference, ALLOWABLE_ERROR_OPAQUE);
+        SDLTest_AssertCheck(ret == 0, "Validate the presented window, expected: 0, got: %i", ret);
+        SDL_FreeSurface(presented);
+    }
+
+    SDL_FreeSurface(reference);
+    SDL_DestroyTexture(red);
+    SDL_DestroyTexture(blue);
+    SDL_DestroyRenderer(swrenderer);
+    SDL_DestroyWindow(swwindow);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Creates the textures for render_testTextureAtlas, with or without the texture atlas.
+ */
+static void
+_createAtlasTextures(SDL_Texture **textures, int count, SDL_bool atlas)
+{
+    SDL_Surface *surface;
+    int i, x, y;
+
+    SDL_SetHint(SDL_HINT_RENDER_TEXTURE_ATLAS, atlas ? "1" : "0");
+    for (i = 0; i < count; ++i) {
+        if (i == 0) {
+            surface = SDLTest_ImageFace();
+        } else {
+            /* Small gradients with uneven sizes and some transparency */
+            surface = SDL_CreateRGBSurfaceWithFormat(0, 3 + i * 5, 2 + i * 3, 32, SDL_PIXELFORMAT_ARGB8888);
+            if (surface) {
+                for (y = 0; y < surface->h; ++y) {
+                    Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+                    for (x = 0; x < surface->w; ++x) {
+                        row[x] = SDL_MapRGBA(surface->format, (Uint8)(x * 23 + i * 40), (Uint8)(y * 37), (Uint8)(i * 60), (Uint8)(255 - x * 3));
+                    }
+                }
+            }
+        }
+        SDLTest_AssertCheck(surface != NULL, "Verify test surface %d is not NULL", i);
+        textures[i] = surface ? SDL_CreateTextureFromSurface(renderer, surface) : NULL;
+        SDLTest_AssertCheck(textures[i] != NULL, "Verify SDL_CreateTextureFromSurface() result for texture %d", i);
+        SDL_FreeSurface(surface);
+    }
+    SDL_SetHint(SDL_HINT_RENDER_TEXTURE_ATLAS, NULL);
+}
+
+/**
+ * @brief Draws every texture with copies, rotated copies and geometry, for render_testTextureAtlas.
+ */
+static void
+_drawAtlasScene(SDL_Texture **textures, int count)
+{
+    const int indices[6] = { 0, 1, 2, 0, 2, 3 };
+    SDL_Vertex verts[4];
+    SDL_Rect srcrect;
+    SDL_FRect dstrect;
+    int i, w, h;
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+    for (i = 0; i < count; ++i) {
+        SDL_Texture *texture = textures[i];
+        if (!texture) {
+            continue;
+        }
+        SDL_QueryTexture(texture, NULL, NULL, &w, &h);
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+        dstrect.x = (float)(i * 36);
+        dstrect.y = 0.0f;
+        dstrect.w = (float)w;
+        dstrect.h = (float)h;
+        SDL_RenderCopyF(renderer, texture, NULL, &dstrect);
+
+        /* Part of the texture, scaled up */
+        srcrect.x = w / 4;
+        srcrect.y = h / 4;
+        srcrect.w = w / 2 + 1;
+        srcrect.h = h / 2 + 1;
+        dstrect.y = 40.0f;
+        dstrect.w = (float)(srcrect.w * 3);
+        dstrect.h = (float)(srcrect.h * 3);
+        SDL_SetTextureColorMod(texture, 255, 128, 64);
+        SDL_RenderCopyF(renderer, texture, &srcrect, &dstrect);
+        SDL_SetTextureColorMod(texture, 255, 255, 255);
+
+        dstrect.y = 80.0f;
+        dstrect.w = (float)w;
+        dstrect.h = (float)h;
+        SDL_RenderCopyExF(renderer, texture, NULL, &dstrect, 0.0, NULL, SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL);
+
+        /* The whole texture as two triangles */
+        SDL_zeroa(verts);
+        verts[0].position.x = dstrect.x;
+        verts[0].position.y = 120.0f;
+        verts[1].position.x = dstrect.x + 2 * w;
+        verts[1].position.y = 120.0f;
+        verts[1].tex_coord.x = 1.0f;
+        verts[2].position.x = dstrect.x + 2 * w;
+        verts[2].position.y = 120.0f + 2 * h;
+        verts[2].tex_coord.x = 1.0f;
+        verts[2].tex_coord.y = 1.0f;
+        verts[3].position.x = dstrect.x;
+        verts[3].position.y = 120.0f + 2 * h;
+        verts[3].tex_coord.y = 1.0f;
+        verts[0].color.r = verts[1].color.r = verts[2].color.r = verts[3].color.r = 255;
+        verts[0].color.g = verts[1].color.g = verts[2].color.g = verts[3].color.g = 255;
+        verts[0].color.b = verts[1].color.b = verts[2].color.b = verts[3].color.b = 255;
+        verts[0].color.a = verts[1].color.a = verts[2].color.a = verts[3].color.a = 255;
+        SDL_RenderGeometry(renderer, texture, verts, 4, indices, 6);
+    }
+}
+
+/**
+ * @brief Tests that textures packed into a texture atlas draw like textures with their own storage.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_TEXTURE_ATLAS
+ */
+int render_testTextureAtlas(void *arg)
+{
+    SDL_Texture *textures[5];
+    SDL_Surface *separate, *atlas;
+    Uint8 *pixels;
+    int i, w, h, ret;
+
+    ret = SDL_GetRendererOutputSize(renderer, &w, &h);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererOutputSize, expected: 0, got: %i", ret);
+    separate = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, RENDER_COMPARE_FORMAT);
+    atlas = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(separate != NULL && atlas != NULL, "Validate result from SDL_CreateRGBSurfaceWithFormat");
+    if (separate == NULL || atlas == NULL) {
+        SDL_FreeSurface(separate);
+        SDL_FreeSurface(atlas);
+        return TEST_ABORTED;
+    }
+
+    _createAtlasTextures(textures, SDL_arraysize(textures), SDL_FALSE);
+    _drawAtlasScene(textures, SDL_arraysize(textures));
+    ret = SDL_RenderReadPixels(renderer, NULL, RENDER_COMPARE_FORMAT, separate->pixels, separate->pitch);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        SDL_DestroyTexture(textures[i]);
+    }
+
+    _createAtlasTextures(textures, SDL_arraysize(textures), SDL_TRUE);
+    _drawAtlasScene(textures, SDL_arraysize(textures));
+    ret = SDL_RenderReadPixels(renderer, NULL, RENDER_COMPARE_FORMAT, atlas->pixels, atlas->pitch);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+    /* Packed textures can still be updated */
+    pixels = (Uint8 *)SDL_calloc(1, 32 * 32 * 4);
+    if (pixels) {
+        ret = SDL_UpdateTexture(textures[1], NULL, pixels, 32 * 4);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+        SDL_free(pixels);
+    }
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        SDL_DestroyTexture(textures[i]);
+    }
+
+    ret = SDLTest_CompareSurfaces(atlas, separate, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate that packed textures draw like separate textures, expected: 0, got: %i", ret);
+
+    SDL_FreeSurface(separate);
+    SDL_FreeSurface(atlas);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1161,9 +2193,41 @@ static const SDLTest_TestCaseReference renderTest7 = {
     (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED
 };
 
+static const SDLTest_TestCaseReference renderTest8 = {
+    (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests that the software renderer draws the same with several threads", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest9 = {
+    (SDLTest_TestCaseFp)render_testBatchedDraws, "render_testBatchedDraws", "Tests that batched draws match draws flushed one at a time", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest10 = {
+    (SDLTest_TestCaseFp)render_testGetStats, "render_testGetStats", "Tests the statistics of a presented frame", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest11 = {
+    (SDLTest_TestCaseFp)render_testTextureAtlas, "render_testTextureAtlas", "Tests that textures in a texture atlas draw like separate textures", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest12 = {
+    (SDLTest_TestCaseFp)render_testGeometrySpans, "render_testGeometrySpans", "Tests that triangles draw the same with and without the span fast paths", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest13 = {
+    (SDLTest_TestCaseFp)render_testGLES2ProgramCache, "render_testGLES2ProgramCache", "Tests that the OpenGL ES 2 renderer saves and reloads its programs", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest14 = {
+    (SDLTest_TestCaseFp)render_testPresentScaledCopyEx, "render_testPresentScaledCopyEx", "Tests that the software renderer presents a scaled, flipped copy", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest15 = {
+    (SDLTest_TestCaseFp)render_testPresentDirtyRects, "render_testPresentDirtyRects", "Tests that the software renderer presents everything it drew", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, &renderTest11, &renderTest12, &renderTest13, &renderTest14, &renderTest15, NULL
 };
 
 /* Render test suite (global) */
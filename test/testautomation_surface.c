@@ -594,6 +594,570 @@ int surface_testBlitBlendLoop(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Helper that computes the result of a modulated, blended blit of one pixel
+ */
+static void _blendReferencePixel(SDL_BlendMode mode, const Uint8 *mod, Uint8 *s, Uint8 *d)
+{
+    int i, result;
+
+    for (i = 0; i < 4; ++i) {
+        s[i] = (Uint8)((s[i] * mod[i]) / 255);
+    }
+    if (mode == SDL_BLENDMODE_BLEND || mode == SDL_BLENDMODE_ADD) {
+        for (i = 0; i < 3; ++i) {
+            s[i] = (Uint8)((s[i] * s[3]) / 255);
+        }
+    }
+    for (i = 0; i < 4; ++i) {
+        switch (mode) {
+        case SDL_BLENDMODE_NONE:
+            result = s[i];
+            break;
+        case SDL_BLENDMODE_BLEND:
+            result = s[i] + ((255 - s[3]) * d[i]) / 255;
+            break;
+        case SDL_BLENDMODE_ADD:
+            result = (i == 3) ? d[i] : SDL_min(s[i] + d[i], 255);
+            break;
+        case SDL_BLENDMODE_MOD:
+            result = (i == 3) ? d[i] : (s[i] * d[i]) / 255;
+            break;
+        default:
+            result = (i == 3) ? d[i] : SDL_min((s[i] * d[i] + d[i] * (255 - s[3])) / 255, 255);
+            break;
+        }
+        d[i] = (Uint8)result;
+    }
+}
+
+/**
+ * @brief Tests modulated and blended blits between 32-bit formats against a per pixel reference
+ */
+int surface_testBlitModulateBlend8888(void *arg)
+{
+    const Uint32 src_formats[] = {
+        SDL_PIXELFORMAT_RGB888,
+        SDL_PIXELFORMAT_BGR888,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_ABGR8888,
+        SDL_PIXELFORMAT_BGRA8888,
+    };
+    const Uint32 dst_formats[] = {
+        SDL_PIXELFORMAT_RGB888,
+        SDL_PIXELFORMAT_BGR888,
+        SDL_PIXELFORMAT_ARGB8888,
+    };
+    const SDL_BlendMode modes[] = {
+        SDL_BLENDMODE_NONE,
+        SDL_BLENDMODE_BLEND,
+        SDL_BLENDMODE_ADD,
+        SDL_BLENDMODE_MOD,
+        SDL_BLENDMODE_MUL,
+    };
+    /* An odd width so the vectorized blitters have leftover pixels */
+    const int w = 37, h = 5;
+    size_t i, j, m;
+    int x, y, k, modulate, scale, allowable_error, mismatches = 0;
+
+    for (i = 0; i < SDL_arraysize(src_formats); ++i) {
+        for (j = 0; j < SDL_arraysize(dst_formats); ++j) {
+            for (m = 0; m < SDL_arraysize(modes); ++m) {
+                for (modulate = 0; modulate <= 1; ++modulate) {
+                    /* The scaled pass stretches the source to twice its width */
+                    for (scale = 0; scale <= 1; ++scale) {
+                        const int dst_w = scale ? 2 * w : w;
+                        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, src_formats[i]);
+                        SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, dst_w, h, 32, dst_formats[j]);
+                        SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, dst_w, h, 32, dst_formats[j]);
+                        Uint8 mod[4];
+                        int ret;
+
+                        SDLTest_AssertCheck(src && dst && expected, "Verify surfaces are not NULL");
+                        if (!src || !dst || !expected) {
+                            SDL_FreeSurface(src);
+                            SDL_FreeSurface(dst);
+                            SDL_FreeSurface(expected);
+                            return TEST_ABORTED;
+                        }
+                        for (y = 0; y < h; ++y) {
+                            Uint32 *srcrow = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+                            Uint32 *dstrow = (Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch);
+                            for (x = 0; x < w; ++x) {
+                                /* Mix in fully transparent and fully opaque pixels */
+                                srcrow[x] = (Uint32)SDLTest_RandomUint32();
+                                if ((x % 5) == 1) {
+                                    srcrow[x] |= src->format->Amask;
+                                } else if ((x % 5) == 2) {
+                                    srcrow[x] &= ~src->format->Amask;
+                                }
+                            }
+                            for (x = 0; x < dst_w; ++x) {
+                                dstrow[x] = SDL_MapRGBA(dst->format, SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8());
+                            }
+                        }
+                        /* Without modulation the blit only has the blend and scale flags */
+                        for (k = 0; k < 4; ++k) {
+                            mod[k] = modulate ? SDLTest_RandomUint8() : 255;
+                        }
+                        SDL_SetSurfaceColorMod(src, mod[0], mod[1], mod[2]);
+                        SDL_SetSurfaceAlphaMod(src, mod[3]);
+                        SDL_SetSurfaceBlendMode(src, modes[m]);
+                        SDL_SetSurfaceBlendMode(dst, SDL_BLENDMODE_NONE);
+
+                        /* Compute the expected result before blitting over the destination */
+                        for (y = 0; y < h; ++y) {
+                            const Uint32 *srcrow = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+                            const Uint32 *dstrow = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+                            Uint32 *expectedrow = (Uint32 *)((Uint8 *)expected->pixels + y * expected->pitch);
+                            for (x = 0; x < dst_w; ++x) {
+                                Uint8 s[4], d[4];
+                                SDL_GetRGBA(srcrow[scale ? x / 2 : x], src->format, &s[0], &s[1], &s[2], &s[3]);
+                                SDL_GetRGBA(dstrow[x], dst->format, &d[0], &d[1], &d[2], &d[3]);
+                                _blendReferencePixel(modes[m], mod, s, d);
+                                expectedrow[x] = SDL_MapRGBA(expected->format, d[0], d[1], d[2], d[3]);
+                            }
+                        }
+
+                        if (scale) {
+                            ret = SDL_BlitScaled(src, NULL, dst, NULL);
+                            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitScaled, expected: 0, got: %i", ret);
+                        } else {
+                            ret = SDL_BlitSurface(src, NULL, dst, NULL);
+                            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+                        }
+                        /* Plain alpha blending goes through the blitters in SDL_blit_A.c instead,
+                           and those round to within two of the reference in each channel */
+                        allowable_error = (modes[m] == SDL_BLENDMODE_BLEND && !modulate && !scale) ? 3 * 2 * 2 : 0;
+                        ret = SDLTest_CompareSurfaces(dst, expected, allowable_error);
+                        if (ret != 0) {
+                            SDLTest_LogError("%s -> %s with blend mode %d, %s, %s differs in %d pixels",
+                                             SDL_GetPixelFormatName(src_formats[i]), SDL_GetPixelFormatName(dst_formats[j]), modes[m],
+                                             modulate ? "modulated" : "not modulated", scale ? "scaled" : "not scaled", ret);
+                            ++mismatches;
+                        }
+
+                        SDL_FreeSurface(src);
+                        SDL_FreeSurface(dst);
+                        SDL_FreeSurface(expected);
+                    }
+                }
+            }
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify modulated blits match the reference, expected: 0 mismatches, got: %i", mismatches);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Helper that sets up a surface with random pixels and a random palette
+ */
+static SDL_Surface *_createRandomSurface(int w, int h, Uint32 format)
+{
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, format);
+    int i;
+
+    if (!surface) {
+        return NULL;
+    }
+    if (surface->format->palette) {
+        SDL_Color colors[256];
+        for (i = 0; i < SDL_arraysize(colors); ++i) {
+            colors[i].r = SDLTest_RandomUint8();
+            colors[i].g = SDLTest_RandomUint8();
+            colors[i].b = SDLTest_RandomUint8();
+            colors[i].a = SDLTest_RandomUint8();
+        }
+        SDL_SetPaletteColors(surface->format->palette, colors, 0, surface->format->palette->ncolors);
+    }
+    for (i = 0; i < surface->pitch * h; ++i) {
+        ((Uint8 *)surface->pixels)[i] = SDLTest_RandomUint8();
+    }
+    return surface;
+}
+
+/**
+ * Helper that sets up a copy of a surface to compare blits against
+ */
+static SDL_Surface *_createReferenceSurface(SDL_Surface *src)
+{
+    SDL_Surface *ref = SDL_DuplicateSurface(src);
+    SDL_BlendMode mode;
+    Uint8 r, g, b, a;
+    Uint32 key;
+
+    if (!ref) {
+        return NULL;
+    }
+    SDL_GetSurfaceBlendMode(src, &mode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    SDL_SetSurfaceBlendMode(ref, mode);
+    SDL_SetSurfaceColorMod(ref, r, g, b);
+    SDL_SetSurfaceAlphaMod(ref, a);
+    if (SDL_GetColorKey(src, &key) == 0) {
+        SDL_SetColorKey(ref, SDL_TRUE, key);
+    }
+    return ref;
+}
+
+/**
+ * Helper that checks a blit against the same blit done from a reference surface
+ */
+static int _checkBlitAgainstReference(SDL_Surface *src, SDL_Surface *ref, SDL_Surface *dst)
+{
+    SDL_Surface *expected = SDL_DuplicateSurface(dst);
+    int ret;
+
+    SDLTest_AssertCheck(expected != NULL, "Verify SDL_DuplicateSurface() succeeded");
+    if (!expected) {
+        return -1;
+    }
+
+    ret = SDL_BlitSurface(ref, NULL, expected, NULL);
+    ret |= SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+    if (ret == 0) {
+        ret = SDLTest_CompareSurfaces(dst, expected, 0);
+    }
+
+    SDL_FreeSurface(expected);
+    return ret;
+}
+
+/**
+ * @brief Tests blitting one surface to several destinations in turn
+ */
+int surface_testBlitMultipleDestinations(void *arg)
+{
+    const Uint32 src_formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_INDEX8 };
+    const Uint32 dst_formats[] = {
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_ABGR8888,
+        SDL_PIXELFORMAT_RGB888,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_INDEX8,
+        SDL_PIXELFORMAT_RGB24,
+    };
+    SDL_Surface *dst[SDL_arraysize(dst_formats)];
+    SDL_Surface *ref;
+    size_t i, j;
+    int round, ret;
+
+    for (i = 0; i < SDL_arraysize(src_formats); ++i) {
+        SDL_Surface *src = _createRandomSurface(19, 7, src_formats[i]);
+        SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+        if (!src) {
+            return TEST_ABORTED;
+        }
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+        ref = _createReferenceSurface(src);
+        SDLTest_AssertCheck(ref != NULL, "Verify reference surface is not NULL");
+
+        for (j = 0; j < SDL_arraysize(dst_formats); ++j) {
+            dst[j] = _createRandomSurface(23, 11, dst_formats[j]);
+            SDLTest_AssertCheck(dst[j] != NULL, "Verify destination surface is not NULL");
+        }
+
+        /* Switch back and forth between more destinations than are cached */
+        for (round = 0; round < 3; ++round) {
+            for (j = 0; j < 2 * SDL_arraysize(dst_formats); ++j) {
+                const size_t k = (j & 1) ? (j / 2) : 0;
+                if (!ref || !dst[k]) {
+                    continue;
+                }
+                ret = _checkBlitAgainstReference(src, ref, dst[k]);
+                SDLTest_AssertCheck(ret == 0, "Verify blit %s -> %s in round %d, expected: 0, got: %i",
+                                    SDL_GetPixelFormatName(src_formats[i]), SDL_GetPixelFormatName(dst_formats[k]), round, ret);
+            }
+
+            if (round == 0 && ref && dst[4]) {
+                /* Change the destination palette, the cached mapping to it has to be recalculated */
+                SDL_Color colors[256];
+
+                for (j = 0; j < SDL_arraysize(colors); ++j) {
+                    colors[j].r = colors[j].g = colors[j].b = (Uint8)(255 - j);
+                    colors[j].a = 255;
+                }
+                SDL_SetPaletteColors(dst[4]->format->palette, colors, 0, SDL_arraysize(colors));
+                ret = _checkBlitAgainstReference(src, ref, dst[4]);
+                SDLTest_AssertCheck(ret == 0, "Verify blit %s -> %s after changing its palette, expected: 0, got: %i",
+                                    SDL_GetPixelFormatName(src_formats[i]), SDL_GetPixelFormatName(dst_formats[4]), ret);
+            } else if (round == 1) {
+                /* Replace a destination, the new one is likely to reuse its memory */
+                SDL_FreeSurface(dst[1]);
+                dst[1] = _createRandomSurface(23, 11, dst_formats[1]);
+            }
+        }
+
+        /* Cached mappings are kept per blit flags, so after setting a color key
+           every destination has to be mapped again instead of reusing one */
+        SDL_SetColorKey(src, SDL_TRUE, src->format->palette ? 1 : SDL_MapRGB(src->format, 0, 0, 0));
+        SDL_FreeSurface(ref);
+        ref = _createReferenceSurface(src);
+        for (j = 0; j < SDL_arraysize(dst_formats); ++j) {
+            if (ref && dst[j]) {
+                ret = _checkBlitAgainstReference(src, ref, dst[j]);
+                SDLTest_AssertCheck(ret == 0, "Verify blit %s -> %s after setting a color key, expected: 0, got: %i",
+                                    SDL_GetPixelFormatName(src_formats[i]), SDL_GetPixelFormatName(dst_formats[j]), ret);
+            }
+        }
+
+        SDL_FreeSurface(ref);
+        SDL_FreeSurface(src);
+        for (j = 0; j < SDL_arraysize(dst_formats); ++j) {
+            SDL_FreeSurface(dst[j]);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests large blits and stretches with SDL_HINT_BLIT_THREADS set
+ */
+int surface_testBlitThreads(void *arg)
+{
+    const struct
+    {
+        Uint32 src_format;
+        Uint32 dst_format;
+        SDL_BlendMode mode;
+        int scale; /* 0 for a blit, 1 for SDL_SoftStretch(), 2 for SDL_SoftStretchLinear() */
+    } cases[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_BLEND, 0 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB24, SDL_BLENDMODE_NONE, 0 },
+        { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 0 },
+        { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_RGB24, SDL_BLENDMODE_NONE, 1 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 2 },
+    };
+    size_t i;
+    int ret1, ret2;
+
+    for (i = 0; i < SDL_arraysize(cases); ++i) {
+        SDL_Surface *src = _createRandomSurface(cases[i].scale ? 401 : 643, cases[i].scale ? 299 : 481, cases[i].src_format);
+        SDL_Surface *single = _createRandomSurface(643, 481, cases[i].dst_format);
+        SDL_Surface *threaded = single ? SDL_DuplicateSurface(single) : NULL;
+
+        SDLTest_AssertCheck(src && single && threaded, "Verify surfaces are not NULL");
+        if (!src || !single || !threaded) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(single);
+            SDL_FreeSurface(threaded);
+            return TEST_ABORTED;
+        }
+        SDL_SetSurfaceBlendMode(src, cases[i].mode);
+
+        SDL_SetHint(SDL_HINT_BLIT_THREADS, "1");
+        if (cases[i].scale == 1) {
+            ret1 = SDL_SoftStretch(src, NULL, single, NULL);
+        } else if (cases[i].scale == 2) {
+            ret1 = SDL_SoftStretchLinear(src, NULL, single, NULL);
+        } else {
+            ret1 = SDL_BlitSurface(src, NULL, single, NULL);
+        }
+        SDL_SetHint(SDL_HINT_BLIT_THREADS, "4");
+        if (cases[i].scale == 1) {
+            ret2 = SDL_SoftStretch(src, NULL, threaded, NULL);
+        } else if (cases[i].scale == 2) {
+            ret2 = SDL_SoftStretchLinear(src, NULL, threaded, NULL);
+        } else {
+            ret2 = SDL_BlitSurface(src, NULL, threaded, NULL);
+        }
+        SDLTest_AssertCheck(ret1 == 0 && ret2 == 0, "Verify result values; expected: 0, 0, got: %d, %d", ret1, ret2);
+        if (ret1 == 0 && ret2 == 0) {
+            ret1 = SDLTest_CompareSurfaces(threaded, single, 0);
+            SDLTest_AssertCheck(ret1 == 0, "Verify %s -> %s has the same result on several threads, expected: 0, got: %i",
+                                SDL_GetPixelFormatName(cases[i].src_format), SDL_GetPixelFormatName(cases[i].dst_format), ret1);
+        }
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(single);
+        SDL_FreeSurface(threaded);
+    }
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_PremultiplyAlpha() and SDL_UnpremultiplyAlpha() against the rounded formulas
+ */
+int surface_testPremultiplyAlpha(void *arg)
+{
+    const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    /* Every color value against every alpha value, with an odd width for the leftover pixels */
+    const int w = 259, h = 256;
+    size_t i, j;
+    int x, y, ret;
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[i]);
+            SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[j]);
+            SDL_Surface *inv = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[j]);
+            int errors = 0;
+
+            SDLTest_AssertCheck(src && dst && inv, "Verify surfaces are not NULL");
+            if (!src || !dst || !inv) {
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                SDL_FreeSurface(inv);
+                return TEST_ABORTED;
+            }
+
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] =
+                        SDL_MapRGBA(src->format, (Uint8)x, (Uint8)(255 - x), (Uint8)(x ^ 0x5A), (Uint8)y);
+                }
+            }
+
+            ret = SDL_PremultiplyAlpha(w, h, formats[i], src->pixels, src->pitch, formats[j], dst->pixels, dst->pitch);
+            SDLTest_AssertCheck(ret == 0, "Verify SDL_PremultiplyAlpha(%s -> %s) result, expected: 0, got: %i",
+                                SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), ret);
+            ret = SDL_UnpremultiplyAlpha(w, h, formats[j], dst->pixels, dst->pitch, formats[j], inv->pixels, inv->pitch);
+            SDLTest_AssertCheck(ret == 0, "Verify SDL_UnpremultiplyAlpha(%s) result, expected: 0, got: %i",
+                                SDL_GetPixelFormatName(formats[j]), ret);
+
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    const Uint8 c[3] = { (Uint8)x, (Uint8)(255 - x), (Uint8)(x ^ 0x5A) };
+                    Uint8 p[4], u[4];
+                    int k;
+
+                    SDL_GetRGBA(((Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch))[x], dst->format, &p[0], &p[1], &p[2], &p[3]);
+                    SDL_GetRGBA(((Uint32 *)((Uint8 *)inv->pixels + y * inv->pitch))[x], inv->format, &u[0], &u[1], &u[2], &u[3]);
+                    if (p[3] != y || u[3] != y) {
+                        ++errors;
+                    }
+                    for (k = 0; k < 3; ++k) {
+                        const int premultiplied = (c[k] * y + 127) / 255;
+                        const int unpremultiplied = y ? SDL_min(255, (premultiplied * 255 + y / 2) / y) : 0;
+                        if (p[k] != premultiplied || u[k] != unpremultiplied) {
+                            ++errors;
+                        }
+                    }
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify %s -> %s pixels, expected: 0 errors, got: %i",
+                                SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), errors);
+
+            /* In place gives the same result */
+            ret = SDL_PremultiplyAlpha(w, h, formats[i], src->pixels, src->pitch, formats[j], src->pixels, src->pitch);
+            SDLTest_AssertCheck(ret == 0, "Verify in place SDL_PremultiplyAlpha() result, expected: 0, got: %i", ret);
+            if (formats[i] == formats[j]) {
+                ret = SDLTest_CompareSurfaces(src, dst, 0);
+                SDLTest_AssertCheck(ret == 0, "Verify in place SDL_PremultiplyAlpha(%s), expected: 0, got: %i",
+                                    SDL_GetPixelFormatName(formats[i]), ret);
+            }
+
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(inv);
+        }
+    }
+
+    ret = SDL_PremultiplyAlpha(1, 1, SDL_PIXELFORMAT_RGB888, &x, 4, SDL_PIXELFORMAT_ARGB8888, &y, 4);
+    SDLTest_AssertCheck(ret < 0, "Verify SDL_PremultiplyAlpha() fails for formats without alpha, got: %i", ret);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests blits with SDL_BLENDMODE_BLEND_PREMULTIPLIED against the rounded formula
+ */
+int surface_testBlitBlendPremultiplied(void *arg)
+{
+    const SDL_BlendMode mode = SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+                                                          SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+    const struct
+    {
+        Uint32 src_format;
+        Uint32 dst_format;
+    } cases[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGBA8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB565 },
+    };
+    const int w = 67, h = 33;
+    SDL_BlendMode got;
+    size_t i;
+    int x, y, ret;
+
+    for (i = 0; i < SDL_arraysize(cases); ++i) {
+        SDL_Surface *src = _createRandomSurface(w, h, cases[i].src_format);
+        SDL_Surface *dst = _createRandomSurface(w, h, cases[i].dst_format);
+        SDL_Surface *orig = dst ? SDL_DuplicateSurface(dst) : NULL;
+        int errors = 0;
+
+        SDLTest_AssertCheck(src && dst && orig, "Verify surfaces are not NULL");
+        if (!src || !dst || !orig) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(orig);
+            return TEST_ABORTED;
+        }
+
+        /* Mostly premultiplied pixels, but a few that overflow, are opaque or transparent */
+        SDL_PremultiplyAlpha(w - 4, h, src->format->format, src->pixels, src->pitch, src->format->format, src->pixels, src->pitch);
+        for (y = 0; y < h; ++y) {
+            Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+            row[0] = SDL_MapRGBA(src->format, SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8(), 0xFF);
+            row[1] = SDL_MapRGBA(src->format, 0, 0, 0, 0);
+        }
+
+        ret = SDL_SetSurfaceBlendMode(src, mode);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetSurfaceBlendMode(), expected: 0, got: %i", ret);
+        SDL_GetSurfaceBlendMode(src, &got);
+        SDLTest_AssertCheck(got == mode, "Verify SDL_GetSurfaceBlendMode(), expected: %#x, got: %#x", (unsigned int)mode, (unsigned int)got);
+
+        ret = SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface(), expected: 0, got: %i", ret);
+
+        for (y = 0; y < h; ++y) {
+            for (x = 0; x < w; ++x) {
+                const Uint8 *s = (const Uint8 *)src->pixels + y * src->pitch + x * src->format->BytesPerPixel;
+                const Uint8 *d = (const Uint8 *)orig->pixels + y * orig->pitch + x * orig->format->BytesPerPixel;
+                const Uint8 *r = (const Uint8 *)dst->pixels + y * dst->pitch + x * dst->format->BytesPerPixel;
+                Uint32 sp, dp, rp;
+                Uint8 sc[4], dc[4];
+                int k;
+
+                SDL_memcpy(&sp, s, sizeof(sp));
+                if (dst->format->BytesPerPixel == 2) {
+                    dp = *(const Uint16 *)d;
+                    rp = *(const Uint16 *)r;
+                } else {
+                    SDL_memcpy(&dp, d, sizeof(dp));
+                    SDL_memcpy(&rp, r, sizeof(rp));
+                }
+                SDL_GetRGBA(sp, src->format, &sc[0], &sc[1], &sc[2], &sc[3]);
+                SDL_GetRGBA(dp, dst->format, &dc[0], &dc[1], &dc[2], &dc[3]);
+                for (k = 0; k < 4; ++k) {
+                    dc[k] = (Uint8)SDL_min(255, sc[k] + (dc[k] * (255 - sc[3]) + 127) / 255);
+                }
+                if (rp != SDL_MapRGBA(dst->format, dc[0], dc[1], dc[2], dc[3])) {
+                    ++errors;
+                }
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Verify %s -> %s pixels, expected: 0 errors, got: %i",
+                            SDL_GetPixelFormatName(cases[i].src_format), SDL_GetPixelFormatName(cases[i].dst_format), errors);
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(orig);
+    }
+
+    return TEST_COMPLETED;
+}
+
 int surface_testOverflow(void *arg)
 {
     char buf[1024];
@@ -852,6 +1416,26 @@ static const SDLTest_TestCaseReference surfaceTest12 = {
     (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTest13 = {
+    (SDLTest_TestCaseFp)surface_testBlitModulateBlend8888, "surface_testBlitModulateBlend8888", "Tests modulated and blended blits between 32-bit formats.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest14 = {
+    (SDLTest_TestCaseFp)surface_testBlitMultipleDestinations, "surface_testBlitMultipleDestinations", "Tests blitting a surface to several destinations in turn.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest15 = {
+    (SDLTest_TestCaseFp)surface_testBlitThreads, "surface_testBlitThreads", "Tests large blits and stretches on several threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest16 = {
+    (SDLTest_TestCaseFp)surface_testPremultiplyAlpha, "surface_testPremultiplyAlpha", "Tests premultiplying and unpremultiplying alpha.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest17 = {
+    (SDLTest_TestCaseFp)surface_testBlitBlendPremultiplied, "surface_testBlitBlendPremultiplied", "Tests blits with premultiplied alpha blending.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestOverflow = {
     surface_testOverflow, "surface_testOverflow", "Test overflow detection.", TEST_ENABLED
 };
@@ -860,7 +1444,8 @@ static const SDLTest_TestCaseReference surfaceTestOverflow = {
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14, &surfaceTest15,
+    &surfaceTest16, &surfaceTest17, &surfaceTestOverflow, NULL
 };
 
 /* Surface test suite (global) */
@@ -38,7 +38,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
 
         /* R, G, B in alternating horizontal bands */
         for (y = 0; y < pattern->h; y += thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && (y + i) < pattern->h; ++i) {
                 p = (Uint8 *)pattern->pixels + (y + i) * pattern->pitch + ((y / thickness) % 3);
                 for (x = 0; x < pattern->w; ++x) {
                     *p = 0xFF;
@@ -50,7 +50,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
         /* Black and white in alternating vertical bands */
         c = 0xFF;
         for (x = 1 * thickness; x < pattern->w; x += 2 * thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && (x + i) < pattern->w; ++i) {
                 p = (Uint8 *)pattern->pixels + (x + i) * 3;
                 for (y = 0; y < pattern->h; ++y) {
                     SDL_memset(p, c, 3);
@@ -107,6 +107,90 @@ static SDL_bool verify_yuv_data(Uint32 format, const Uint8 *yuv, int yuv_pitch,
     return result;
 }
 
+/* Copy the columns [x, x + w) of a YUV image into a separate image of width w, x must be even */
+static void copy_yuv_columns(Uint32 format, const Uint8 *src, int src_pitch, int h, int x, int w, Uint8 *dst, int dst_pitch)
+{
+    int y, plane;
+
+    if (is_packed_yuv_format(format)) {
+        for (y = 0; y < h; ++y) {
+            SDL_memcpy(dst + y * dst_pitch, src + y * src_pitch + x * 2, ((w + 1) / 2) * 4);
+        }
+        return;
+    }
+
+    for (y = 0; y < h; ++y) {
+        SDL_memcpy(dst + y * dst_pitch, src + y * src_pitch + x, w);
+    }
+    src += h * src_pitch;
+    dst += h * dst_pitch;
+
+    if (format == SDL_PIXELFORMAT_NV12 || format == SDL_PIXELFORMAT_NV21) {
+        const int src_uv_pitch = 2 * ((src_pitch + 1) / 2);
+        const int dst_uv_pitch = 2 * ((dst_pitch + 1) / 2);
+        for (y = 0; y < (h + 1) / 2; ++y) {
+            SDL_memcpy(dst + y * dst_uv_pitch, src + y * src_uv_pitch + x, ((w + 1) / 2) * 2);
+        }
+    } else {
+        const int src_uv_pitch = (src_pitch + 1) / 2;
+        const int dst_uv_pitch = (dst_pitch + 1) / 2;
+        for (plane = 0; plane < 2; ++plane) {
+            for (y = 0; y < (h + 1) / 2; ++y) {
+                SDL_memcpy(dst + y * dst_uv_pitch, src + y * src_uv_pitch + x / 2, (w + 1) / 2);
+            }
+            src += ((h + 1) / 2) * src_uv_pitch;
+            dst += ((h + 1) / 2) * dst_uv_pitch;
+        }
+    }
+}
+
+/* Images only two pixels wide are converted by the plain C code, so comparing them against
+   the conversion of the whole image checks that the SIMD converters (SSE2, NEON, LSX) match it */
+static SDL_bool verify_yuv_simd(Uint32 format, const Uint8 *yuv, int yuv_pitch, int w, int h, Uint32 rgb_format)
+{
+    const int bpp = SDL_BYTESPERPIXEL(rgb_format);
+    const int rgb_pitch = w * bpp;
+    Uint8 *rgb = (Uint8 *)SDL_malloc(rgb_pitch * h);
+    Uint8 *column_rgb = (Uint8 *)SDL_malloc(2 * bpp * h);
+    Uint8 *column_yuv = (Uint8 *)SDL_malloc(MAX_YUV_SURFACE_SIZE(2, h, 0));
+    SDL_bool result = SDL_FALSE;
+    int x, y;
+
+    if (!rgb || !column_rgb || !column_yuv) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        goto done;
+    }
+
+    if (SDL_ConvertPixels(w, h, format, yuv, yuv_pitch, rgb_format, rgb, rgb_pitch) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s\n", SDL_GetPixelFormatName(format), SDL_GetPixelFormatName(rgb_format), SDL_GetError());
+        goto done;
+    }
+
+    for (x = 0; x < w; x += 2) {
+        const int column_w = SDL_min(2, w - x);
+        const int column_pitch = CalculateYUVPitch(format, column_w);
+
+        copy_yuv_columns(format, yuv, yuv_pitch, h, x, column_w, column_yuv, column_pitch);
+        if (SDL_ConvertPixels(column_w, h, format, column_yuv, column_pitch, rgb_format, column_rgb, column_w * bpp) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s\n", SDL_GetPixelFormatName(format), SDL_GetPixelFormatName(rgb_format), SDL_GetError());
+            goto done;
+        }
+        for (y = 0; y < h; ++y) {
+            if (SDL_memcmp(rgb + y * rgb_pitch + x * bpp, column_rgb + y * column_w * bpp, column_w * bpp) != 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Pixel at %d,%d converted from %s to %s doesn't match the C implementation\n", x, y, SDL_GetPixelFormatName(format), SDL_GetPixelFormatName(rgb_format));
+                goto done;
+            }
+        }
+    }
+    result = SDL_TRUE;
+
+done:
+    SDL_free(rgb);
+    SDL_free(column_rgb);
+    SDL_free(column_yuv);
+    return result;
+}
+
 static int run_automated_tests(int pattern_size, int extra_pitch)
 {
     const Uint32 formats[] = {
@@ -118,6 +202,14 @@ static int run_automated_tests(int pattern_size, int extra_pitch)
         SDL_PIXELFORMAT_UYVY,
         SDL_PIXELFORMAT_YVYU
     };
+    const Uint32 rgb_formats[] = {
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_BGRA8888,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_ABGR8888
+    };
     int i, j;
     SDL_Surface *pattern = generate_test_pattern(pattern_size);
     const int yuv_len = MAX_YUV_SURFACE_SIZE(pattern->w, pattern->h, extra_pitch);
@@ -144,6 +236,21 @@ static int run_automated_tests(int pattern_size, int extra_pitch)
         }
     }
 
+    /* Verify the SIMD conversion from YUV formats against the C implementation */
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        if (!ConvertRGBtoYUV(formats[i], pattern->pixels, pattern->pitch, yuv1, pattern->w, pattern->h, SDL_GetYUVConversionModeForResolution(pattern->w, pattern->h), 0, 100)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "ConvertRGBtoYUV() doesn't support converting to %s\n", SDL_GetPixelFormatName(formats[i]));
+            goto done;
+        }
+        yuv1_pitch = CalculateYUVPitch(formats[i], pattern->w);
+        for (j = 0; j < SDL_arraysize(rgb_formats); ++j) {
+            if (!verify_yuv_simd(formats[i], yuv1, yuv1_pitch, pattern->w, pattern->h, rgb_formats[j])) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed conversion from %s to %s\n", SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(rgb_formats[j]));
+                goto done;
+            }
+        }
+    }
+
     /* Verify conversion to YUV formats */
     for (i = 0; i < SDL_arraysize(formats); ++i) {
         yuv1_pitch = CalculateYUVPitch(formats[i], pattern->w) + extra_pitch;
@@ -241,6 +348,9 @@ int main(int argc, char **argv)
         /* Test: odd width and height with intrinsics, extra pitch */
         { SDL_TRUE, 33, 3 },
         { SDL_TRUE, 37, 3 },
+        /* Test: wide enough for full SIMD blocks and a remainder */
+        { SDL_TRUE, 71, 0 },
+        { SDL_TRUE, 71, 3 },
     };
     int arg = 1;
     const char *filename;